@@ -137,6 +137,8 @@ def main() :
    # n_arg_dict
    n_arg_dict = {
       'det_by_minor' : 9 ,
+      'det_by_lu'    : 9 ,
+      'det_by_memo'  : 9 ,
       'an_ode'       : 100 ,
       'llsq_obj'     : 9,
    }
@@ -144,6 +146,8 @@ def main() :
    # n_other_dict
    n_other_dict = {
       'det_by_minor' : 0 ,
+      'det_by_lu'    : 1 ,
+      'det_by_memo'  : 0 ,
       'an_ode'       : 9 ,
       'llsq_obj'     : 100
    }
@@ -152,7 +156,9 @@ def main() :
    for time_setup in [ True, False ] :
       #
       # algorithm
-      algorithm_list = [ 'det_by_minor' , 'an_ode' , 'llsq_obj' ]
+      algorithm_list = [
+         'det_by_minor' , 'det_by_lu' , 'det_by_memo' , 'an_ode' , 'llsq_obj'
+      ]
       for algorithm in algorithm_list :
          #
          # n_arg
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ADEPT_JACOBIAN_HPP
+# define CMPAD_ADEPT_JACOBIAN_HPP
+/*
+{xrst_begin adept_jacobian.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/jacobian.xrst
+   @Package@       , Adept
+   @#######@       , #####
+   @package@       , adept
+}
+
+Method
+******
+The function is recorded during each Jacobian evaluation.
+The independent and dependent variables are then declared to the
+Adept stack and the Jacobian is computed using
+the stack ``jacobian_forward`` or ``jacobian_reverse`` function.
+Adept returns the Jacobian in column major order,
+so it is transposed to row major order.
+
+{xrst_end adept_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_ADEPT
+
+# include <adept.h>
+# include <cmpad/jacobian.hpp>
+
+namespace cmpad { namespace adept { // BEGIN cmpad::adept namespace
+
+// cmpad::adept::jacobian
+template < template<class ADVector> class Algo> class jacobian
+: public
+::cmpad::jacobian {
+private:
+   //
+   // ADVector
+   typedef typename cmpad::vector<::adept::adouble> ADVector;
+   //
+   // option_
+   option_t                          option_;
+   //
+   // stack_
+   ::adept::Stack*                   stack_;
+   //
+   // algo_
+   Algo<ADVector>*                   algo_;
+   //
+   // forward_
+   bool                              forward_;
+   //
+   // jac_
+   // Jacobian in column major order
+   cmpad::vector<double>             jac_;
+   //
+   // J_
+   cmpad::vector<double>             J_;
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // default ctor
+   jacobian(void)
+   : stack_(nullptr)
+   , algo_(nullptr)
+   { }
+   //
+   ~jacobian(void)
+   {  if( algo_ != nullptr )
+         delete algo_;
+      if( stack_ != nullptr )
+         delete stack_;
+   }
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      if( algo_ != nullptr )
+         delete algo_;
+      //
+      // stack_
+      if( stack_ != nullptr )
+         delete stack_;
+      stack_ = new ::adept::Stack;
+      //
+      // algo_
+      algo_ = new Algo<ADVector>();
+      //
+      // algo_
+      algo_->setup(option);
+      //
+      // n
+      size_t n = algo_->domain();
+      //
+      // m
+      size_t m = algo_->range();
+      //
+      // forward_
+      choose_mode(m, n);
+      forward_ = mode() == "forward";
+      //
+      // jac_, J_
+      jac_.resize(m * n);
+      J_.resize(m * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_->domain(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_->range() * algo_->domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  // n
+      size_t n = algo_->domain();
+      //
+      // m
+      size_t m = algo_->range();
+      //
+      // ax
+      ADVector ax(n);
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = x[i];
+      //
+      // stack
+      stack_->new_recording();
+      //
+      // ay
+      ADVector ay = (*algo_)(ax);
+      assert( ay.size() == m );
+      //
+      // jac_
+      stack_->independent(ax.data(), n);
+      stack_->dependent(ay.data(), m);
+      if( forward_ )
+         stack_->jacobian_forward( jac_.data() );
+      else
+         stack_->jacobian_reverse( jac_.data() );
+      //
+      // J_
+      for(size_t i = 0; i < m; ++i)
+      {  for(size_t j = 0; j < n; ++j)
+            J_[i * n + j] = jac_[i + j * m];
+      }
+      //
+      return J_;
+   }
+};
+
+} } // END cmpad::adept namespace
+
+# endif // CMPAD_HAS_ADEPT
+// END C++
+# endif
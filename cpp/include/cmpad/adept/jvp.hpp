@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ADEPT_JVP_HPP
+# define CMPAD_ADEPT_JVP_HPP
+/*
+{xrst_begin adept_jvp.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/jvp.xrst
+   @Package@       , Adept
+   @#######@       , #####
+   @package@       , adept
+}
+
+Method
+******
+The function is recorded during each evaluation.
+For each of the *p* directions, the gradients are cleared,
+the direction is placed in the gradients for *x* ,
+and the stack ``compute_tangent_linear`` function is used
+to compute the corresponding gradients for *y* .
+
+{xrst_end adept_jvp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_ADEPT
+
+# include <adept.h>
+# include <cmpad/jvp.hpp>
+
+namespace cmpad { namespace adept { // BEGIN cmpad::adept namespace
+
+// cmpad::adept::jvp
+template < template<class ADVector> class Algo> class jvp
+: public
+::cmpad::jvp {
+private:
+   //
+   // ADVector
+   typedef typename cmpad::vector<::adept::adouble> ADVector;
+   //
+   // option_
+   option_t                          option_;
+   //
+   // stack_
+   ::adept::Stack*                   stack_;
+   //
+   // algo_
+   Algo<ADVector>*                   algo_;
+   //
+   // Y_
+   cmpad::vector<double>             Y_;
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // default ctor
+   jvp(void)
+   : stack_(nullptr)
+   , algo_(nullptr)
+   { }
+   //
+   ~jvp(void)
+   {  if( algo_ != nullptr )
+         delete algo_;
+      if( stack_ != nullptr )
+         delete stack_;
+   }
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      if( algo_ != nullptr )
+         delete algo_;
+      //
+      // stack_
+      if( stack_ != nullptr )
+         delete stack_;
+      stack_ = new ::adept::Stack;
+      //
+      // algo_
+      algo_ = new Algo<ADVector>();
+      //
+      // algo_
+      algo_->setup(option);
+      //
+      // Y_
+      Y_.resize( algo_->range() * option.n_direction );
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_->domain() * (1 + option_.n_direction); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_->range() * option_.n_direction; };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  // n, m, p
+      size_t n = algo_->domain();
+      size_t m = algo_->range();
+      size_t p = option_.n_direction;
+      assert( xv.size() == n * (1 + p) );
+      //
+      // ax
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = xv[j];
+      //
+      // stack
+      stack_->new_recording();
+      //
+      // ay
+      ADVector ay = (*algo_)(ax);
+      assert( ay.size() == m );
+      //
+      // ell
+      for(size_t ell = 0; ell < p; ++ell)
+      {  //
+         // ax
+         stack_->clear_gradients();
+         for(size_t j = 0; j < n; ++j)
+            ax[j].set_gradient( xv[n + j * p + ell] );
+         //
+         // ay
+         stack_->compute_tangent_linear();
+         //
+         // Y_
+         for(size_t i = 0; i < m; ++i)
+            Y_[i * p + ell] = ay[i].get_gradient();
+      }
+      //
+      return Y_;
+   }
+};
+
+} } // END cmpad::adept namespace
+
+# endif // CMPAD_HAS_ADEPT
+// END C++
+# endif
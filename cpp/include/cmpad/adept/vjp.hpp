@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ADEPT_VJP_HPP
+# define CMPAD_ADEPT_VJP_HPP
+/*
+{xrst_begin adept_vjp.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/vjp.xrst
+   @Package@       , Adept
+   @#######@       , #####
+   @package@       , adept
+}
+
+Method
+******
+The function is recorded during each evaluation.
+For each of the *q* weight vectors, the gradients are cleared,
+the weight vector is placed in the gradients for *y* ,
+and the stack ``compute_adjoint`` function is used
+to compute the corresponding gradients for *x* .
+Adept carries one adjoint per reverse sweep,
+so the recording is traversed *q* times.
+
+{xrst_end adept_vjp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_ADEPT
+
+# include <adept.h>
+# include <cmpad/vjp.hpp>
+
+namespace cmpad { namespace adept { // BEGIN cmpad::adept namespace
+
+// cmpad::adept::vjp
+template < template<class ADVector> class Algo> class vjp
+: public
+::cmpad::vjp {
+private:
+   //
+   // ADVector
+   typedef typename cmpad::vector<::adept::adouble> ADVector;
+   //
+   // option_
+   option_t                          option_;
+   //
+   // stack_
+   ::adept::Stack*                   stack_;
+   //
+   // algo_
+   Algo<ADVector>*                   algo_;
+   //
+   // Z_
+   cmpad::vector<double>             Z_;
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // default ctor
+   vjp(void)
+   : stack_(nullptr)
+   , algo_(nullptr)
+   { }
+   //
+   ~vjp(void)
+   {  if( algo_ != nullptr )
+         delete algo_;
+      if( stack_ != nullptr )
+         delete stack_;
+   }
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      if( algo_ != nullptr )
+         delete algo_;
+      //
+      // stack_
+      if( stack_ != nullptr )
+         delete stack_;
+      stack_ = new ::adept::Stack;
+      //
+      // algo_
+      algo_ = new Algo<ADVector>();
+      //
+      // algo_
+      algo_->setup(option);
+      //
+      // Z_
+      Z_.resize( option.n_direction * algo_->domain() );
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_->domain() + option_.n_direction * algo_->range(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return option_.n_direction * algo_->domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xw
+   ) override
+   {  // n, m, q
+      size_t n = algo_->domain();
+      size_t m = algo_->range();
+      size_t q = option_.n_direction;
+      assert( xw.size() == n + q * m );
+      //
+      // ax
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = xw[j];
+      //
+      // stack
+      stack_->new_recording();
+      //
+      // ay
+      ADVector ay = (*algo_)(ax);
+      assert( ay.size() == m );
+      //
+      // k
+      for(size_t k = 0; k < q; ++k)
+      {  //
+         // ay
+         stack_->clear_gradients();
+         for(size_t i = 0; i < m; ++i)
+            ay[i].set_gradient( xw[n + k * m + i] );
+         //
+         // ax
+         stack_->compute_adjoint();
+         //
+         // Z_
+         for(size_t j = 0; j < n; ++j)
+            Z_[k * n + j] = ax[j].get_gradient();
+      }
+      //
+      return Z_;
+   }
+};
+
+} } // END cmpad::adept namespace
+
+# endif // CMPAD_HAS_ADEPT
+// END C++
+# endif
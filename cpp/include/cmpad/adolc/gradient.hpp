@@ -16,6 +16,14 @@
    @not_codi@      , true
 }
 
+x_branch
+********
+If the algorithm's :ref:`cpp_fun_obj@x_branch` is true,
+the return value of ``zos_forward`` is used to detect when the result
+of a recorded comparison has changed.
+In this case the function is recorded again at the new argument value
+and the change is reported to :ref:`cpp_retape_count-name` .
+
 {xrst_end adolc_gradient.hpp}
 */
 // BEGIN C++
@@ -23,6 +31,7 @@
 
 # include <adolc/adolc.h>
 # include <cmpad/gradient.hpp>
+# include <cmpad/retape_count.hpp>
 
 namespace cmpad { namespace adolc { // BEGIN cmpad::adolc namespace
 
@@ -49,6 +58,32 @@ private:
    //
    // g_
    cmpad::vector<double>         g_;
+   //
+   // record
+   // record the function corresponding to algo_ at x using tag_
+   void record(const cmpad::vector<double>& x)
+   {  //
+      // n, m
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      //
+      // ax
+      // independent variables
+      int keep = 0;
+      trace_on(tag_, keep);
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] <<= x[j];
+      //
+      // ay
+      // dependent variable
+      ADVector ay = algo_(ax);
+      //
+      // create f : x -> y
+      double f;
+      ay[m-1] >>= f;
+      trace_off();
+   }
 //
 public:
    //
@@ -73,28 +108,15 @@ public:
       // n
       size_t n = algo_.domain();
       //
-      // m
-      size_t m = algo_.range();
-      //
       // tag_
       tag_ = 0;
       //
-      // ax
-      // independent variables
-      int keep = 0;
-      trace_on(tag_, keep);
-      ADVector ax(n);
+      // x, tag_
+      // record at x = 0
+      cmpad::vector<double> x(n);
       for(size_t j = 0; j < n; ++j)
-         ax[j] <<= 0.0;
-      //
-      // ay
-      // dependent variable
-      ADVector ay = algo_(ax);
-      //
-      // create f : x -> y
-      double f;
-      ay[m-1] >>= f;
-      trace_off();
+         x[j] = 0.0;
+      record(x);
       //
       // u_
       u_.resize(1);
@@ -118,7 +140,20 @@ public:
       // zos_forward
       int keep = 1; // keep this forward mode result
       double f;     // function result
-      zos_forward(tag_, one, n, keep, x.data(), &f);
+      int rc   = zos_forward(tag_, one, n, keep, x.data(), &f);
+      //
+      // tag_
+      // a negative return code means a recorded comparison has changed
+      if( algo_.x_branch() )
+      {  size_t n_change = 0;
+         if( rc < 0 )
+            n_change = 1;
+         cmpad::retape_count::check(n_change);
+         if( rc < 0 )
+         {  record(x);
+            zos_forward(tag_, one, n, keep, x.data(), &f);
+         }
+      }
       //
       // fos_reverse
       fos_reverse(tag_, one, n, u_.data(), g_.data() );
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ADOLC_HESSIAN_HPP
+# define CMPAD_ADOLC_HESSIAN_HPP
+/*
+{xrst_begin adolc_hessian.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian.xrst
+   @Package@       , ADOL-C
+   @#######@       , ######
+   @package@       , adolc
+}
+
+Method
+******
+The function is recorded once during setup.
+The ADOL-C ``hessian`` driver is used to compute the lower triangle
+of the Hessian and it is then copied to the upper triangle.
+
+{xrst_end adolc_hessian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_ADOLC
+
+# include <adolc/adolc.h>
+# include <cmpad/hessian.hpp>
+
+namespace cmpad { namespace adolc { // BEGIN cmpad::adolc namespace
+
+// cmpad::adolc::hessian
+template < template<class ADVector> class Algo > class hessian
+: public
+cmpad::hessian {
+private:
+   //
+   // ADVector
+   typedef cmpad::vector<adouble> ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // tag_
+   int                           tag_;
+   //
+   // h_
+   cmpad::vector<double>         h_;
+   //
+   // row_
+   // row_[i] is a pointer to the beginning of row i in h_
+   cmpad::vector<double*>        row_;
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // tag_
+      tag_ = 0;
+      //
+      // ax
+      // independent variables
+      int keep = 0;
+      trace_on(tag_, keep);
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] <<= 0.0;
+      //
+      // ay
+      // dependent variable
+      ADVector ay = algo_(ax);
+      //
+      // create f : x -> y
+      double f;
+      ay[m-1] >>= f;
+      trace_off();
+      //
+      // h_
+      h_.resize(n * n);
+      //
+      // row_
+      row_.resize(n);
+      for(size_t i = 0; i < n; ++i)
+         row_[i] = h_.data() + i * n;
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  assert( x.size() == algo_.domain() );
+      size_t n = algo_.domain();
+      //
+      // h_
+      // only the lower triangle is computed by adolc
+      ::hessian(tag_, int(n), const_cast<double*>( x.data() ), row_.data() );
+      for(size_t i = 0; i < n; ++i)
+      {  for(size_t j = i + 1; j < n; ++j)
+            h_[i * n + j] = h_[j * n + i];
+      }
+      //
+      return h_;
+   }
+};
+
+} } // END cmpad::adolc namespace
+
+# endif // CMPAD_HAS_ADOLC
+// END C++
+# endif
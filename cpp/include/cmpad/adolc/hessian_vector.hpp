@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ADOLC_HESSIAN_VECTOR_HPP
+# define CMPAD_ADOLC_HESSIAN_VECTOR_HPP
+/*
+{xrst_begin adolc_hessian_vector.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian_vector.xrst
+   @Package@       , ADOL-C
+   @#######@       , ######
+   @package@       , adolc
+}
+
+Method
+******
+The function is recorded once during setup.
+The ADOL-C ``hess_vec`` driver is used to compute the Hessian times
+a vector; i.e., a first order forward sweep followed by
+a second order reverse sweep.
+
+{xrst_end adolc_hessian_vector.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_ADOLC
+
+# include <adolc/adolc.h>
+# include <cmpad/hessian_vector.hpp>
+
+namespace cmpad { namespace adolc { // BEGIN cmpad::adolc namespace
+
+// cmpad::adolc::hessian_vector
+template < template<class ADVector> class Algo > class hessian_vector
+: public
+cmpad::hessian_vector {
+private:
+   //
+   // ADVector
+   typedef cmpad::vector<adouble> ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // tag_
+   int                           tag_;
+   //
+   // x_, v_
+   cmpad::vector<double>         x_;
+   cmpad::vector<double>         v_;
+   //
+   // hv_
+   cmpad::vector<double>         hv_;
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // tag_
+      tag_ = 0;
+      //
+      // ax
+      // independent variables
+      int keep = 0;
+      trace_on(tag_, keep);
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] <<= 0.0;
+      //
+      // ay
+      // dependent variable
+      ADVector ay = algo_(ax);
+      //
+      // create f : x -> y
+      double f;
+      ay[m-1] >>= f;
+      trace_off();
+      //
+      // x_, v_, hv_
+      x_.resize(n);
+      v_.resize(n);
+      hv_.resize(n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return 2 * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  size_t n = algo_.domain();
+      assert( xv.size() == 2 * n );
+      //
+      // x_, v_
+      for(size_t j = 0; j < n; ++j)
+      {  x_[j] = xv[j];
+         v_[j] = xv[n + j];
+      }
+      //
+      // hv_
+      hess_vec(tag_, int(n), x_.data(), v_.data(), hv_.data() );
+      //
+      return hv_;
+   }
+};
+
+} } // END cmpad::adolc namespace
+
+# endif // CMPAD_HAS_ADOLC
+// END C++
+# endif
@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ADOLC_JACOBIAN_HPP
+# define CMPAD_ADOLC_JACOBIAN_HPP
+/*
+{xrst_begin adolc_jacobian.hpp}
+{xrst_spell
+   fov
+   zos
+}
+
+{xrst_template ,
+   cpp/include/cmpad/jacobian.xrst
+   @Package@       , ADOL-C
+   @#######@       , ######
+   @package@       , adolc
+}
+
+Method
+******
+The function is recorded once during setup.
+
+forward
+=======
+The ADOL-C ``fov_forward`` driver is used with the identity matrix
+as the *n* directions.
+
+reverse
+=======
+The ADOL-C ``zos_forward`` driver, with *keep* equal to one,
+is followed by the ``fov_reverse`` driver
+with the identity matrix as the *m* range space weights.
+
+{xrst_end adolc_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_ADOLC
+
+# include <adolc/adolc.h>
+# include <cmpad/jacobian.hpp>
+
+namespace cmpad { namespace adolc { // BEGIN cmpad::adolc namespace
+
+// cmpad::adolc::jacobian
+template < template<class ADVector> class Algo > class jacobian
+: public
+cmpad::jacobian {
+private:
+   //
+   // ADVector
+   typedef cmpad::vector<adouble> ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // tag_
+   int                           tag_;
+   //
+   // forward_
+   bool                          forward_;
+   //
+   // x_, y_
+   cmpad::vector<double>         x_;
+   cmpad::vector<double>         y_;
+   //
+   // eye_
+   // the identity matrix of size n (forward) or m (reverse)
+   cmpad::vector<double>         eye_;
+   //
+   // eye_row_
+   // eye_row_[i] is a pointer to the beginning of row i in eye_
+   cmpad::vector<double*>        eye_row_;
+   //
+   // J_
+   cmpad::vector<double>         J_;
+   //
+   // J_row_
+   // J_row_[i] is a pointer to the beginning of row i in J_
+   cmpad::vector<double*>        J_row_;
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // forward_
+      choose_mode(m, n);
+      forward_ = mode() == "forward";
+      //
+      // tag_
+      tag_ = 0;
+      //
+      // ax
+      // independent variables
+      int keep = 0;
+      trace_on(tag_, keep);
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] <<= 0.0;
+      //
+      // ay
+      // dependent variables
+      ADVector ay = algo_(ax);
+      //
+      // create f : x -> y
+      y_.resize(m);
+      for(size_t i = 0; i < m; ++i)
+         ay[i] >>= y_[i];
+      trace_off();
+      //
+      // x_
+      x_.resize(n);
+      //
+      // eye_, eye_row_
+      size_t p = forward_ ? n : m;
+      eye_.resize(p * p);
+      eye_row_.resize(p);
+      for(size_t i = 0; i < p; ++i)
+      {  for(size_t j = 0; j < p; ++j)
+            eye_[i * p + j] = 0.0;
+         eye_[i * p + i] = 1.0;
+         eye_row_[i]     = eye_.data() + i * p;
+      }
+      //
+      // J_, J_row_
+      J_.resize(m * n);
+      J_row_.resize(m);
+      for(size_t i = 0; i < m; ++i)
+         J_row_[i] = J_.data() + i * n;
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  assert( x.size() == algo_.domain() );
+      int n = int( algo_.domain() );
+      int m = int( algo_.range() );
+      //
+      // x_
+      for(int j = 0; j < n; ++j)
+         x_[j] = x[j];
+      //
+      // J_
+      if( forward_ )
+      {  // Y = J * X where X is the identity matrix and Y is J_
+         fov_forward(
+            tag_, m, n, n, x_.data(), eye_row_.data(), y_.data(), J_row_.data()
+         );
+      }
+      else
+      {  // Z = U * J where U is the identity matrix and Z is J_
+         int keep = 1;
+         zos_forward(tag_, m, n, keep, x_.data(), y_.data());
+         fov_reverse(tag_, m, n, m, eye_row_.data(), J_row_.data());
+      }
+      //
+      return J_;
+   }
+};
+
+} } // END cmpad::adolc namespace
+
+# endif // CMPAD_HAS_ADOLC
+// END C++
+# endif
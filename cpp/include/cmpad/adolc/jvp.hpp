@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ADOLC_JVP_HPP
+# define CMPAD_ADOLC_JVP_HPP
+/*
+{xrst_begin adolc_jvp.hpp}
+{xrst_spell
+   fov
+}
+
+{xrst_template ,
+   cpp/include/cmpad/jvp.xrst
+   @Package@       , ADOL-C
+   @#######@       , ######
+   @package@       , adolc
+}
+
+Method
+******
+The function is recorded once during setup.
+The ADOL-C ``fov_forward`` driver is used with the *p* directions
+as the columns of its *n* by *p* direction matrix.
+
+{xrst_end adolc_jvp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_ADOLC
+
+# include <adolc/adolc.h>
+# include <cmpad/jvp.hpp>
+
+namespace cmpad { namespace adolc { // BEGIN cmpad::adolc namespace
+
+// cmpad::adolc::jvp
+template < template<class ADVector> class Algo > class jvp
+: public
+cmpad::jvp {
+private:
+   //
+   // ADVector
+   typedef cmpad::vector<adouble> ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // tag_
+   int                           tag_;
+   //
+   // x_, y_
+   cmpad::vector<double>         x_;
+   cmpad::vector<double>         y_;
+   //
+   // V_
+   cmpad::vector<double>         V_;
+   //
+   // V_row_
+   // V_row_[j] is a pointer to the beginning of row j in V_
+   cmpad::vector<double*>        V_row_;
+   //
+   // Y_
+   cmpad::vector<double>         Y_;
+   //
+   // Y_row_
+   // Y_row_[i] is a pointer to the beginning of row i in Y_
+   cmpad::vector<double*>        Y_row_;
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m, p
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t p = option.n_direction;
+      //
+      // tag_
+      tag_ = 0;
+      //
+      // ax
+      // independent variables
+      int keep = 0;
+      trace_on(tag_, keep);
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] <<= 0.0;
+      //
+      // ay
+      // dependent variables
+      ADVector ay = algo_(ax);
+      //
+      // create f : x -> y
+      y_.resize(m);
+      for(size_t i = 0; i < m; ++i)
+         ay[i] >>= y_[i];
+      trace_off();
+      //
+      // x_
+      x_.resize(n);
+      //
+      // V_, V_row_
+      V_.resize(n * p);
+      V_row_.resize(n);
+      for(size_t j = 0; j < n; ++j)
+         V_row_[j] = V_.data() + j * p;
+      //
+      // Y_, Y_row_
+      Y_.resize(m * p);
+      Y_row_.resize(m);
+      for(size_t i = 0; i < m; ++i)
+         Y_row_[i] = Y_.data() + i * p;
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() * (1 + option_.n_direction); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * option_.n_direction; };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  int n = int( algo_.domain() );
+      int m = int( algo_.range() );
+      int p = int( option_.n_direction );
+      assert( xv.size() == size_t( n * (1 + p) ) );
+      //
+      // x_, V_
+      for(int j = 0; j < n; ++j)
+         x_[j] = xv[j];
+      for(int k = 0; k < n * p; ++k)
+         V_[k] = xv[n + k];
+      //
+      // Y_
+      // Y = J * V where V is n by p and Y is m by p
+      fov_forward(
+         tag_, m, n, p, x_.data(), V_row_.data(), y_.data(), Y_row_.data()
+      );
+      //
+      return Y_;
+   }
+};
+
+} } // END cmpad::adolc namespace
+
+# endif // CMPAD_HAS_ADOLC
+// END C++
+# endif
@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ADOLC_SPARSE_JACOBIAN_HPP
+# define CMPAD_ADOLC_SPARSE_JACOBIAN_HPP
+/*
+{xrst_begin adolc_sparse_jacobian.hpp}
+{xrst_spell
+   jac
+}
+
+{xrst_template ,
+   cpp/include/cmpad/sparse_jacobian.xrst
+   @Package@       , ADOL-C
+   @#######@       , ######
+   @package@       , adolc
+}
+
+Method
+******
+The function is recorded once during setup.
+The ADOL-C ``sparse_jac`` driver is called during setup with
+*repeat* equal to zero (and *x* equal to zero).
+This computes the sparsity pattern and the coloring
+and its time is the :ref:`cpp_sparse_jacobian@sparsity_time` .
+During each Jacobian evaluation, ``sparse_jac`` is called with
+*repeat* equal to one, which reuses the pattern and coloring.
+The ADOL-C sparse drivers require that ADOL-C was built with ColPack.
+
+{xrst_end adolc_sparse_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_ADOLC
+
+# include <chrono>
+# include <cstdlib>
+# include <algorithm>
+# include <adolc/adolc.h>
+# include <adolc/adolc_sparse.h>
+# include <cmpad/sparse_jacobian.hpp>
+
+namespace cmpad { namespace adolc { // BEGIN cmpad::adolc namespace
+
+// cmpad::adolc::sparse_jacobian
+template < template<class ADVector> class Algo > class sparse_jacobian
+: public
+cmpad::sparse_jacobian {
+private:
+   //
+   // ADVector
+   typedef cmpad::vector<adouble> ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // tag_
+   int                           tag_;
+   //
+   // options_
+   // sparse_jac options; see the ADOL-C documentation
+   int                           options_[4];
+   //
+   // nnz_, rind_, cind_, values_
+   // memory for rind_, cind_, and values_ is allocated by ADOL-C
+   int                           nnz_;
+   unsigned int*                 rind_;
+   unsigned int*                 cind_;
+   double*                       values_;
+   //
+   // order_
+   // values_[ order_[k] ] corresponds to row_[k] and col_[k]
+   cmpad::vector<size_t>         order_;
+   //
+   // row_, col_
+   cmpad::vector<size_t>         row_;
+   cmpad::vector<size_t>         col_;
+   //
+   // J_
+   cmpad::vector<double>         J_;
+   //
+   // free_memory
+   void free_memory(void)
+   {  if( rind_ != nullptr )
+         std::free(rind_);
+      if( cind_ != nullptr )
+         std::free(cind_);
+      if( values_ != nullptr )
+         std::free(values_);
+      rind_   = nullptr;
+      cind_   = nullptr;
+      values_ = nullptr;
+   }
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // ctor
+   sparse_jacobian(void)
+   : nnz_(0), rind_(nullptr), cind_(nullptr), values_(nullptr)
+   { }
+   //
+   // dtor
+   ~sparse_jacobian(void)
+   {  free_memory(); }
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // tag_
+      tag_ = 0;
+      //
+      // ax
+      // independent variables
+      int keep = 0;
+      trace_on(tag_, keep);
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] <<= 0.0;
+      //
+      // ay
+      // dependent variables
+      ADVector ay = algo_(ax);
+      //
+      // create f : x -> y
+      cmpad::vector<double> y(m);
+      for(size_t i = 0; i < m; ++i)
+         ay[i] >>= y[i];
+      trace_off();
+      //
+      // options_
+      options_[0] = 0; // sparsity pattern by index domains
+      options_[1] = 0; // safe mode
+      options_[2] = 0; // not used when computing a Jacobian
+      options_[3] = 0; // column compression; i.e., forward mode
+      if( n > m )
+         options_[3] = 1; // row compression; i.e., reverse mode
+      //
+      // nnz_, rind_, cind_, values_
+      // compute sparsity pattern and coloring
+      free_memory();
+      cmpad::vector<double> x(n);
+      for(size_t j = 0; j < n; ++j)
+         x[j] = 0.0;
+      int repeat = 0;
+      using std::chrono::steady_clock;
+      steady_clock::time_point t_start = steady_clock::now();
+      ::sparse_jac(
+         tag_, int(m), int(n), repeat, x.data(),
+         &nnz_, &rind_, &cind_, &values_, options_
+      );
+      //
+      // sparsity_time
+      std::chrono::duration<double> t_sparsity = steady_clock::now() - t_start;
+      set_sparsity_time( t_sparsity.count() );
+      //
+      // order_
+      size_t nnz = size_t(nnz_);
+      order_.resize(nnz);
+      for(size_t k = 0; k < nnz; ++k)
+         order_[k] = k;
+      unsigned int* rind = rind_;
+      unsigned int* cind = cind_;
+      std::sort( order_.begin(), order_.end(),
+         [rind, cind](size_t k1, size_t k2)
+         {  if( rind[k1] != rind[k2] )
+               return rind[k1] < rind[k2];
+            return cind[k1] < cind[k2];
+         }
+      );
+      //
+      // row_, col_
+      row_.resize(nnz);
+      col_.resize(nnz);
+      for(size_t k = 0; k < nnz; ++k)
+      {  row_[k] = size_t( rind_[ order_[k] ] );
+         col_[k] = size_t( cind_[ order_[k] ] );
+      }
+      //
+      // J_
+      J_.resize(nnz);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // row
+   const cmpad::vector<size_t>& row(void) const override
+   {  return row_; }
+   //
+   // col
+   const cmpad::vector<size_t>& col(void) const override
+   {  return col_; }
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  assert( x.size() == algo_.domain() );
+      int n = int( algo_.domain() );
+      int m = int( algo_.range() );
+      //
+      // values_
+      int repeat = 1;
+      ::sparse_jac(
+         tag_, m, n, repeat, x.data(),
+         &nnz_, &rind_, &cind_, &values_, options_
+      );
+      //
+      // J_
+      for(size_t k = 0; k < J_.size(); ++k)
+         J_[k] = values_[ order_[k] ];
+      //
+      return J_;
+   }
+};
+
+} } // END cmpad::adolc namespace
+
+# endif // CMPAD_HAS_ADOLC
+// END C++
+# endif
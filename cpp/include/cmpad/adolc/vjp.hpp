@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ADOLC_VJP_HPP
+# define CMPAD_ADOLC_VJP_HPP
+/*
+{xrst_begin adolc_vjp.hpp}
+{xrst_spell
+   fov
+   zos
+}
+
+{xrst_template ,
+   cpp/include/cmpad/vjp.xrst
+   @Package@       , ADOL-C
+   @#######@       , ######
+   @package@       , adolc
+}
+
+Method
+******
+The function is recorded once during setup.
+The ADOL-C ``zos_forward`` driver is used to evaluate the function at *x*
+(keeping the values needed for reverse mode).
+The ``fov_reverse`` driver is then used with the *q* weight vectors
+as the rows of its *q* by *m* weight matrix;
+i.e., all the weight vectors are carried in one reverse sweep.
+
+{xrst_end adolc_vjp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_ADOLC
+
+# include <adolc/adolc.h>
+# include <cmpad/vjp.hpp>
+
+namespace cmpad { namespace adolc { // BEGIN cmpad::adolc namespace
+
+// cmpad::adolc::vjp
+template < template<class ADVector> class Algo > class vjp
+: public
+cmpad::vjp {
+private:
+   //
+   // ADVector
+   typedef cmpad::vector<adouble> ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // tag_
+   int                           tag_;
+   //
+   // y_
+   cmpad::vector<double>         y_;
+   //
+   // W_
+   cmpad::vector<double>         W_;
+   //
+   // W_row_
+   // W_row_[k] is a pointer to the beginning of row k in W_
+   cmpad::vector<double*>        W_row_;
+   //
+   // Z_
+   cmpad::vector<double>         Z_;
+   //
+   // Z_row_
+   // Z_row_[k] is a pointer to the beginning of row k in Z_
+   cmpad::vector<double*>        Z_row_;
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m, q
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t q = option.n_direction;
+      //
+      // tag_
+      tag_ = 0;
+      //
+      // ax
+      // independent variables
+      int keep = 0;
+      trace_on(tag_, keep);
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] <<= 0.0;
+      //
+      // ay
+      // dependent variables
+      ADVector ay = algo_(ax);
+      //
+      // create f : x -> y
+      y_.resize(m);
+      for(size_t i = 0; i < m; ++i)
+         ay[i] >>= y_[i];
+      trace_off();
+      //
+      // W_, W_row_
+      W_.resize(q * m);
+      W_row_.resize(q);
+      for(size_t k = 0; k < q; ++k)
+         W_row_[k] = W_.data() + k * m;
+      //
+      // Z_, Z_row_
+      Z_.resize(q * n);
+      Z_row_.resize(q);
+      for(size_t k = 0; k < q; ++k)
+         Z_row_[k] = Z_.data() + k * n;
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() + option_.n_direction * algo_.range(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return option_.n_direction * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xw
+   ) override
+   {  int n = int( algo_.domain() );
+      int m = int( algo_.range() );
+      int q = int( option_.n_direction );
+      assert( xw.size() == size_t( n + q * m ) );
+      //
+      // zos_forward
+      int keep = 1; // keep this forward mode result
+      zos_forward(tag_, m, n, keep, xw.data(), y_.data());
+      //
+      // W_
+      for(int k = 0; k < q * m; ++k)
+         W_[k] = xw[n + k];
+      //
+      // Z_
+      // Z = W * J where W is q by m and Z is q by n
+      fov_reverse(tag_, m, n, q, W_row_.data(), Z_row_.data());
+      //
+      return Z_;
+   }
+};
+
+} } // END cmpad::adolc namespace
+
+# endif // CMPAD_HAS_ADOLC
+// END C++
+# endif
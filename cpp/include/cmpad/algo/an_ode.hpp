@@ -9,6 +9,7 @@
 {xrst_spell
    kutta
    runge
+   tf
    yf
 }
 
@@ -38,6 +39,11 @@ yf
 **
 The return value *yf* is :math:`y(t)` at :math:`t = 2` .
 
+data
+****
+The :ref:`cpp_fun_obj@Data` for this algorithm is the final time
+*tf* ; i.e., *n_data* is one and the default value for *tf* is two.
+
 {xrst_toc_hidden after
    cpp/xam/an_ode.cpp
    cpp/include/cmpad/algo/runge_kutta.hpp
@@ -79,19 +85,29 @@ private:
 public:
    //
    // operator
-   Vector operator()(const Vector& y) const
+   // in place version used by an_ode
+   void operator()(const Vector& y, Vector& dy) const
    {  size_t n = y.size();
       assert( x_.size() == n );
-      Vector dy(n);
+      assert( dy.size() == n );
       dy[0] = x_[0];
       for(size_t i = 1; i < n; ++i)
          dy[i] = x_[i] * y[i-1];
+   }
+   //
+   // operator
+   Vector operator()(const Vector& y) const
+   {  Vector dy( y.size() );
+      (*this)(y, dy);
       return dy;
    }
    //
    // set_x
    void set_x(const Vector& x)
-   {  x_ = x;
+   {  if( x_.size() != x.size() )
+         x_.resize( x.size() );
+      for(size_t i = 0; i < x.size(); ++i)
+         x_[i] = x[i];
    }
 };
 
@@ -109,8 +125,16 @@ private:
    // yf_
    Vector yf_;
    //
+   // tf_
+   // a vector of size one containing the final time
+   Vector tf_;
+   //
    // fun_
    an_ode_fun_vec<Vector> fun_;
+   //
+   // work_
+   // work space used by runge_kutta
+   runge_kutta_work<Vector> work_;
 public:
    // scalar type
    typedef typename Vector::value_type scalar_type;
@@ -130,6 +154,20 @@ public:
    size_t range(void) const override
    {  return option_.n_arg; }
    //
+   // n_data
+   size_t n_data(void) const override
+   {  return tf_.size(); }
+   //
+   // data
+   Vector data(void) const override
+   {  return tf_; }
+   //
+   // set_data
+   void set_data(const Vector& data) override
+   {  assert( data.size() == 1 );
+      tf_[0] = data[0];
+   }
+   //
    // setup
    void setup(const option_t& option) override
    {  //
@@ -145,8 +183,13 @@ public:
       for(size_t i = 0; i < zero_.size(); ++i)
          zero_[i] = scalar_type(0.0);
       //
-      // yf_
+      // yf_, work_
       yf_.resize(option.n_arg);
+      work_.resize(option.n_arg);
+      //
+      // tf_
+      tf_.resize(1);
+      tf_[0] = scalar_type(2.0);
    }
    //
    // operator
@@ -156,15 +199,12 @@ public:
       assert( x.size() == domain() );
       fun_.set_x(x);
       //
-      // tf
-      scalar_type tf = scalar_type(2.0);
-      //
       // ns
       size_t ns = option_.n_other;
       //
       // yf
       const Vector& yi = zero_;
-      yf_ = cmpad::runge_kutta(fun_, yi, tf, ns);
+      cmpad::runge_kutta(fun_, yi, tf_[0], ns, yf_, work_);
       assert( yf_.size() == domain() );
       //
       return yf_;
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ALGO_AN_ODE_ADAPTIVE_HPP
+# define CMPAD_ALGO_AN_ODE_ADAPTIVE_HPP
+/*
+{xrst_begin_parent cpp_an_ode_adaptive}
+{xrst_spell
+   dormand
+   yf
+}
+
+Use C++ Adaptive Dormand-Prince Method to Solve an ODE
+######################################################
+
+{xrst_template ,
+   cpp/include/cmpad/algo/template.xrst
+   $algo_name$      , an_ode_adaptive
+   $obj_name$       , ode
+   $********$       , ***
+}
+
+n_arg
+*****
+see :ref:`an_ode_adaptive@option@n_arg` .
+
+n_other
+=======
+see :ref:`an_ode_adaptive@option@n_other` .
+
+x_branch
+********
+The :ref:`cpp_fun_obj@x_branch` function returns true
+because the steps depend on *x* ; see :ref:`an_ode_adaptive@Taping` .
+
+x
+*
+This is the :ref:`an_ode@ODE@Parameter Vector` that appears in the ODE.
+
+yf
+**
+The return value *yf* is :math:`y(t)` at :math:`t = 2` .
+
+{xrst_toc_hidden after
+   cpp/xam/an_ode_adaptive.cpp
+   cpp/include/cmpad/algo/dormand_prince.hpp
+}
+Example
+*******
+:ref:`xam_an_ode_adaptive.cpp-name`
+contains an example and test of ``an_ode_adaptive`` .
+
+Source Code
+***********
+:ref:`an_ode_adaptive.hpp-name` displays the source code for this algorithm.
+
+{xrst_end cpp_an_ode_adaptive}
+------------------------------------------------------------------------------
+{xrst_begin an_ode_adaptive.hpp}
+
+an_ode_adaptive: Source Code
+############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end an_ode_adaptive.hpp}
+*/
+// BEGIN C++
+# include <cassert>
+# include <cmath>
+# include <cmpad/fun_obj.hpp>
+# include <cmpad/algo/an_ode.hpp>
+# include <cmpad/algo/dormand_prince.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// BEGIN CLASS_DECLARE
+template <class Vector> class an_ode_adaptive : public fun_obj<Vector>
+// END CLASS_DECLARE
+{
+private:
+   // option_
+   option_t option_;
+   //
+   // tol_
+   double tol_;
+   //
+   // zero_
+   Vector zero_;
+   //
+   // yf_
+   Vector yf_;
+   //
+   // fun_
+   an_ode_fun_vec<Vector> fun_;
+   //
+   // work_
+   // work space used by dormand_prince
+   dormand_prince_work<Vector> work_;
+public:
+   // scalar type
+   typedef typename Vector::value_type scalar_type;
+   //
+   // vector_type
+   typedef Vector vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_arg; }
+   //
+   // range
+   size_t range(void) const override
+   {  return option_.n_arg; }
+   //
+   // x_branch
+   bool x_branch(void) const override
+   {  return true; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // n_arg, n_other
+      assert( option.n_arg > 0 );
+      assert( option.n_other > 0 );
+      //
+      // option_
+      option_ = option;
+      //
+      // tol_
+      tol_ = std::pow(10.0, - double( option.n_other ) );
+      //
+      // zero_
+      zero_.resize(option.n_arg);
+      for(size_t i = 0; i < zero_.size(); ++i)
+         zero_[i] = scalar_type(0.0);
+      //
+      // yf_, work_
+      yf_.resize(option.n_arg);
+      work_.resize(option.n_arg);
+   }
+   //
+   // operator
+   const Vector& operator()(const Vector& x) override
+   {  //
+      // x
+      assert( x.size() == domain() );
+      fun_.set_x(x);
+      //
+      // tf
+      double tf = 2.0;
+      //
+      // yf
+      const Vector& yi = zero_;
+      cmpad::dormand_prince(fun_, yi, tf, tol_, yf_, work_);
+      //
+      return yf_;
+   }
+};
+
+}  // END cmpad namespace
+
+// END C++
+# endif
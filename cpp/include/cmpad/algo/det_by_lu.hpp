@@ -0,0 +1,222 @@
+# ifndef CMPAD_ALGO_DET_BY_LU_HPP
+# define CMPAD_ALGO_DET_BY_LU_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin_parent cpp_det_by_lu}
+
+C++ Determinant Using LU Factorization
+######################################
+
+{xrst_template ,
+   cpp/include/cmpad/algo/template.xrst
+   $algo_name$      , det_by_lu
+   $obj_name$       , det
+   $********$       , ***
+}
+
+ell
+***
+see :ref:`det_by_lu@ell` .
+
+n_arg
+*****
+see :ref:`det_by_lu@option@n_arg` .
+
+n_other
+*******
+see :ref:`det_by_lu@option@n_other` .
+
+x
+*
+The argument *x* has size *n_arg* = :math:`\ell * \ell` .
+The elements of the matrix :math:`A(x)` is defined as follows:
+for :math:`i = 0 , \ldots , \ell-1` and :math:`j = 0 , \ldots , \ell-1`, by
+
+.. math::
+
+   A(x)_{i,j} = x[ i * \ell + j]
+
+y
+*
+The return value *y* has size :math:`m = 1` and its element
+is equal to the determinant of :math:`A(x)`.
+
+{xrst_toc_hidden after
+   cpp/xam/det_by_lu.cpp
+}
+
+Example
+*******
+The file
+:ref:`xam_det_by_lu.cpp-name`
+contains an example and test of ``det_by_lu`` .
+
+Source Code
+***********
+:ref:`det_by_lu.hpp-name` displays the source code for this algorithm.
+
+{xrst_end cpp_det_by_lu}
+---------------------------------------------------------------------------
+{xrst_begin det_by_lu.hpp}
+
+C++ det_by_lu: Source Code
+##########################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end det_by_lu.hpp}
+---------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cmath> // for std::sqrt
+# include <cassert>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// BEGIN CLASS_DECLARE
+template <class Vector> class det_by_lu : public fun_obj<Vector>
+// END CLASS_DECLARE
+{
+private:
+   // option_
+   option_t option_;
+   //
+   // ell_
+   size_t ell_;
+   //
+   // pivot_
+   // is partial pivoting used
+   bool pivot_;
+   //
+   // row_
+   // row_[i] is the row of a_ that currently corresponds to row i
+   cmpad::vector<size_t> row_;
+   //
+   // a_
+   // work space that holds the matrix during the elimination
+   Vector a_;
+   //
+   // y_
+   Vector y_;
+   //
+public:
+   //
+   // scalar_type
+   typedef typename Vector::value_type scalar_type;
+   //
+   // vector_type
+   typedef Vector vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_arg; }
+   // range
+   size_t range(void) const override
+   {  return 1; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // n_arg, n_other
+      assert( option.n_arg > 0 );
+      assert( option.n_other <= 1 );
+      //
+      // option_
+      option_ = option;
+      //
+      // ell_
+      ell_ = size_t( std::sqrt( double( option.n_arg ) ) );
+      if( ell_ * ell_ != option.n_arg )
+         ++ell_;
+      assert( ell_ * ell_ == option.n_arg );
+      //
+      // pivot_
+      pivot_ = option.n_other == 1;
+      //
+      // row_, a_, y_
+      row_.resize(ell_);
+      a_.resize(option.n_arg);
+      y_.resize(1);
+   }
+   // operator
+   const Vector& operator()(const Vector& x) override
+   {  //
+      // ell
+      size_t ell = ell_;
+      //
+      // a_, row_
+      for(size_t k = 0; k < ell * ell; ++k)
+         a_[k] = x[k];
+      for(size_t i = 0; i < ell; ++i)
+         row_[i] = i;
+      //
+      // negate
+      // is the permutation corresponding to row_ odd
+      bool negate = false;
+      //
+      // det
+      scalar_type det = 1.0;
+      //
+      // k
+      for(size_t k = 0; k < ell; ++k)
+      {  //
+         // row_, negate
+         if( pivot_ )
+         {  // compare squares so that only operations that every
+            // scalar type supports are used
+            size_t p           = k;
+            scalar_type a_kk   = a_[ row_[k] * ell + k ];
+            scalar_type max_sq = a_kk * a_kk;
+            for(size_t i = k + 1; i < ell; ++i)
+            {  scalar_type a_ik = a_[ row_[i] * ell + k ];
+               scalar_type sq   = a_ik * a_ik;
+               if( max_sq < sq )
+               {  p      = i;
+                  max_sq = sq;
+               }
+            }
+            if( p != k )
+            {  size_t r = row_[k];
+               row_[k]  = row_[p];
+               row_[p]  = r;
+               negate   = ! negate;
+            }
+         }
+         //
+         // det
+         size_t rk        = row_[k] * ell;
+         scalar_type a_kk = a_[rk + k];
+         det             *= a_kk;
+         //
+         // a_
+         // eliminate column k below the diagonal
+         for(size_t i = k + 1; i < ell; ++i)
+         {  size_t ri          = row_[i] * ell;
+            scalar_type factor = a_[ri + k] / a_kk;
+            for(size_t j = k + 1; j < ell; ++j)
+               a_[ri + j] -= factor * a_[rk + j];
+         }
+      }
+      //
+      // y_
+      if( negate )
+         y_[0] = - det;
+      else
+         y_[0] = det;
+      //
+      return y_;
+   }
+
+};
+
+} // END cmpad namespace
+// END C++
+# endif
@@ -0,0 +1,193 @@
+# ifndef CMPAD_ALGO_DET_BY_MEMO_HPP
+# define CMPAD_ALGO_DET_BY_MEMO_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin_parent cpp_det_by_memo}
+{xrst_spell
+   memoized
+}
+
+C++ Determinant Using Memoized Expansion by Minors
+##################################################
+
+{xrst_template ,
+   cpp/include/cmpad/algo/template.xrst
+   $algo_name$      , det_by_memo
+   $obj_name$       , det
+   $********$       , ***
+}
+
+ell
+***
+see :ref:`det_by_memo@ell` .
+
+n_arg
+*****
+see :ref:`det_by_memo@option@n_arg` .
+
+n_other
+*******
+see :ref:`det_by_memo@option@n_other` .
+
+x
+*
+The argument *x* has size *n_arg* = :math:`\ell * \ell` .
+The elements of the matrix :math:`A(x)` is defined as follows:
+for :math:`i = 0 , \ldots , \ell-1` and :math:`j = 0 , \ldots , \ell-1`, by
+
+.. math::
+
+   A(x)_{i,j} = x[ i * \ell + j]
+
+y
+*
+The return value *y* has size :math:`m = 1` and its element
+is equal to the determinant of :math:`A(x)`.
+
+{xrst_toc_hidden after
+   cpp/xam/det_by_memo.cpp
+}
+
+Example
+*******
+The file
+:ref:`xam_det_by_memo.cpp-name`
+contains an example and test of ``det_by_memo`` .
+
+Source Code
+***********
+:ref:`det_by_memo.hpp-name` displays the source code for this algorithm.
+
+{xrst_end cpp_det_by_memo}
+---------------------------------------------------------------------------
+{xrst_begin det_by_memo.hpp}
+
+C++ det_by_memo: Source Code
+############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end det_by_memo.hpp}
+---------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cmath> // for std::sqrt
+# include <cassert>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// BEGIN CLASS_DECLARE
+template <class Vector> class det_by_memo : public fun_obj<Vector>
+// END CLASS_DECLARE
+{
+private:
+   // option_
+   option_t option_;
+   //
+   // ell_
+   size_t ell_;
+   //
+   // memo_
+   // memo_[mask] is the determinant of the minor with the last
+   // k rows and the columns in mask, where k is the number of bits in mask.
+   Vector memo_;
+   //
+   // y_
+   Vector y_;
+   //
+public:
+   //
+   // scalar_type
+   typedef typename Vector::value_type scalar_type;
+   //
+   // vector_type
+   typedef Vector vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_arg; }
+   // range
+   size_t range(void) const override
+   {  return 1; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // n_arg, n_other
+      assert( option.n_arg > 0 );
+      assert( option.n_other == 0 );
+      //
+      // option_
+      option_ = option;
+      //
+      // ell_
+      ell_ = size_t( std::sqrt( double( option.n_arg ) ) );
+      if( ell_ * ell_ != option.n_arg )
+         ++ell_;
+      assert( ell_ * ell_ == option.n_arg );
+      assert( ell_ < 8 * sizeof(size_t) );
+      //
+      // memo_, y_
+      memo_.resize( size_t(1) << ell_ );
+      y_.resize(1);
+   }
+   // operator
+   const Vector& operator()(const Vector& x) override
+   {  //
+      // ell, n_mask
+      size_t ell    = ell_;
+      size_t n_mask = size_t(1) << ell;
+      //
+      // memo_
+      // the determinant of the empty minor is one
+      memo_[0] = 1.0;
+      //
+      // mask
+      // mask with bit j removed is less than mask, so its determinant
+      // has already been computed.
+      for(size_t mask = 1; mask < n_mask; ++mask)
+      {  //
+         // k, i
+         // the minor has k columns and uses rows i, ..., ell-1
+         size_t k = 0;
+         for(size_t j = 0; j < ell; ++j)
+            k += (mask >> j) & 1;
+         size_t i = ell - k;
+         //
+         // memo_[mask]
+         // expand along the first row of the minor
+         scalar_type detM = 0.0;
+         int sign = 1;
+         for(size_t j = 0; j < ell; ++j)
+         {  size_t bit = size_t(1) << j;
+            if( mask & bit )
+            {  scalar_type term = x[ i * ell + j ] * memo_[mask ^ bit];
+               if( sign > 0 )
+                  detM = detM + term;
+               else
+                  detM = detM - term;
+               sign = - sign;
+            }
+         }
+         memo_[mask] = detM;
+      }
+      //
+      // y_
+      y_[0] = memo_[n_mask - 1];
+      //
+      return y_;
+   }
+
+};
+
+} // END cmpad namespace
+// END C++
+# endif
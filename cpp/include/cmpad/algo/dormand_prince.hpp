@@ -0,0 +1,339 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ALGO_DORMAND_PRINCE_HPP
+# define CMPAD_ALGO_DORMAND_PRINCE_HPP
+
+/*
+{xrst_begin_parent dormand_prince}
+{xrst_spell
+   dormand
+   dy
+   fsal
+   nan
+   tf
+   tol
+   yf
+   yi
+   yt
+}
+
+A C++ Adaptive Step Dormand-Prince Solver
+#########################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/algo/dormand_prince.hpp>``
+| |tab| ``cmpad::dormand_prince_work`` < *Vector* > *work*
+| |tab| *n_step* = ``cmpad::dormand_prince`` (
+| |tab| |tab| *fun* , *yi* , *tf*, *tol* , *yf* , *work*
+| |tab| )
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+Purpose
+*******
+This routine returns an approximate solution
+for :math:`y( t^f )` where :math:`y(0) = y^i` and
+:math:`y' (t) = f(y)` .
+It uses the Dormand-Prince embedded Runge-Kutta 5(4) method
+with first same as last (FSAL) stages.
+The difference between the fifth and fourth order approximations
+is used to estimate the error and control the step size.
+
+Vector
+******
+The vectors *yi* and *yf* have this
+fun_obj :ref:`cpp_fun_obj@vector_type` .
+
+fun
+***
+The syntax *fun* ( *yt* , *dy* ) ,
+were *yt* is :math:`y(t)` ,
+sets *dy* equal to the derivative :math:`y'(t)`  .
+Both *yt* and *dy* are *Vector* objects with the same size
+(the input value of the elements of *dy* does not matter).
+
+yi
+**
+is the value of :math:`y(t)` at :math:`t = 0` .
+
+tf
+**
+is the value of *t* at which we wish to evaluate :math:`y(t)` .
+It must be greater than zero.
+
+tol
+***
+is the absolute and relative error tolerance for each step.
+A step is accepted if
+
+.. math::
+
+   \max_j \frac{ e_j^2 }{ tol^2 ( 1 + y_j^2 ) } \leq 1
+
+where :math:`e` is the error estimate for the step and
+:math:`y` is the fifth order approximation at the end of the step.
+(Using squares, instead of absolute values, only requires operations
+that every scalar type supports.)
+
+Step Size
+*********
+The first step size is *tf* .
+The ratio between a step size and the previous step size is chosen
+from a discrete set of factors between 0.2 and 5.0 using comparisons
+of the error ratio above with constants.
+Hence the step sizes are ``double`` values (not functions of the scalar type)
+and derivatives of the solution do not include derivatives of the
+step size control.
+On the other hand, which steps are accepted and rejected,
+and the step sizes, depend on the value of the elements of *yi* and *fun*.
+
+Failure
+*******
+The following conditions are fatal errors
+(a message is printed on ``std::cerr`` and the program exits):
+
+#. The error ratio above is nan.
+#. The step size is less than :math:`16 \varepsilon t^f`, where
+   :math:`\varepsilon` is machine epsilon; e.g., *tol* is below roundoff.
+#. The number of steps, accepted plus rejected, reaches 100000.
+
+This ensures that ``dormand_prince`` returns, or fails loudly,
+instead of shrinking the step size forever.
+
+yf
+**
+The size of *yf* must be the same as *yi* and
+its input value does not matter.
+Upon return it is the approximation for :math:`y(t)` at *t* = *tf* .
+
+work
+****
+This contains the vectors used to hold the
+intermediate values during the calculation.
+It can be reused for multiple calls to ``dormand_prince`` so that
+there are no memory allocations (once it has the proper size).
+
+n_step
+******
+is the number of steps, accepted plus rejected, used by the calculation.
+
+{xrst_toc_table after
+   cpp/xam/dormand_prince.cpp
+}
+Example
+*******
+:ref:`xam_dormand_prince.cpp-name`
+contains an example and test of ``dormand_prince`` .
+
+{xrst_end dormand_prince}
+---------------------------------------------------------------------------
+{xrst_begin dormand_prince.hpp}
+
+C++ dormand_prince Source Code
+##############################
+
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end dormand_prince.hpp}
+---------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cassert>
+# include <cstdlib>
+# include <iostream>
+# include <limits>
+# include <cmpad/vector.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// dormand_prince_work
+template <class Vector> struct dormand_prince_work
+{  //
+   // k, y_tmp, y_new
+   // k[s] is the derivative for stage s
+   Vector k[7], y_tmp, y_new;
+   //
+   // resize
+   void resize(size_t n)
+   {  if( y_tmp.size() != n )
+      {  for(size_t s = 0; s < 7; ++s)
+            k[s].resize(n);
+         y_tmp.resize(n);
+         y_new.resize(n);
+      }
+   }
+};
+
+// BEGIN PROTOTYPE
+template <class Vector, class Fun>
+size_t dormand_prince(
+   const Fun&                           fun  ,
+   const Vector&                        yi   ,
+   double                               tf   ,
+   double                               tol  ,
+   Vector&                              yf   ,
+   dormand_prince_work<Vector>&         work )
+// END PROTOTYPE
+{  //
+   // scalar_type
+   typedef typename Vector::value_type scalar_type;
+   //
+   // a, e
+   // Butcher tableau a; the last row is also the fifth order weights.
+   // The error weights e are the fifth minus the fourth order weights.
+   static const double a[7][6] = {
+      { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+      { 1.0/5.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+      { 3.0/40.0, 9.0/40.0, 0.0, 0.0, 0.0, 0.0 },
+      { 44.0/45.0, -56.0/15.0, 32.0/9.0, 0.0, 0.0, 0.0 },
+      {  19372.0/6561.0, -25360.0/2187.0, 64448.0/6561.0, -212.0/729.0,
+         0.0, 0.0
+      },
+      {  9017.0/3168.0, -355.0/33.0, 46732.0/5247.0, 49.0/176.0,
+         -5103.0/18656.0, 0.0
+      },
+      {  35.0/384.0, 0.0, 500.0/1113.0, 125.0/192.0,
+         -2187.0/6784.0, 11.0/84.0
+      }
+   };
+   static const double e[7] = {
+      71.0/57600.0, 0.0, -71.0/16695.0, 71.0/1920.0,
+      -17253.0/339200.0, 22.0/525.0, -1.0/40.0
+   };
+   //
+   // factor, bound
+   // If err_ratio <= bound[j], the next step size can be factor[j] times
+   // the current step size; i.e., bound[j] = (0.9 / factor[j])^10 .
+   const size_t n_factor = 7;
+   static const double factor[n_factor] = {
+      5.0, 4.0, 2.0, 1.0, 0.5, 0.25, 0.2
+   };
+   double bound[n_factor];
+   for(size_t j = 0; j < n_factor; ++j)
+   {  double r  = 0.9 / factor[j];
+      double r2 = r * r;
+      double r4 = r2 * r2;
+      bound[j]  = r4 * r4 * r2;
+   }
+   //
+   // n
+   size_t n = yi.size();
+   assert( yf.size() == n );
+   assert( tf > 0.0 );
+   //
+   // k, y_tmp, y_new
+   work.resize(n);
+   Vector* k     = work.k;
+   Vector& y_tmp = work.y_tmp;
+   Vector& y_new = work.y_new;
+   //
+   // tol_sq
+   double tol_sq = tol * tol;
+   //
+   // h_min, max_step
+   // smallest step size and largest number of steps before failing
+   double h_min    = 16.0 * std::numeric_limits<double>::epsilon() * tf;
+   size_t max_step = 100000;
+   //
+   // yf, k[0]
+   for(size_t i = 0; i < n; ++i)
+      yf[i] = yi[i];
+   fun(yf, k[0]);
+   //
+   // t, h, n_step
+   double t      = 0.0;
+   double h      = tf;
+   size_t n_step = 0;
+   while( t < tf )
+   {  //
+      // last, h
+      bool last = tf - t <= h;
+      if( last )
+         h = tf - t;
+      //
+      // k[1], ..., k[6], y_new
+      // the last stage is evaluated at y_new
+      for(size_t s = 1; s < 7; ++s)
+      {  Vector& y_s = s < 6 ? y_tmp : y_new;
+         for(size_t i = 0; i < n; ++i)
+         {  scalar_type sum = a[s][0] * k[0][i];
+            for(size_t j = 1; j < s; ++j)
+               sum += a[s][j] * k[j][i];
+            y_s[i] = yf[i] + h * sum;
+         }
+         fun(y_s, k[s]);
+      }
+      //
+      // err_ratio, is_nan
+      scalar_type err_ratio = 0.0;
+      bool        is_nan    = false;
+      for(size_t i = 0; i < n; ++i)
+      {  scalar_type sum = e[0] * k[0][i];
+         for(size_t j = 1; j < 7; ++j)
+            sum += e[j] * k[j][i];
+         scalar_type err   = h * sum;
+         scalar_type scale = tol_sq * (1.0 + y_new[i] * y_new[i]);
+         scalar_type ratio = err * err / scale;
+         if( err_ratio < ratio )
+            err_ratio = ratio;
+         else if( ! (ratio <= err_ratio) )
+            is_nan = true;
+      }
+      //
+      // n_step
+      ++n_step;
+      //
+      // check for nan (both comparisons above are false)
+      if( is_nan )
+      {  std::cerr << "cmpad::dormand_prince: error ratio is nan\n";
+         std::exit(1);
+      }
+      //
+      // t, yf, k[0]
+      // accept the step (first same as last)
+      if( err_ratio <= 1.0 )
+      {  if( last )
+            t = tf;
+         else
+            t += h;
+         for(size_t i = 0; i < n; ++i)
+         {  yf[i]   = y_new[i];
+            k[0][i] = k[6][i];
+         }
+      }
+      //
+      // h
+      size_t j = 0;
+      while( j < n_factor - 1 && ! ( err_ratio <= bound[j] ) )
+         ++j;
+      h *= factor[j];
+      //
+      // check h and n_step
+      if( t < tf && h < h_min )
+      {  std::cerr << "cmpad::dormand_prince: step size h = " << h
+                   << " < h_min = " << h_min << " (tol = " << tol << ")\n";
+         std::exit(1);
+      }
+      if( t < tf && max_step <= n_step )
+      {  std::cerr << "cmpad::dormand_prince: number of steps = " << n_step
+                   << " (tol = " << tol << ")\n";
+         std::exit(1);
+      }
+   }
+   return n_step;
+}
+
+} // END cmpad namespace
+// END C++
+# endif
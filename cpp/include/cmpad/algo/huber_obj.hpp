@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ALGO_HUBER_OBJ_HPP
+# define CMPAD_ALGO_HUBER_OBJ_HPP
+/*
+{xrst_begin_parent cpp_huber_obj}
+
+C++ Huber Robust Smoothing Objective
+####################################
+
+{xrst_template ,
+   cpp/include/cmpad/algo/template.xrst
+   $algo_name$      , huber_obj
+   $obj_name$       , huber
+   $********$       , *****
+}
+
+n_arg
+*****
+see :ref:`huber_obj@option@n_arg` .
+
+n_other
+*******
+see :ref:`huber_obj@option@n_other` .
+
+x_branch
+********
+The :ref:`cpp_fun_obj@x_branch` function returns true
+when *n_other* is zero (native C++ branches are used).
+It also returns true when *n_other* is one and the conditional expressions
+are not recorded for this scalar type; see
+:ref:`cpp_cond_exp@recorded` .
+
+{xrst_toc_hidden after
+   cpp/xam/huber_obj.cpp
+}
+Example
+*******
+The file :ref:`xam_huber_obj.cpp-name`
+contains an example and test of ``huber_obj`` .
+
+Source Code
+***********
+:ref:`huber_obj.hpp-name` displays the source code for this algorithm.
+
+{xrst_end cpp_huber_obj}
+------------------------------------------------------------------------------
+{xrst_begin huber_obj.hpp}
+
+huber_obj: Source Code
+######################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end huber_obj.hpp}
+*/
+// BEGIN C++
+# include <cassert>
+# include <cmpad/fun_obj.hpp>
+# include <cmpad/cond_exp.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// BEGIN CLASS_DECLARE
+template <class Vector> class huber_obj : public fun_obj<Vector>
+// END CLASS_DECLARE
+{
+private:
+   // option_
+   option_t option_;
+   //
+   // cond_exp_
+   // are conditional expressions (instead of native branches) used
+   bool cond_exp_;
+   //
+   // delta_
+   // the Huber loss is quadratic for residuals with absolute value < delta_
+   double delta_;
+   //
+   // tau_
+   // differences with absolute value < tau_ are not penalized
+   double tau_;
+   //
+   // s_
+   // the data values
+   Vector s_;
+   //
+   // y_
+   Vector y_;
+public:
+   // scalar type
+   typedef typename Vector::value_type scalar_type;
+   //
+   // vector_type
+   typedef Vector vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_arg; }
+   //
+   // range
+   size_t range(void) const override
+   {  return 1; }
+   //
+   // x_branch
+   // a conditional expression that is not recorded is a native branch
+   bool x_branch(void) const override
+   {  return ! ( cond_exp_ && cond_exp_recorded<scalar_type>::value ); }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // n_arg, n_other
+      assert( option.n_arg > 0 );
+      assert( option.n_other <= 1 );
+      //
+      // option_
+      option_ = option;
+      //
+      // n_arg
+      size_t n_arg = option.n_arg;
+      //
+      // cond_exp_, delta_, tau_
+      cond_exp_ = option.n_other == 1;
+      delta_    = 1.5;
+      tau_      = 0.5;
+      //
+      // s_
+      // sign( t_i ) where t_i = -1 + 2 * i / (n_arg - 1),
+      // every fourth value is an outlier
+      s_.resize(n_arg);
+      for(size_t i = 0; i < n_arg; ++i)
+      {  size_t twice_i = 2 * i;
+         if( twice_i + 1 == n_arg )
+            s_[i] = 0.0;
+         else if( twice_i + 1 < n_arg )
+            s_[i] = -1.0;
+         else
+            s_[i] = +1.0;
+         if( i % 4 == 3 )
+            s_[i] = 3.0 * s_[i];
+      }
+      //
+      // y_
+      y_.resize(1);
+   }
+   //
+   // operator
+   const Vector& operator()(const Vector& x) override
+   {  //
+      // n_arg
+      size_t n_arg = option_.n_arg;
+      //
+      // zero, half, delta, tau
+      scalar_type zero(0.0), half(0.5), delta(delta_), tau(tau_);
+      //
+      // sum
+      scalar_type sum(0.0);
+      //
+      // sum
+      // Huber loss for the residuals x_i - s_i
+      for(size_t i = 0; i < n_arg; ++i)
+      {  scalar_type r     = x[i] - s_[i];
+         scalar_type neg_r = - r;
+         scalar_type quad  = half * r * r;
+         scalar_type abs_r, loss;
+         if( cond_exp_ )
+         {  abs_r             = cmpad::cond_exp_lt(r, zero, neg_r, r);
+            scalar_type lin   = delta * (abs_r - half * delta);
+            loss              = cmpad::cond_exp_lt(abs_r, delta, quad, lin);
+         }
+         else
+         {  if( r < zero )
+               abs_r = neg_r;
+            else
+               abs_r = r;
+            if( abs_r < delta )
+               loss = quad;
+            else
+               loss = delta * (abs_r - half * delta);
+         }
+         sum += loss;
+      }
+      //
+      // sum
+      // thresholded penalty for the differences x_{i+1} - x_i
+      for(size_t i = 0; i + 1 < n_arg; ++i)
+      {  scalar_type d     = x[i+1] - x[i];
+         scalar_type neg_d = - d;
+         scalar_type abs_d, excess;
+         if( cond_exp_ )
+         {  abs_d             = cmpad::cond_exp_lt(d, zero, neg_d, d);
+            scalar_type above = abs_d - tau;
+            excess            = cmpad::cond_exp_lt(tau, abs_d, above, zero);
+         }
+         else
+         {  if( d < zero )
+               abs_d = neg_d;
+            else
+               abs_d = d;
+            if( tau < abs_d )
+               excess = abs_d - tau;
+            else
+               excess = zero;
+         }
+         sum += excess * excess;
+      }
+      //
+      // y_
+      y_[0] = sum;
+      //
+      return y_;
+   }
+};
+
+} // END cmpad namespace
+// END C++
+# endif
@@ -6,6 +6,9 @@
 # define CMPAD_ALGO_LLSQ_OBJ_HPP
 /*
 {xrst_begin_parent cpp_llsq_obj}
+{xrst_spell
+   valvector
+}
 
 C++ Linear Least Squares Objective
 ##################################
@@ -26,6 +29,12 @@ n_other
 *******
 see :ref:`llsq_obj@option@n_other` .
 
+data
+****
+The :ref:`cpp_fun_obj@Data` for this algorithm is the vector *s*
+in the :ref:`llsq_obj@Function` ; i.e., *n_data* is equal to *n_other* .
+This is not available for the ``valvector`` special version.
+
 {xrst_toc_hidden after
    cpp/xam/llsq_obj.cpp
 }
@@ -106,6 +115,21 @@ public:
    size_t range(void) const override
    {  return 1; }
    //
+   // n_data
+   size_t n_data(void) const override
+   {  return q_.size(); }
+   //
+   // data
+   Vector data(void) const override
+   {  return q_; }
+   //
+   // set_data
+   void set_data(const Vector& data) override
+   {  assert( data.size() == q_.size() );
+      for(size_t j = 0; j < q_.size(); ++j)
+         q_[j] = data[j];
+   }
+   //
    // setup
    void setup(const option_t& option) override
    {  //
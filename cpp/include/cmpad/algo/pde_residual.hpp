@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ALGO_PDE_RESIDUAL_HPP
+# define CMPAD_ALGO_PDE_RESIDUAL_HPP
+/*
+{xrst_begin_parent cpp_pde_residual}
+
+C++ Finite Difference PDE Residual
+##################################
+
+{xrst_template ,
+   cpp/include/cmpad/algo/template.xrst
+   $algo_name$      , pde_residual
+   $obj_name$       , pde
+   $********$       , ***
+}
+
+n_arg
+*****
+see :ref:`pde_residual@option@n_arg` .
+
+n_other
+*******
+see :ref:`pde_residual@option@n_other` .
+
+x
+*
+This is the vector of values :math:`u_{i,j}` on the interior grid points;
+see :ref:`pde_residual@Grid` .
+
+y
+*
+The return value *y* is the residual vector :math:`r(u)` ;
+see :ref:`pde_residual@Residual` .
+
+{xrst_toc_hidden after
+   cpp/xam/pde_residual.cpp
+}
+Example
+*******
+:ref:`xam_pde_residual.cpp-name`
+contains an example and test of ``pde_residual`` .
+
+Source Code
+***********
+:ref:`pde_residual.hpp-name` displays the source code for this algorithm.
+
+{xrst_end cpp_pde_residual}
+------------------------------------------------------------------------------
+{xrst_begin pde_residual.hpp}
+
+pde_residual: Source Code
+#########################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end pde_residual.hpp}
+*/
+// BEGIN C++
+# include <cassert>
+# include <cmath>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// BEGIN CLASS_DECLARE
+template <class Vector> class pde_residual : public fun_obj<Vector>
+// END CLASS_DECLARE
+{
+private:
+   // option_
+   option_t option_;
+   //
+   // ell_
+   // number of interior grid points in each coordinate direction
+   size_t ell_;
+   //
+   // h2_inv_
+   // one over the square of the grid spacing
+   double h2_inv_;
+   //
+   // r_
+   Vector r_;
+public:
+   // scalar type
+   typedef typename Vector::value_type scalar_type;
+   //
+   // vector_type
+   typedef Vector vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_arg; }
+   //
+   // range
+   size_t range(void) const override
+   {  return option_.n_arg; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // ell_
+      ell_ = size_t( std::sqrt( double( option.n_arg ) ) );
+      if( ell_ * ell_ != option.n_arg )
+         ++ell_;
+      //
+      // n_arg, n_other
+      assert( option.n_arg > 0 );
+      assert( ell_ * ell_ == option.n_arg );
+      assert( option.n_other == 0 );
+      //
+      // option_
+      option_ = option;
+      //
+      // h2_inv_
+      double h = 1.0 / double(ell_ + 1);
+      h2_inv_  = 1.0 / (h * h);
+      //
+      // r_
+      r_.resize(option.n_arg);
+   }
+   //
+   // operator
+   const Vector& operator()(const Vector& x) override
+   {  //
+      // x
+      assert( x.size() == domain() );
+      //
+      // zero
+      scalar_type zero(0.0);
+      //
+      // r_
+      for(size_t i = 0; i < ell_; ++i)
+      {  for(size_t j = 0; j < ell_; ++j)
+         {  //
+            // k
+            size_t k = i * ell_ + j;
+            //
+            // neighbor values, zero on the boundary
+            scalar_type u_south = (i > 0)        ? x[k - ell_] : zero;
+            scalar_type u_north = (i + 1 < ell_) ? x[k + ell_] : zero;
+            scalar_type u_west  = (j > 0)        ? x[k - 1]    : zero;
+            scalar_type u_east  = (j + 1 < ell_) ? x[k + 1]    : zero;
+            //
+            // laplace
+            // minus the five point Laplacian of u at grid point k
+            scalar_type laplace = 4.0 * x[k];
+            laplace            -= u_south + u_north + u_west + u_east;
+            laplace            *= h2_inv_;
+            //
+            // r_[k]
+            r_[k] = laplace + x[k] * x[k] - 1.0;
+         }
+      }
+      return r_;
+   }
+};
+
+}  // END cmpad namespace
+
+// END C++
+# endif
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ALGO_ROSEN_OBJ_HPP
+# define CMPAD_ALGO_ROSEN_OBJ_HPP
+/*
+{xrst_begin_parent cpp_rosen_obj}
+
+C++ Chained Rosenbrock Objective
+################################
+
+{xrst_template ,
+   cpp/include/cmpad/algo/template.xrst
+   $algo_name$      , rosen_obj
+   $obj_name$       , rosen
+   $********$       , *****
+}
+
+n_arg
+*****
+see :ref:`rosen_obj@option@n_arg` .
+
+n_other
+*******
+see :ref:`rosen_obj@option@n_other` .
+
+{xrst_toc_hidden after
+   cpp/xam/rosen_obj.cpp
+}
+Example
+*******
+The file :ref:`xam_rosen_obj.cpp-name`
+contains an example and test of ``rosen_obj`` .
+
+Source Code
+***********
+:ref:`rosen_obj.hpp-name` displays the source code for this algorithm.
+
+{xrst_end cpp_rosen_obj}
+------------------------------------------------------------------------------
+{xrst_begin rosen_obj.hpp}
+
+rosen_obj: Source Code
+######################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end rosen_obj.hpp}
+*/
+// BEGIN C++
+# include <cassert>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// BEGIN CLASS_DECLARE
+template <class Vector> class rosen_obj : public fun_obj<Vector>
+// END CLASS_DECLARE
+{
+private:
+   // option_
+   option_t option_;
+   //
+   // y_
+   Vector y_;
+public:
+   // scalar type
+   typedef typename Vector::value_type scalar_type;
+   //
+   // vector_type
+   typedef Vector vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_arg; }
+   //
+   // range
+   size_t range(void) const override
+   {  return 1; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // n_arg, n_other
+      assert( option.n_arg > 1 );
+      assert( option.n_other == 0 );
+      //
+      // option_
+      option_ = option;
+      //
+      // y_
+      y_.resize(1);
+   }
+   //
+   // operator
+   const Vector& operator()(const Vector& x) override
+   {  //
+      // x
+      assert( x.size() == domain() );
+      //
+      // sum
+      // sum of the element functions
+      scalar_type sum(0.0);
+      for(size_t i = 1; i < option_.n_arg; ++i)
+      {  scalar_type a = x[i] - x[i-1] * x[i-1];
+         scalar_type b = 1.0 - x[i-1];
+         sum          += 100.0 * a * a + b * b;
+      }
+      //
+      // y_
+      y_[0] = sum;
+      //
+      return y_;
+   }
+};
+
+}  // END cmpad namespace
+
+// END C++
+# endif
@@ -24,12 +24,16 @@ Syntax
 ******
 | |tab| ``# include <cmpad/algo/runge_kutta.hpp>``
 | |tab| *yf* = ``cmpad::runge_kutta`` ( *fun* , *yi* , *tf*, *ns* )
+| |tab| ``cmpad::runge_kutta_work`` < *Vector* > *work*
+| |tab| ``cmpad::runge_kutta`` ( *fun* , *yi* , *tf*, *ns* , *yf* , *work* )
 
 Prototype
 *********
 {xrst_literal
    // BEGIN PROTOTYPE
    // END PROTOTYPE
+   // BEGIN VALUE_PROTOTYPE
+   // END VALUE_PROTOTYPE
 }
 
 Purpose
@@ -45,10 +49,23 @@ fun_obj :ref:`cpp_fun_obj@vector_type` .
 
 fun
 ***
-The syntax *dy* = *fun* ( *yt* ) ,
+Both *yt* and *dy* below are represented as *Vector* objects.
+
+Return Value
+============
+In the syntax where *yf* is the return value,
+*dy* = *fun* ( *yt* ) ,
 were *yt* is :math:`y(t)` ,
 sets *dy* equal to the derivative :math:`y'(t)`  .
-Both *yt* and *dy* are represented as *Vector* objects.
+
+In Place
+========
+In the syntax where *yf* is an argument,
+*fun* ( *yt* , *dy* ) ,
+sets *dy* equal to the derivative :math:`y'(t)`  .
+The size of *dy* is the same as the size of *yt* and its input
+value does not matter.
+This avoids allocating a new vector for each evaluation of :math:`f(y)` .
 
 yi
 **
@@ -66,8 +83,20 @@ the solution.
 
 yf
 **
-The return value *yf* has the same size as *yi* and is the approximation
+The vector *yf* has the same size as *yi* and is the approximation
 for :math:`y(t)` at *t* = *tf* .
+If it is an argument, its size must be the same as *yi* and
+its input value does not matter.
+
+work
+****
+If *work* is present, it contains the vectors used to hold the
+intermediate values during the calculation.
+It can be reused for multiple calls to ``runge_kutta`` so that
+there are no memory allocations (once it has the proper size).
+The return value syntax uses the in place syntax with
+a local *work* and an adapter from *dy* = *fun* ( *yt* ) to
+*fun* ( *yt* , *dy* ) .
 
 {xrst_toc_table after
    cpp/xam/runge_kutta.cpp
@@ -94,17 +123,55 @@ C++ runge_kutta Source Code
 */
 // BEGIN C++
 
+# include <cassert>
 # include <cmpad/vector.hpp>
 
 namespace cmpad { // BEGIN cmpad namespace
 
+// runge_kutta_work
+template <class Vector> struct runge_kutta_work
+{  //
+   // k1, k2, k3, k4, y_tmp
+   Vector k1, k2, k3, k4, y_tmp;
+   //
+   // resize
+   void resize(size_t n)
+   {  if( k1.size() != n )
+      {  k1.resize(n);
+         k2.resize(n);
+         k3.resize(n);
+         k4.resize(n);
+         y_tmp.resize(n);
+      }
+   }
+};
+
+// runge_kutta_value_fun
+// adapter from the syntax dy = fun(y) to the syntax fun(y, dy)
+template <class Vector, class Fun> class runge_kutta_value_fun
+{
+private:
+   // fun_
+   const Fun& fun_;
+public:
+   // ctor
+   runge_kutta_value_fun(const Fun& fun) : fun_(fun)
+   { }
+   //
+   // operator
+   void operator()(const Vector& y, Vector& dy) const
+   {  dy = fun_(y); }
+};
+
 // BEGIN PROTOTYPE
 template <class Vector, class Fun>
-Vector runge_kutta(
-   const Fun&                           fun ,
-   const Vector&                        yi  ,
-   const typename Vector::value_type    tf  ,
-   size_t                               ns  )
+void runge_kutta(
+   const Fun&                           fun  ,
+   const Vector&                        yi   ,
+   const typename Vector::value_type    tf   ,
+   size_t                               ns   ,
+   Vector&                              yf   ,
+   runge_kutta_work<Vector>&            work )
 // END PROTOTYPE
 {
    // scalar_type
@@ -115,40 +182,65 @@ Vector runge_kutta(
    scalar_type six = scalar_type(6.0);
    // n
    size_t n = yi.size();
+   assert( yf.size() == n );
    //
    // h
    scalar_type h  = tf / scalar_type( double(ns) );
    //
    // k1, k2, k3, k4, y_tmp
-   Vector k1(n), k2(n), k3(n), k4(n), y_tmp(n);
-   //
+   work.resize(n);
+   Vector& k1    = work.k1;
+   Vector& k2    = work.k2;
+   Vector& k3    = work.k3;
+   Vector& k4    = work.k4;
+   Vector& y_tmp = work.y_tmp;
    //
    // i_step, yf
-   Vector yf = yi;
+   for(size_t i = 0; i < n; ++i)
+      yf[i] = yi[i];
    for(size_t i_step = 0; i_step < ns; ++i_step)
    {  //
       // k1
-      k1 = fun(yf);
+      fun(yf, k1);
       //
       // k2
       for(size_t i = 0; i < n; ++i)
          y_tmp[i] = yf[i] + h * k1[i] / two;
-      k2 = fun(y_tmp);
+      fun(y_tmp, k2);
       //
       // k3
       for(size_t i = 0; i < n; ++i)
          y_tmp[i] = yf[i] + h * k2[i] / two;
-      k3 = fun(y_tmp);
+      fun(y_tmp, k3);
       //
       // k4
       for(size_t i = 0; i < n; ++i)
          y_tmp[i] = yf[i] + h * k3[i];
-      k4 = fun(y_tmp);
+      fun(y_tmp, k4);
       //
       // yf
       for(size_t i = 0; i < n; ++i)
          yf[i] = yf[i] + h * (k1[i] + two * k2[i] + two * k3[i] + k4[i]) / six;
    }
+}
+
+// BEGIN VALUE_PROTOTYPE
+template <class Vector, class Fun>
+Vector runge_kutta(
+   const Fun&                           fun ,
+   const Vector&                        yi  ,
+   const typename Vector::value_type    tf  ,
+   size_t                               ns  )
+// END VALUE_PROTOTYPE
+{  //
+   // yf, work
+   Vector yf( yi.size() );
+   runge_kutta_work<Vector> work;
+   //
+   // yf
+   runge_kutta_value_fun<Vector, Fun> in_place(fun);
+   runge_kutta(in_place, yi, tf, ns, yf, work);
+   //
    return yf;
 }
 
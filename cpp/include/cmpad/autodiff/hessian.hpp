@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_AUTODIFF_HESSIAN_HPP
+# define CMPAD_AUTODIFF_HESSIAN_HPP
+/*
+{xrst_begin autodiff_hessian.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian.xrst
+   @Package@       , autodiff
+   @#######@       , ########
+   @package@       , autodiff
+}
+
+Method
+******
+The Hessian is computed using the autodiff second order forward mode
+``dual2nd`` type and its ``hessian`` driver.
+
+{xrst_end autodiff_hessian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_AUTODIFF
+
+# include <autodiff/forward/dual.hpp>
+# include <autodiff/forward/dual/eigen.hpp>
+# include <cmpad/hessian.hpp>
+
+namespace cmpad { namespace autodiff { // BEGIN cmpad::autodiff namespace
+
+
+// hessian
+template < template<class ADVector> class Algo> class hessian
+: public
+cmpad::hessian {
+private:
+   //
+   // ADVector
+   typedef ::autodiff::VectorXdual2nd ADVector;
+   //
+   // option_
+   option_t                option_;
+   //
+   // algo_
+   Algo<ADVector>          algo_;
+   //
+   // ax_, ay_
+   ADVector                ax_;
+   ADVector                ay_;
+   //
+   // g_, h_, h_copy_
+   Eigen::VectorXd         g_;
+   Eigen::MatrixXd         h_;
+   cmpad::vector<double>   h_copy_;
+   //
+   // y_
+   ::autodiff::dual2nd     y_;
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      //
+      // ax_
+      ax_.resize(n);
+      //
+      // ay_
+      ay_.resize(m);
+      //
+      // g_, h_, h_copy_
+      g_.resize(n);
+      h_.resize(n, n);
+      h_copy_.resize(n * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  // n
+      size_t n = domain();
+      //
+      // ax_
+      for(size_t j = 0; j < n; ++j)
+         ax_[j] = x[j];
+      //
+      auto f = [&](const ADVector& ax)
+      {  size_t m = algo_.range();
+         ay_ = algo_(ax_);
+         return ay_[m-1];
+      };
+      //
+      // forward mode computation of Hessian
+      h_ = ::autodiff::hessian(f, wrt(ax_), at(ax_), y_, g_);
+      //
+      // h_copy_
+      for(size_t i = 0; i < n; ++i)
+      {  for(size_t j = 0; j < n; ++j)
+            h_copy_[i * n + j] = h_(i, j);
+      }
+      //
+      return h_copy_;
+   }
+};
+
+} } // END cmpad::autodiff namespace
+
+# endif // CMPAD_HAS_AUTODIFF
+// END C++
+# endif
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_AUTODIFF_JACOBIAN_HPP
+# define CMPAD_AUTODIFF_JACOBIAN_HPP
+/*
+{xrst_begin autodiff_jacobian.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/jacobian.xrst
+   @Package@       , autodiff
+   @#######@       , ########
+   @package@       , autodiff
+}
+
+Method
+******
+The Jacobian is computed using the autodiff forward mode
+``real`` type and its ``jacobian`` driver.
+The autodiff ``real`` type does not have a reverse mode,
+so *jac* . ``mode`` () is ``forward`` for all requests.
+
+{xrst_end autodiff_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_AUTODIFF
+
+# include <autodiff/forward/real.hpp>
+# include <autodiff/forward/real/eigen.hpp>
+# include <cmpad/jacobian.hpp>
+
+namespace cmpad { namespace autodiff { // BEGIN cmpad::autodiff namespace
+
+
+// jacobian
+template < template<class ADVector> class Algo> class jacobian
+: public
+cmpad::jacobian {
+private:
+   //
+   // ADVector
+   typedef ::autodiff::VectorXreal ADVector;
+   //
+   // option_
+   option_t                option_;
+   //
+   // algo_
+   Algo<ADVector>          algo_;
+   //
+   // ax_, ay_
+   ADVector                ax_;
+   ADVector                ay_;
+   //
+   // J_, J_copy_
+   Eigen::MatrixXd         J_;
+   cmpad::vector<double>   J_copy_;
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      //
+      // mode
+      // only forward mode is available
+      set_mode("forward");
+      choose_mode(m, n);
+      //
+      // ax_
+      ax_.resize(n);
+      //
+      // ay_
+      ay_.resize(m);
+      //
+      // J_, J_copy_
+      J_.resize(m, n);
+      J_copy_.resize(m * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  // n, m
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      //
+      // ax_
+      for(size_t j = 0; j < n; ++j)
+         ax_[j] = x[j];
+      //
+      auto f = [&](const ADVector& ax)
+      {  ay_ = algo_(ax);
+         return ay_;
+      };
+      //
+      // forward mode computation of Jacobian
+      J_ = ::autodiff::jacobian(f, wrt(ax_), at(ax_));
+      //
+      // J_copy_
+      for(size_t i = 0; i < m; ++i)
+      {  for(size_t j = 0; j < n; ++j)
+            J_copy_[i * n + j] = J_(i, j);
+      }
+      //
+      return J_copy_;
+   }
+};
+
+} } // END cmpad::autodiff namespace
+
+# endif // CMPAD_HAS_AUTODIFF
+// END C++
+# endif
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_AUTODIFF_JVP_HPP
+# define CMPAD_AUTODIFF_JVP_HPP
+/*
+{xrst_begin autodiff_jvp.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/jvp.xrst
+   @Package@       , autodiff
+   @#######@       , ########
+   @package@       , autodiff
+}
+
+Method
+******
+The autodiff forward mode ``real`` type is used.
+It carries one direction, so the algorithm is evaluated once
+for each of the *p* directions.
+
+{xrst_end autodiff_jvp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_AUTODIFF
+
+# include <autodiff/forward/real.hpp>
+# include <autodiff/forward/real/eigen.hpp>
+# include <cmpad/jvp.hpp>
+
+namespace cmpad { namespace autodiff { // BEGIN cmpad::autodiff namespace
+
+
+// jvp
+template < template<class ADVector> class Algo> class jvp
+: public
+cmpad::jvp {
+private:
+   //
+   // ADVector
+   typedef ::autodiff::VectorXreal ADVector;
+   //
+   // option_
+   option_t                option_;
+   //
+   // algo_
+   Algo<ADVector>          algo_;
+   //
+   // ax_, ay_
+   ADVector                ax_;
+   ADVector                ay_;
+   //
+   // Y_
+   cmpad::vector<double>   Y_;
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m, p
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t p = option.n_direction;
+      //
+      // ax_, ay_
+      ax_.resize(n);
+      ay_.resize(m);
+      //
+      // Y_
+      Y_.resize(m * p);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() * (1 + option_.n_direction); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * option_.n_direction; };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  // n, m, p
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t p = option_.n_direction;
+      assert( xv.size() == n * (1 + p) );
+      //
+      // ax_
+      // index 0 is the value and index 1 is the first order derivative
+      for(size_t j = 0; j < n; ++j)
+         ax_[j][0] = xv[j];
+      //
+      // ell
+      for(size_t ell = 0; ell < p; ++ell)
+      {  //
+         // ax_
+         for(size_t j = 0; j < n; ++j)
+            ax_[j][1] = xv[n + j * p + ell];
+         //
+         // ay_
+         ay_ = algo_(ax_);
+         //
+         // Y_
+         for(size_t i = 0; i < m; ++i)
+            Y_[i * p + ell] = ay_[i][1];
+      }
+      //
+      return Y_;
+   }
+};
+
+} } // END cmpad::autodiff namespace
+
+# endif // CMPAD_HAS_AUTODIFF
+// END C++
+# endif
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_BATCH_GRADIENT_HPP
+# define CMPAD_BATCH_GRADIENT_HPP
+/*
+{xrst_begin cpp_batch_gradient}
+{xrst_spell
+   typedef
+}
+
+C++ Abstract Class For Calculating a Batch of Gradients
+#######################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/batch_gradient.hpp>``
+| |tab| ``class`` *Batch* ``: public cmpad::batch_gradient`` {
+| |tab| |tab| *...*
+| |tab| };
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+Purpose
+*******
+A batch gradient evaluates the gradient of the same function at
+many argument points in one call.
+This enables a package to amortize its setup, and its per call overhead,
+over all the points in the batch.
+
+Batch
+*****
+This is a :ref:`cpp_fun_obj-name` interface to a batch of gradients
+(we use *batch* for a corresponding object).
+The gradient is for the last component of the range space of the algorithm
+(as in :ref:`cpp_gradient-name` ).
+
+setup
+=====
+The object *batch* is initialized using its ``setup`` member function.
+The ``setup`` functions should do calculations that do not depend on *x*
+(to make the evaluation of the gradients faster).
+
+n_batch
+=======
+We use *n_batch* for :ref:`option_t@n_batch` in the
+*option* argument to the most recent ``setup`` .
+It is the number of argument points in each call to *batch* .
+
+vector_type
+***********
+The type of the vectors *x* and *g* is
+
+| |tab| ``typedef cmpad::vector<double>`` *Batch* :: ``vector_type``
+
+scalar_type
+***********
+The type of the elements of *x* and *g* is
+
+| |tab| ``typedef double`` *Batch* :: ``scalar_type``
+
+domain
+******
+This returns the dimension of the
+:ref:`cpp_fun_obj@domain` space for the batch which is
+*n_batch* times the dimension of the domain space for the algorithm.
+We use *n* to denote the dimension of the domain space for the algorithm.
+
+range
+*****
+The dimension of the range space for the batch is equal
+to the dimension of its domain space.
+Hence ``range`` is implemented by this interface and not virtual.
+
+x
+*
+This vector has size *n_batch* * *n* and is in row major order; i.e.,
+for *k* less than *n_batch* , and *j* less than *n* ,
+*x* [ *k* * *n* + *j* ] is component *j* of the *k*-th argument point.
+
+g
+*
+This result has size *n_batch* * *n* and is in row major order; i.e.,
+*g* [ *k* * *n* + *j* ] is the partial derivative,
+with respect to component *j* , at the *k*-th argument point.
+
+Example and Derived Classes
+***************************
+{xrst_toc_table
+   cpp/include/cmpad/batch_loop.hpp
+   cpp/include/cmpad/batch_thread.hpp
+}
+
+{xrst_end cpp_batch_gradient}
+-------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad {
+   // batch_gradient
+   class batch_gradient : public fun_obj< cmpad::vector<double> > {
+   public:
+      // scalar_type
+      typedef double scalar_type;
+      // setup
+      virtual void setup(const option_t& option) override = 0;
+      // option
+      virtual const option_t& option(void) const override = 0;
+      // domain
+      virtual size_t domain(void) const override  = 0;
+      // range
+      size_t range(void) const override
+      {  return domain(); }
+      // operator
+      virtual const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override = 0;
+   };
+
+}
+// END C++
+# endif
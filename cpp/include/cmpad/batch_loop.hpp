@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_BATCH_LOOP_HPP
+# define CMPAD_BATCH_LOOP_HPP
+/*
+{xrst_begin_parent cpp_batch_loop}
+
+Batch Gradient Using One Gradient Object
+########################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/batch_loop.hpp>``
+| |tab| ``cmpad::batch_loop`` < *Gradient* , *Algo* > *batch*
+| |tab| *batch* ``.setup`` ( *option* )
+| |tab| *g* = *batch* ( *x* )
+
+Purpose
+*******
+This implements the :ref:`cpp_batch_gradient-name` interface
+using a package :ref:`cpp_gradient-name` .
+The package records the algorithm once, during ``setup`` ,
+and each call to *batch* reuses that recording for all the points
+in the batch (without returning to the caller between points).
+
+Gradient
+********
+This is a :ref:`cpp_gradient-name` class template for a particular
+package; e.g., ``cmpad::cppad::gradient`` .
+Hence this works with every package that implements the gradient interface.
+
+Algo
+****
+This is the algorithm that the gradients are computed for;
+see :ref:`cpp_gradient@Algo` .
+
+option
+******
+The fields *n_arg* , *n_other* , and *time_setup* have the same
+meaning as for the *Algo* .
+The field :ref:`option_t@n_batch` is the number of points in each batch.
+
+x, g
+****
+see :ref:`cpp_batch_gradient@x` and :ref:`cpp_batch_gradient@g` .
+
+{xrst_toc_hidden after
+   cpp/xam/batch_loop.cpp
+}
+Example
+*******
+:ref:`xam_batch_loop.cpp-name` is an example and test of this class.
+
+Source Code
+***********
+:ref:`batch_loop.hpp-name` displays the source code for this class.
+
+{xrst_end cpp_batch_loop}
+------------------------------------------------------------------------------
+{xrst_begin batch_loop.hpp}
+
+batch_loop: Source Code
+#######################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end batch_loop.hpp}
+*/
+// BEGIN C++
+# include <cassert>
+# include <cmpad/batch_gradient.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// batch_loop
+template <
+   template< template<class ADVector> class Algo > class Gradient ,
+   template<class ADVector> class Algo
+>
+class batch_loop : public batch_gradient {
+private:
+   //
+   // option_
+   option_t                option_;
+   //
+   // grad_
+   Gradient<Algo>          grad_;
+   //
+   // x_
+   // one argument point
+   cmpad::vector<double>   x_;
+   //
+   // g_
+   // all the gradients in the batch
+   cmpad::vector<double>   g_;
+   //
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_batch * grad_.domain(); }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // n_batch
+      assert( option.n_batch > 0 );
+      //
+      // option_
+      option_ = option;
+      //
+      // grad_
+      grad_.setup(option);
+      //
+      // x_, g_
+      size_t n = grad_.domain();
+      x_.resize(n);
+      g_.resize(option.n_batch * n);
+   }
+   //
+   // operator
+   const vector_type& operator()(const vector_type& x) override
+   {  //
+      // n
+      size_t n = grad_.domain();
+      assert( x.size() == option_.n_batch * n );
+      //
+      // g_
+      for(size_t k = 0; k < option_.n_batch; ++k)
+      {  for(size_t j = 0; j < n; ++j)
+            x_[j] = x[k * n + j];
+         const vector_type& g_k = grad_(x_);
+         for(size_t j = 0; j < n; ++j)
+            g_[k * n + j] = g_k[j];
+      }
+      return g_;
+   }
+};
+
+} // END cmpad namespace
+// END C++
+# endif
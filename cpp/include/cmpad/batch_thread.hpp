@@ -0,0 +1,479 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_BATCH_THREAD_HPP
+# define CMPAD_BATCH_THREAD_HPP
+/*
+{xrst_begin_parent cpp_batch_thread}
+
+Parallel Batch Gradient Using a Thread Pool
+###########################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/batch_thread.hpp>``
+| |tab| ``cmpad::batch_thread`` < *Gradient* , *Algo* > *batch*
+| |tab| *batch* ``.setup`` ( *option* )
+| |tab| *g* = *batch* ( *x* )
+| |tab| *n_point* = *batch* ``.n_point`` ( *t* )
+| |tab| *num* = ``cmpad::thread_num`` ()
+| |tab| *flag* = ``cmpad::in_parallel`` ()
+
+Purpose
+*******
+This implements the :ref:`cpp_batch_gradient-name` interface
+by evaluating the points in the batch in parallel.
+
+Gradient
+********
+This is a :ref:`cpp_gradient-name` class template for a particular
+package; e.g., ``cmpad::cppad::gradient`` .
+The objects of this type used by different threads must not share
+any state during an evaluation; see :ref:`run_cmpad@n_thread` for the
+packages that satisfy this condition
+(and why the adolc and codi packages are not supported).
+
+Algo
+****
+This is the algorithm that the gradients are computed for;
+see :ref:`cpp_gradient@Algo` .
+
+option
+******
+The fields *n_arg* , *n_other* , and *time_setup* have the same
+meaning as for the *Algo* .
+The field :ref:`option_t@n_batch` is the number of points in each batch.
+
+n_thread
+========
+The field :ref:`option_t@n_thread` is the number of worker threads.
+The worker threads are created by the first ``setup`` and are reused
+until the *batch* object is destroyed, or until a ``setup``
+with a different *n_thread* .
+
+Thread Pool
+***********
+Each worker thread owns its own *Gradient* object;
+i.e., its own evaluation context.
+It is constructed, setup, and destroyed, in the worker thread
+(so that packages that keep their tape in thread local storage work).
+The evaluations of the gradients are done at the same time
+by the worker threads.
+
+setup_copy
+==========
+If the *Gradient* class has a member function with the syntax
+
+| |tab| *copy* ``.setup_copy`` ( *grad* )
+
+the *batch* ``setup`` calls *grad* ``.setup`` once, in the thread
+that calls *batch* ``.setup`` , and each worker thread calls
+*copy* ``.setup_copy`` ( *grad* ) for its *Gradient* object.
+Hence the algorithm is only recorded (and compiled) once for each *batch*
+setup; e.g., see :ref:`cppad_gradient.hpp@setup_copy` ,
+:ref:`cppad_jit_gradient.hpp@setup_copy` , and
+:ref:`cppadcg_gradient.hpp@setup_copy` .
+The ``setup_copy`` calls, and the destruction of the copies,
+are done one thread at a time.
+
+Otherwise, the worker threads call the *Gradient* ``setup``
+at the same time.
+Hence the *Gradient* ``setup`` must not use global state.
+
+Work Stealing
+*************
+At the start of each evaluation, the points in the batch are divided
+into *n_thread* contiguous blocks and block *t* is placed in
+the work queue for thread *t* .
+A thread takes points from the front of its own queue.
+When its queue is empty, it steals the back half of the
+queue for another thread.
+An evaluation is complete when all the queues are empty.
+
+n_point
+*******
+For *t* less than *n_thread* , *n_point* is the number of points
+that thread *t* evaluated during the previous evaluation of *g* .
+The sum of *n_point* , with respect to *t* , is *n_batch* .
+
+thread_num
+**********
+The ``size_t`` value *num* is zero for the thread that is not
+a worker thread and *t* + 1 for worker thread *t* .
+This is unique, for each thread, if at most one *batch* object
+exists at a time.
+
+in_parallel
+***********
+The ``bool`` value *flag* is true if there is a *batch* object that
+has worker threads.
+The functions ``thread_num`` and ``in_parallel`` can be used to
+inform a package about the threading; e.g.,
+see :ref:`cppad_parallel_setup.hpp-name` .
+
+x, g
+****
+see :ref:`cpp_batch_gradient@x` and :ref:`cpp_batch_gradient@g` .
+
+{xrst_toc_hidden after
+   cpp/xam/batch_thread.cpp
+}
+Example
+*******
+:ref:`xam_batch_thread.cpp-name` is an example and test of this class.
+
+Source Code
+***********
+:ref:`batch_thread.hpp-name` displays the source code for this class.
+
+{xrst_end cpp_batch_thread}
+------------------------------------------------------------------------------
+{xrst_begin batch_thread.hpp}
+
+batch_thread: Source Code
+#########################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end batch_thread.hpp}
+*/
+// BEGIN C++
+# include <cassert>
+# include <atomic>
+# include <condition_variable>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <type_traits>
+# include <utility>
+# include <vector>
+# include <cmpad/batch_gradient.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// thread_num_reference
+inline size_t& thread_num_reference(void)
+{  thread_local size_t num = 0;
+   return num;
+}
+//
+// n_worker_reference
+inline std::atomic<size_t>& n_worker_reference(void)
+{  static std::atomic<size_t> n_worker(0);
+   return n_worker;
+}
+//
+// thread_num
+inline size_t thread_num(void)
+{  return thread_num_reference(); }
+//
+// in_parallel
+inline bool in_parallel(void)
+{  return n_worker_reference() > 0; }
+
+// has_setup_copy
+// value is true if Gradient has a setup_copy member function
+template <class Gradient, class = void>
+struct has_setup_copy : std::false_type { };
+template <class Gradient>
+struct has_setup_copy< Gradient, std::void_t< decltype(
+   std::declval<Gradient&>().setup_copy( std::declval<const Gradient&>() )
+) > > : std::true_type { };
+
+// batch_thread
+template <
+   template< template<class ADVector> class Algo > class Gradient ,
+   template<class ADVector> class Algo
+>
+class batch_thread : public batch_gradient {
+private:
+   //
+   // job_t
+   enum job_t { setup_job, eval_job, exit_job };
+   //
+   // copy_
+   // is the gradient for each worker a copy of grad_main_
+   static constexpr bool copy_ = has_setup_copy< Gradient<Algo> >::value;
+   //
+   // queue_t
+   // the points from begin to end - 1 are waiting to be evaluated
+   struct queue_t {
+      std::mutex mutex;
+      size_t     begin;
+      size_t     end;
+   };
+   //
+   // option_
+   option_t                                      option_;
+   //
+   // n_
+   // dimension of the domain space for the algorithm
+   size_t                                        n_;
+   //
+   // worker_
+   std::vector<std::thread>                      worker_;
+   //
+   // grad_main_
+   // if copy_ is true, the gradient that is setup by this thread
+   std::unique_ptr< Gradient<Algo> >                grad_main_;
+   //
+   // grad_
+   // grad_[t] is only used by worker thread t
+   std::vector< std::unique_ptr< Gradient<Algo> > > grad_;
+   //
+   // copy_mutex_
+   // if copy_ is true, the copies are setup and destroyed one at a time
+   std::mutex                                    copy_mutex_;
+   //
+   // x_t_
+   // x_t_[t] is one argument point for worker thread t
+   std::vector< cmpad::vector<double> >          x_t_;
+   //
+   // queue_
+   std::vector< std::unique_ptr<queue_t> >       queue_;
+   //
+   // n_point_
+   std::vector<size_t>                           n_point_;
+   //
+   // job_mutex_, job_cv_, done_cv_, job_, job_id_, n_done_
+   std::mutex                                    job_mutex_;
+   std::condition_variable                       job_cv_;
+   std::condition_variable                       done_cv_;
+   job_t                                         job_;
+   size_t                                        job_id_;
+   size_t                                        n_done_;
+   //
+   // x_ptr_
+   const double*                                 x_ptr_;
+   //
+   // g_
+   cmpad::vector<double>                         g_;
+   //
+   // run_job
+   // run a job in all the worker threads and wait for it to complete
+   void run_job(job_t job)
+   {  {  std::lock_guard<std::mutex> lock(job_mutex_);
+         job_    = job;
+         n_done_ = 0;
+         ++job_id_;
+      }
+      job_cv_.notify_all();
+      std::unique_lock<std::mutex> lock(job_mutex_);
+      done_cv_.wait(lock, [this]{ return n_done_ == worker_.size(); });
+   }
+   //
+   // start_pool
+   void start_pool(size_t n_thread)
+   {  assert( worker_.size() == 0 );
+      grad_.resize(n_thread);
+      x_t_.resize(n_thread);
+      n_point_.resize(n_thread);
+      queue_.resize(n_thread);
+      for(size_t t = 0; t < n_thread; ++t)
+         queue_[t].reset( new queue_t );
+      n_worker_reference() += n_thread;
+      for(size_t t = 0; t < n_thread; ++t)
+         worker_.emplace_back( &batch_thread::work, this, t, job_id_ );
+   }
+   //
+   // stop_pool
+   void stop_pool(void)
+   {  if( worker_.size() == 0 )
+         return;
+      run_job(exit_job);
+      for(size_t t = 0; t < worker_.size(); ++t)
+         worker_[t].join();
+      n_worker_reference() -= worker_.size();
+      worker_.clear();
+   }
+   //
+   // pop
+   // take the next point from the front of queue t
+   bool pop(size_t t, size_t& k)
+   {  std::lock_guard<std::mutex> lock(queue_[t]->mutex);
+      if( queue_[t]->begin == queue_[t]->end )
+         return false;
+      k = queue_[t]->begin++;
+      return true;
+   }
+   //
+   // steal
+   // move the back half of another queue to queue t and pop a point from it
+   bool steal(size_t t, size_t& k)
+   {  size_t n_thread = worker_.size();
+      for(size_t i = 1; i < n_thread; ++i)
+      {  size_t v = (t + i) % n_thread;
+         size_t begin, end;
+         {  std::lock_guard<std::mutex> lock(queue_[v]->mutex);
+            size_t n_left = queue_[v]->end - queue_[v]->begin;
+            if( n_left == 0 )
+               continue;
+            end   = queue_[v]->end;
+            begin = end - (n_left + 1) / 2;
+            queue_[v]->end = begin;
+         }
+         std::lock_guard<std::mutex> lock(queue_[t]->mutex);
+         queue_[t]->begin = begin + 1;
+         queue_[t]->end   = end;
+         k                = begin;
+         return true;
+      }
+      return false;
+   }
+   //
+   // evaluate
+   // evaluate points using worker thread t until all the queues are empty
+   void evaluate(size_t t)
+   {  n_point_[t] = 0;
+      size_t k;
+      while( pop(t, k) || steal(t, k) )
+      {  cmpad::vector<double>& x_t = x_t_[t];
+         for(size_t j = 0; j < n_; ++j)
+            x_t[j] = x_ptr_[k * n_ + j];
+         const cmpad::vector<double>& g_k = (*grad_[t])(x_t);
+         for(size_t j = 0; j < n_; ++j)
+            g_[k * n_ + j] = g_k[j];
+         ++n_point_[t];
+      }
+   }
+   //
+   // work
+   // the function executed by worker thread t,
+   // job_id is the identifier for the last job before this thread started
+   void work(size_t t, size_t job_id)
+   {  thread_num_reference() = t + 1;
+      while( true )
+      {  //
+         // job
+         job_t job;
+         {  std::unique_lock<std::mutex> lock(job_mutex_);
+            job_cv_.wait(lock, [this, job_id]{ return job_id_ != job_id; });
+            job_id = job_id_;
+            job    = job_;
+         }
+         if( job == setup_job )
+         {  if constexpr( copy_ )
+            {  std::lock_guard<std::mutex> lock(copy_mutex_);
+               if( grad_[t] == nullptr )
+                  grad_[t].reset( new Gradient<Algo> );
+               grad_[t]->setup_copy(*grad_main_);
+            }
+            else
+            {  if( grad_[t] == nullptr )
+                  grad_[t].reset( new Gradient<Algo> );
+               grad_[t]->setup(option_);
+            }
+            x_t_[t].resize( grad_[t]->domain() );
+         }
+         else if( job == eval_job )
+            evaluate(t);
+         else
+         {  // the gradient is destroyed by the thread that created it
+            assert( job == exit_job );
+            std::unique_lock<std::mutex> lock(copy_mutex_, std::defer_lock);
+            if( copy_ )
+               lock.lock();
+            grad_[t].reset();
+         }
+         //
+         // n_done_
+         {  std::lock_guard<std::mutex> lock(job_mutex_);
+            ++n_done_;
+         }
+         done_cv_.notify_one();
+         //
+         if( job == exit_job )
+            return;
+      }
+   }
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // ctor
+   batch_thread(void) : n_(0), job_(setup_job), job_id_(0), n_done_(0)
+   { }
+   //
+   // dtor
+   ~batch_thread(void)
+   {  stop_pool(); }
+   //
+   // a batch_thread cannot be copied
+   batch_thread(const batch_thread&)            = delete;
+   batch_thread& operator=(const batch_thread&) = delete;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_batch * n_; }
+   //
+   // n_point
+   size_t n_point(size_t t) const
+   {  return n_point_[t]; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // n_batch, n_thread
+      assert( option.n_batch > 0 );
+      assert( option.n_thread > 0 );
+      //
+      // worker_
+      if( worker_.size() != option.n_thread )
+      {  stop_pool();
+         start_pool(option.n_thread);
+      }
+      //
+      // option_
+      option_ = option;
+      //
+      // grad_main_
+      if constexpr( copy_ )
+      {  if( grad_main_ == nullptr )
+            grad_main_.reset( new Gradient<Algo> );
+         grad_main_->setup(option);
+      }
+      //
+      // grad_
+      run_job(setup_job);
+      //
+      // n_, g_
+      n_ = grad_[0]->domain();
+      g_.resize(option.n_batch * n_);
+   }
+   //
+   // operator
+   const vector_type& operator()(const vector_type& x) override
+   {  //
+      // n_thread, n_batch
+      size_t n_thread = worker_.size();
+      size_t n_batch  = option_.n_batch;
+      assert( x.size() == n_batch * n_ );
+      //
+      // queue_
+      for(size_t t = 0; t < n_thread; ++t)
+      {  queue_[t]->begin = (t * n_batch) / n_thread;
+         queue_[t]->end   = ((t + 1) * n_batch) / n_thread;
+      }
+      //
+      // g_
+      x_ptr_ = x.data();
+      run_job(eval_job);
+      //
+      return g_;
+   }
+};
+
+} // END cmpad namespace
+// END C++
+# endif
@@ -0,0 +1,463 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CHECKPOINT_GRADIENT_HPP
+# define CMPAD_CHECKPOINT_GRADIENT_HPP
+/*
+{xrst_begin_parent cpp_checkpoint_gradient}
+{xrst_spell
+   checkpointed
+   kutta
+   revolve
+   runge
+}
+
+Checkpointed Gradient of a Time Stepping Algorithm
+##################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/checkpoint_gradient.hpp>``
+| |tab| ``cmpad::checkpoint_gradient`` < *Gradient* > *grad*
+| |tab| ``cmpad::checkpoint_gradient`` < *Gradient* , *Step* > *grad*
+| |tab| *grad* ``.setup`` ( *option* )
+| |tab| *g* = *grad* ( *x* )
+| |tab| *n_step* = *grad* ``.n_forward_step`` ()
+
+Purpose
+*******
+The :ref:`cpp_gradient-name` for :ref:`an_ode-name` records all the stages
+of all the Runge-Kutta steps.
+Hence, the memory used by a taping package grows linearly with the
+number of steps *n_other* .
+This gradient has the same result, but only records one step at a time
+and stores the ODE solution at a limited number of step boundaries
+(checkpoints).
+The steps between checkpoints are recomputed, as needed,
+during the reverse sweep.
+Other time stepping algorithms can use the same checkpointing by
+specifying their one step algorithm using the *Step* template parameter.
+
+Gradient
+********
+This is a :ref:`cpp_gradient-name` class template for a particular
+package; e.g., ``cmpad::cppad::gradient`` .
+It is used to compute the derivative of the *Step* algorithm.
+Hence this works with every package that implements the gradient interface.
+
+Step
+****
+This is a class template with the interface ``template <class`` *Vector*
+``> class`` *Step* that computes one step of the algorithm.
+If it is not present, :ref:`cpp_checkpoint_gradient@an_ode_step` is used.
+We use *n* for the *n_arg* in the *option* for *grad* .
+The following conditions must hold for *step* , an object of type
+*Step* < *Vector* > , where *Vector* is ``cmpad::vector<double>`` or
+an AD vector type used by *Gradient* :
+
+#. It is a :ref:`cpp_fun_obj-name` and *step* ``.setup`` is called
+   with the *option* for *grad* except that *n_arg* is 3 *n* .
+   The number of steps is *n_other* .
+#. Its domain is :math:`( y , x , u )` where each of these vectors has
+   size *n* , *y* is the state at the start of a step,
+   *x* is the argument for *grad* , and *u* is a weight vector.
+#. Its range has size *n* + 1 . The first *n* components are
+   the state at the end of the step, starting at *y* .
+   The last component is the inner product of *u* with the first *n*
+   components.
+#. The state before the first step is zero and *grad* computes the gradient,
+   with respect to *x* , of the last component of the state after
+   *n_other* steps.
+
+option
+******
+The fields *n_arg* , *n_other* , and *time_setup* have the same
+meaning as for :ref:`an_ode <an_ode@option>` .
+
+n_checkpoint
+============
+This is the number of ODE solution values,
+in addition to the initial value,
+that can be stored at one time during the reverse sweep.
+If *n_checkpoint* is zero, every step is recomputed starting at the
+initial value.
+If *n_checkpoint* is greater than or equal *n_other* minus one,
+the forward sweep stores the solution at every step boundary
+and no steps are recomputed.
+
+Schedule
+********
+We use :math:`\beta(s, r) = ( s + r ) ! / ( s ! r ! )` to denote the
+maximum number of steps that can be reversed using *s* stored solutions,
+including the solution at the first step,
+where each step is recomputed at most *r* times.
+To reverse the steps from *a* to *b* , with *c* free checkpoints,
+*r* is chosen as small as possible with
+:math:`b - a \leq \beta(c + 1, r)` .
+A checkpoint is placed at step
+:math:`m = b - \min[ \beta(c, r) , b - a - 1 ]` ,
+the steps from *m* to *b* are reversed using :math:`c-1` free checkpoints,
+and then the steps from *a* to *m* are reversed using *c* free checkpoints.
+This is the binomial (revolve) schedule which minimizes the
+number of recomputed steps for a given *n_checkpoint* .
+
+Memory Versus Recompute
+***********************
+The memory used for the derivative is
+*n_checkpoint* + 1 vectors of size *n_arg* plus the memory used by
+*Gradient* for one step (which does not depend on *n_other* ).
+The cost of the derivative is the cost of the *n_other* step derivatives
+plus the cost of *n_step* evaluations of a step using ``double``.
+The :ref:`csv_column@n_checkpoint` column in the :ref:`csv_column-name` file
+can be used to compare the rates for different numbers of checkpoints
+and packages.
+
+n_forward_step
+**************
+This is the number of ``double`` step evaluations, during the
+previous evaluation of *g* ; i.e., the recompute cost.
+It is *n_other* minus one if *n_checkpoint* is greater than or equal
+*n_other* minus one.
+It is *n_other* ( *n_other* - 1 ) / 2 if *n_checkpoint* is zero.
+
+an_ode_step
+***********
+The algorithm ``cmpad::an_ode_step`` < *Vector* > is used
+(with the ``double`` and the package scalar types)
+to compute one Runge-Kutta step for :ref:`an_ode-name` .
+Its domain is :math:`( y , x , u )` where each of these vectors has
+the an_ode size *n_arg* ; i.e., the an_ode_step *n_arg* is
+three times the an_ode *n_arg* .
+The first *n_arg* components of its range are the
+value of *y* after one step of size 2 / *n_other* starting at *y* .
+The last component of its range is the inner product of *u*
+with the first *n_arg* components.
+It follows that the gradient of the last component,
+with respect to *y* and *x* ,
+is the derivative of a step multiplied by *u* on the left.
+
+{xrst_toc_hidden after
+   cpp/xam/checkpoint_gradient.cpp
+}
+Example
+*******
+:ref:`xam_checkpoint_gradient.cpp-name` is an example and test of this class.
+
+Source Code
+***********
+:ref:`checkpoint_gradient.hpp-name` displays the source code for this class.
+
+{xrst_end cpp_checkpoint_gradient}
+------------------------------------------------------------------------------
+{xrst_begin checkpoint_gradient.hpp}
+
+checkpoint_gradient: Source Code
+################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end checkpoint_gradient.hpp}
+*/
+// BEGIN C++
+# include <cassert>
+# include <cmpad/gradient.hpp>
+# include <cmpad/algo/an_ode.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// an_ode_step
+template <class Vector> class an_ode_step : public fun_obj<Vector>
+{
+private:
+   // option_
+   option_t option_;
+   //
+   // y_, x_, yf_, z_
+   Vector y_, x_, yf_, z_;
+   //
+   // fun_
+   an_ode_fun_vec<Vector> fun_;
+   //
+   // work_
+   runge_kutta_work<Vector> work_;
+public:
+   // scalar type
+   typedef typename Vector::value_type scalar_type;
+   //
+   // vector_type
+   typedef Vector vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_arg; }
+   //
+   // range
+   size_t range(void) const override
+   {  return option_.n_arg / 3 + 1; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // n_arg, n_other
+      assert( option.n_arg > 0 && option.n_arg % 3 == 0 );
+      assert( option.n_other > 0 );
+      //
+      // option_
+      option_ = option;
+      //
+      // y_, x_, yf_, z_, work_
+      size_t n = option.n_arg / 3;
+      y_.resize(n);
+      x_.resize(n);
+      yf_.resize(n);
+      z_.resize(n + 1);
+      work_.resize(n);
+   }
+   //
+   // operator
+   const Vector& operator()(const Vector& yxu) override
+   {  //
+      // n
+      assert( yxu.size() == domain() );
+      size_t n = option_.n_arg / 3;
+      //
+      // y_, x_, fun_
+      for(size_t i = 0; i < n; ++i)
+      {  y_[i] = yxu[i];
+         x_[i] = yxu[n + i];
+      }
+      fun_.set_x(x_);
+      //
+      // yf_
+      scalar_type h = scalar_type( 2.0 / double( option_.n_other ) );
+      cmpad::runge_kutta(fun_, y_, h, 1, yf_, work_);
+      //
+      // z_
+      scalar_type sum = scalar_type(0.0);
+      for(size_t i = 0; i < n; ++i)
+      {  z_[i] = yf_[i];
+         sum   = sum + yxu[2 * n + i] * yf_[i];
+      }
+      z_[n] = sum;
+      //
+      return z_;
+   }
+};
+
+// checkpoint_gradient
+template <
+   template< template<class ADVector> class Algo > class Gradient ,
+   template<class Vector> class Step = an_ode_step
+>
+class checkpoint_gradient : public ::cmpad::gradient
+{
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef ::cmpad::vector<scalar_type> vector_type;
+   //
+private:
+   // option_
+   option_t option_;
+   //
+   // step_
+   // double version of one step
+   Step<vector_type> step_;
+   //
+   // step_grad_
+   // derivative of one step
+   Gradient<Step> step_grad_;
+   //
+   // yxu_
+   // argument for step_ and step_grad_
+   vector_type yxu_;
+   //
+   // ckpt_
+   // ckpt_[level] is the solution at a step boundary
+   ::cmpad::vector<vector_type> ckpt_;
+   //
+   // y_
+   vector_type y_;
+   //
+   // u_
+   // derivative of the last component of the solution w.r.t. y at a step
+   vector_type u_;
+   //
+   // g_
+   vector_type g_;
+   //
+   // n_forward_step_
+   size_t n_forward_step_;
+   //
+   // binomial
+   // (s + r)! / ( s! r! ) , or max_t if it is greater than max_t.
+   static size_t binomial(size_t s, size_t r, size_t max_t)
+   {  double result = 1.0;
+      for(size_t k = 1; k <= s; ++k)
+      {  result = result * double(r + k) / double(k);
+         if( double(max_t) < result )
+            return max_t;
+      }
+      return size_t(result + 0.5);
+   }
+   //
+   // forward
+   // yb = solution at step b given ya = solution at step a
+   void forward(
+      size_t a, size_t b, const vector_type& ya, vector_type& yb
+   )
+   {  size_t n = option_.n_arg;
+      for(size_t i = 0; i < n; ++i)
+         yxu_[i] = ya[i];
+      for(size_t k = a; k < b; ++k)
+      {  const vector_type& z = step_(yxu_);
+         for(size_t i = 0; i < n; ++i)
+            yxu_[i] = z[i];
+      }
+      for(size_t i = 0; i < n; ++i)
+         yb[i] = yxu_[i];
+      n_forward_step_ += b - a;
+   }
+   //
+   // reverse_step
+   // update u_ and g_ for the step that starts with y
+   void reverse_step(const vector_type& y)
+   {  size_t n = option_.n_arg;
+      for(size_t i = 0; i < n; ++i)
+      {  yxu_[i]         = y[i];
+         yxu_[2 * n + i] = u_[i];
+      }
+      const vector_type& gs = step_grad_(yxu_);
+      for(size_t i = 0; i < n; ++i)
+      {  u_[i]  = gs[i];
+         g_[i] += gs[n + i];
+      }
+   }
+   //
+   // reverse
+   // reverse steps a through b-1 given ckpt_[level] is the solution at a
+   void reverse(size_t a, size_t b, size_t level)
+   {  //
+      // c
+      // number of free checkpoints
+      size_t c = option_.n_checkpoint - level;
+      //
+      // b
+      while( b - a > 1 && c > 0 )
+      {  //
+         // r
+         size_t t = b - a;
+         size_t r = 1;
+         while( binomial(c + 1, r, t) < t )
+            ++r;
+         //
+         // m
+         size_t right = binomial(c, r, t - 1);
+         size_t m     = b - right;
+         //
+         // ckpt_[level+1]
+         forward(a, m, ckpt_[level], ckpt_[level+1]);
+         //
+         // reverse steps m through b-1
+         reverse(m, b, level + 1);
+         //
+         b = m;
+      }
+      //
+      // no free checkpoints, recompute from ckpt_[level] for each step
+      for(size_t k = b; k > a; --k)
+      {  if( k - 1 == a )
+            reverse_step( ckpt_[level] );
+         else
+         {  forward(a, k - 1, ckpt_[level], y_);
+            reverse_step(y_);
+         }
+      }
+   }
+public:
+   // n_forward_step
+   size_t n_forward_step(void) const
+   {  return n_forward_step_; }
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // domain
+   size_t domain(void) const override
+   {  return option_.n_arg; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // n_arg, n_other
+      assert( option.n_arg > 0 );
+      assert( option.n_other > 0 );
+      //
+      // option_
+      option_ = option;
+      //
+      // n_checkpoint
+      // more than n_other - 1 checkpoints would not be used
+      if( option_.n_checkpoint >= option.n_other )
+         option_.n_checkpoint = option.n_other - 1;
+      //
+      // step_, step_grad_
+      option_t step_option = option;
+      step_option.n_arg    = 3 * option.n_arg;
+      step_.setup(step_option);
+      step_grad_.setup(step_option);
+      //
+      // yxu_, ckpt_, y_, u_, g_
+      size_t n = option.n_arg;
+      yxu_.resize(3 * n);
+      ckpt_.resize(option_.n_checkpoint + 1);
+      for(size_t level = 0; level < ckpt_.size(); ++level)
+         ckpt_[level].resize(n);
+      y_.resize(n);
+      u_.resize(n);
+      g_.resize(n);
+      //
+      // n_forward_step_
+      n_forward_step_ = 0;
+   }
+   //
+   // operator
+   const vector_type& operator()(const vector_type& x) override
+   {  //
+      // n, ns
+      size_t n  = option_.n_arg;
+      size_t ns = option_.n_other;
+      assert( x.size() == n );
+      //
+      // yxu_, ckpt_[0], u_, g_
+      for(size_t i = 0; i < n; ++i)
+      {  yxu_[n + i] = x[i];
+         ckpt_[0][i] = 0.0;
+         u_[i]       = 0.0;
+         g_[i]       = 0.0;
+      }
+      u_[n-1] = 1.0;
+      //
+      // g_
+      n_forward_step_ = 0;
+      reverse(0, ns, 0);
+      //
+      return g_;
+   }
+};
+
+}  // END cmpad namespace
+
+// END C++
+# endif
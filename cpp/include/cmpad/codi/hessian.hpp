@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CODI_HESSIAN_HPP
+# define CMPAD_CODI_HESSIAN_HPP
+/*
+{xrst_begin codi_hessian.hpp}
+{xrst_spell
+   Co
+   Di
+}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian.xrst
+   @Package@       , CoDiPack
+   @#######@       , ########
+   @package@       , codi
+}
+
+Method
+******
+The Hessian is computed using forward-over-reverse; i.e.,
+the CoDiPack reverse mode type with ``codi::RealForward`` as its
+base type.
+For each component of *x* , the function is taped with the
+forward direction equal to the corresponding unit vector
+and then a reverse sweep computes the corresponding row of the Hessian.
+
+{xrst_end codi_hessian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CODI
+
+# include <codi.hpp>
+# include <cmpad/hessian.hpp>
+
+namespace cmpad { namespace codi { // BEGIN cmpad::codi namespace
+
+// cmpad::codi::hessian
+template < template<class ADVector> class Algo > class hessian
+: public
+cmpad::hessian {
+private:
+   //
+   // ADScalar, ADVector
+   typedef ::codi::RealReverseGen< ::codi::RealForward > ADScalar;
+   typedef cmpad::vector<ADScalar>                       ADVector;
+   //
+   // option_
+   option_t                        option_;
+   //
+   // algo_
+   Algo<ADVector>                  algo_;
+   //
+   // tape_
+   ADScalar::Tape&                 tape_;
+   //
+   // ax_, ay_, az_
+   ADVector                        ax_;
+   ADVector                        ay_;
+   ADScalar                        az_;
+   //
+   // h_
+   cmpad::vector<double>           h_;
+//
+public:
+   hessian(void)
+   : tape_ ( ADScalar::getTape() )
+   { }
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // ax_
+      ax_.resize(n);
+      //
+      // ay_
+      ay_.resize(m);
+      //
+      // h_
+      h_.resize(n * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  assert( x.size() == algo_.domain() );
+      //
+      // n, m
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      //
+      // k
+      // forward mode direction is the k-th unit vector
+      for(size_t k = 0; k < n; ++k)
+      {  //
+         // ax_
+         // independent variable values
+         for(size_t j = 0; j < n; ++j)
+            ax_[j] = x[j];
+         ax_[k].value().gradient() = 1.0;
+         //
+         // tape_
+         tape_.setActive();
+         for(size_t j = 0; j < n; ++j)
+            tape_.registerInput( ax_[j] );
+         //
+         // az_
+         // dependent variable
+         ay_ = algo_(ax_);
+         az_ = ay_[m-1];
+         //
+         // tape_
+         tape_.registerOutput(az_);
+         tape_.setPassive();
+         //
+         // tape_, az_, ax_
+         az_.gradient().value() = 1.0;
+         tape_.evaluate();
+         //
+         // h_
+         for(size_t j = 0; j < n; ++j)
+            h_[k * n + j] = ax_[j].getGradient().getGradient();
+         //
+         // clean tape and adjoints
+         tape_.reset();
+      }
+      //
+      return h_;
+   }
+};
+
+} } // END cmpad::codi namespace
+
+# endif // CMPAD_HAS_CODI
+// END C++
+# endif
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CODI_HESSIAN_VECTOR_HPP
+# define CMPAD_CODI_HESSIAN_VECTOR_HPP
+/*
+{xrst_begin codi_hessian_vector.hpp}
+{xrst_spell
+   Co
+   Di
+}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian_vector.xrst
+   @Package@       , CoDiPack
+   @#######@       , ########
+   @package@       , codi
+}
+
+Method
+******
+The Hessian times a vector is computed using forward-over-reverse; i.e.,
+the CoDiPack reverse mode type with ``codi::RealForward`` as its
+base type.
+The function is taped with the forward direction equal to *v*
+and then a reverse sweep computes the Hessian times *v* .
+
+{xrst_end codi_hessian_vector.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CODI
+
+# include <codi.hpp>
+# include <cmpad/hessian_vector.hpp>
+
+namespace cmpad { namespace codi { // BEGIN cmpad::codi namespace
+
+// cmpad::codi::hessian_vector
+template < template<class ADVector> class Algo > class hessian_vector
+: public
+cmpad::hessian_vector {
+private:
+   //
+   // ADScalar, ADVector
+   typedef ::codi::RealReverseGen< ::codi::RealForward > ADScalar;
+   typedef cmpad::vector<ADScalar>                       ADVector;
+   //
+   // option_
+   option_t                        option_;
+   //
+   // algo_
+   Algo<ADVector>                  algo_;
+   //
+   // tape_
+   ADScalar::Tape&                 tape_;
+   //
+   // ax_, ay_, az_
+   ADVector                        ax_;
+   ADVector                        ay_;
+   ADScalar                        az_;
+   //
+   // hv_
+   cmpad::vector<double>           hv_;
+//
+public:
+   hessian_vector(void)
+   : tape_ ( ADScalar::getTape() )
+   { }
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // ax_
+      ax_.resize(n);
+      //
+      // ay_
+      ay_.resize(m);
+      //
+      // hv_
+      hv_.resize(n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return 2 * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  //
+      // n, m
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      assert( xv.size() == 2 * n );
+      //
+      // ax_
+      // independent variable values and forward direction
+      for(size_t j = 0; j < n; ++j)
+      {  ax_[j] = xv[j];
+         ax_[j].value().gradient() = xv[n + j];
+      }
+      //
+      // tape_
+      tape_.setActive();
+      for(size_t j = 0; j < n; ++j)
+         tape_.registerInput( ax_[j] );
+      //
+      // az_
+      // dependent variable
+      ay_ = algo_(ax_);
+      az_ = ay_[m-1];
+      //
+      // tape_
+      tape_.registerOutput(az_);
+      tape_.setPassive();
+      //
+      // tape_, az_, ax_
+      az_.gradient().value() = 1.0;
+      tape_.evaluate();
+      //
+      // hv_
+      for(size_t j = 0; j < n; ++j)
+         hv_[j] = ax_[j].getGradient().getGradient();
+      //
+      // clean tape and adjoints
+      tape_.reset();
+      //
+      return hv_;
+   }
+};
+
+} } // END cmpad::codi namespace
+
+# endif // CMPAD_HAS_CODI
+// END C++
+# endif
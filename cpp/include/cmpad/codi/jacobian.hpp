@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CODI_JACOBIAN_HPP
+# define CMPAD_CODI_JACOBIAN_HPP
+/*
+{xrst_begin codi_jacobian.hpp}
+{xrst_spell
+   Co
+   Di
+   retaped
+}
+
+{xrst_template ,
+   cpp/include/cmpad/jacobian.xrst
+   @Package@       , CoDiPack
+   @#######@       , ########
+   @package@       , codi
+}
+
+Method
+******
+
+forward
+=======
+The CoDiPack ``codi::RealForward`` type is used and
+the algorithm is evaluated once for each column of the Jacobian.
+
+reverse
+=======
+The CoDiPack ``codi::RealReverse`` type is used.
+The function is retaped for each Jacobian evaluation
+and then one reverse sweep is used for each row of the Jacobian.
+
+{xrst_end codi_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CODI
+
+# include <codi.hpp>
+# include <cmpad/jacobian.hpp>
+
+namespace cmpad { namespace codi { // BEGIN cmpad::codi namespace
+
+// cmpad::codi::jacobian
+template < template<class ADVector> class Algo > class jacobian
+: public
+cmpad::jacobian {
+private:
+   //
+   // FScalar, FVector
+   typedef ::codi::RealForward       FScalar;
+   typedef cmpad::vector<FScalar>    FVector;
+   //
+   // RScalar, RVector
+   typedef ::codi::RealReverse       RScalar;
+   typedef cmpad::vector<RScalar>    RVector;
+   //
+   // option_
+   option_t                        option_;
+   //
+   // forward_
+   bool                            forward_;
+   //
+   // falgo_, fx_, fy_
+   Algo<FVector>                   falgo_;
+   FVector                         fx_;
+   FVector                         fy_;
+   //
+   // ralgo_, rx_, ry_
+   Algo<RVector>                   ralgo_;
+   RVector                         rx_;
+   RVector                         ry_;
+   //
+   // tape_
+   RScalar::Tape&                  tape_;
+   //
+   // J_
+   cmpad::vector<double>           J_;
+//
+public:
+   jacobian(void)
+   : tape_ ( RScalar::getTape() )
+   { }
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // falgo_, ralgo_
+      falgo_.setup(option);
+      ralgo_.setup(option);
+      //
+      // n
+      size_t n = falgo_.domain();
+      //
+      // m
+      size_t m = falgo_.range();
+      //
+      // forward_
+      choose_mode(m, n);
+      forward_ = mode() == "forward";
+      //
+      // fx_, fy_, rx_, ry_
+      fx_.resize(n);
+      fy_.resize(m);
+      rx_.resize(n);
+      ry_.resize(m);
+      //
+      // J_
+      J_.resize(m * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return falgo_.domain(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return falgo_.range() * falgo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  assert( x.size() == falgo_.domain() );
+      //
+      // n, m
+      size_t n = falgo_.domain();
+      size_t m = falgo_.range();
+      //
+      if( forward_ )
+      {  //
+         // fx_
+         for(size_t j = 0; j < n; ++j)
+            fx_[j] = x[j];
+         //
+         for(size_t j = 0; j < n; ++j)
+         {  //
+            // fy_
+            // forward direction is the j-th unit vector
+            fx_[j].gradient() = 1.0;
+            fy_ = falgo_(fx_);
+            fx_[j].gradient() = 0.0;
+            //
+            // J_
+            for(size_t i = 0; i < m; ++i)
+               J_[i * n + j] = fy_[i].getGradient();
+         }
+      }
+      else
+      {  //
+         // rx_
+         // independent variable values
+         for(size_t j = 0; j < n; ++j)
+            rx_[j] = x[j];
+         //
+         // tape_
+         tape_.setActive();
+         for(size_t j = 0; j < n; ++j)
+            tape_.registerInput( rx_[j] );
+         //
+         // ry_
+         // dependent variables
+         ry_ = ralgo_(rx_);
+         //
+         // tape_
+         for(size_t i = 0; i < m; ++i)
+            tape_.registerOutput( ry_[i] );
+         tape_.setPassive();
+         //
+         for(size_t i = 0; i < m; ++i)
+         {  //
+            // tape_, ry_, rx_
+            tape_.clearAdjoints();
+            ry_[i].gradient() = 1.0;
+            tape_.evaluate();
+            //
+            // J_
+            for(size_t j = 0; j < n; ++j)
+               J_[i * n + j] = rx_[j].getGradient();
+         }
+         //
+         // clean tape and adjoints
+         tape_.reset();
+      }
+      //
+      return J_;
+   }
+};
+
+} } // END cmpad::codi namespace
+
+# endif // CMPAD_HAS_CODI
+// END C++
+# endif
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CODI_JVP_HPP
+# define CMPAD_CODI_JVP_HPP
+/*
+{xrst_begin codi_jvp.hpp}
+{xrst_spell
+   Co
+   Di
+}
+
+{xrst_template ,
+   cpp/include/cmpad/jvp.xrst
+   @Package@       , CoDiPack
+   @#######@       , ########
+   @package@       , codi
+}
+
+Method
+******
+The CoDiPack ``codi::RealForwardVec<4>`` type is used; i.e.,
+each evaluation of the algorithm carries four directions.
+The number of directions in a CoDiPack vector type is a compile time
+constant, so the *p* directions are processed in blocks of four
+and the unused components of the last block are zero.
+
+{xrst_end codi_jvp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CODI
+
+# include <codi.hpp>
+# include <cmpad/jvp.hpp>
+
+namespace cmpad { namespace codi { // BEGIN cmpad::codi namespace
+
+// cmpad::codi::jvp
+template < template<class ADVector> class Algo > class jvp
+: public
+cmpad::jvp {
+private:
+   //
+   // n_block
+   // number of directions in each evaluation of the algorithm
+   static const size_t n_block = 4;
+   //
+   // FScalar, FVector
+   typedef ::codi::RealForwardVec<n_block>  FScalar;
+   typedef cmpad::vector<FScalar>           FVector;
+   //
+   // option_
+   option_t                        option_;
+   //
+   // algo_, ax_, ay_
+   Algo<FVector>                   algo_;
+   FVector                         ax_;
+   FVector                         ay_;
+   //
+   // Y_
+   cmpad::vector<double>           Y_;
+//
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m, p
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t p = option.n_direction;
+      //
+      // ax_, ay_
+      ax_.resize(n);
+      ay_.resize(m);
+      //
+      // Y_
+      Y_.resize(m * p);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() * (1 + option_.n_direction); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * option_.n_direction; };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  //
+      // n, m, p
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t p = option_.n_direction;
+      assert( xv.size() == n * (1 + p) );
+      //
+      // ax_
+      for(size_t j = 0; j < n; ++j)
+         ax_[j] = xv[j];
+      //
+      // start
+      for(size_t start = 0; start < p; start += n_block)
+      {  //
+         // ax_
+         // directions start, ..., start + n_block - 1
+         for(size_t j = 0; j < n; ++j)
+         {  for(size_t k = 0; k < n_block; ++k)
+            {  size_t ell = start + k;
+               if( ell < p )
+                  ax_[j].gradient()[k] = xv[n + j * p + ell];
+               else
+                  ax_[j].gradient()[k] = 0.0;
+            }
+         }
+         //
+         // ay_
+         ay_ = algo_(ax_);
+         //
+         // Y_
+         for(size_t i = 0; i < m; ++i)
+         {  for(size_t k = 0; k < n_block && start + k < p; ++k)
+               Y_[i * p + start + k] = ay_[i].getGradient()[k];
+         }
+      }
+      //
+      return Y_;
+   }
+};
+
+} } // END cmpad::codi namespace
+
+# endif // CMPAD_HAS_CODI
+// END C++
+# endif
@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CODI_VJP_HPP
+# define CMPAD_CODI_VJP_HPP
+/*
+{xrst_begin codi_vjp.hpp}
+{xrst_spell
+   Co
+   Di
+}
+
+{xrst_template ,
+   cpp/include/cmpad/vjp.xrst
+   @Package@       , CoDiPack
+   @#######@       , ########
+   @package@       , codi
+}
+
+Method
+******
+The CoDiPack ``codi::RealReverseVec<4>`` type is used; i.e.,
+each reverse sweep carries four weight vectors.
+The function is recorded during each evaluation.
+The number of adjoints in a CoDiPack vector type is a compile time
+constant, so the *q* weight vectors are processed in blocks of four
+and the unused components of the last block are zero.
+
+{xrst_end codi_vjp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CODI
+
+# include <codi.hpp>
+# include <cmpad/vjp.hpp>
+
+namespace cmpad { namespace codi { // BEGIN cmpad::codi namespace
+
+// cmpad::codi::vjp
+template < template<class ADVector> class Algo > class vjp
+: public
+cmpad::vjp {
+private:
+   //
+   // n_block
+   // number of weight vectors in each reverse sweep
+   static const size_t n_block = 4;
+   //
+   // ADScalar, ADVector
+   typedef ::codi::RealReverseVec<n_block> ADScalar;
+   typedef cmpad::vector<ADScalar>         ADVector;
+   //
+   // option_
+   option_t                        option_;
+   //
+   // algo_
+   Algo<ADVector>                  algo_;
+   //
+   // tape_
+   typename ADScalar::Tape&        tape_;
+   //
+   // ax_, ay_
+   ADVector                        ax_;
+   ADVector                        ay_;
+   //
+   // Z_
+   cmpad::vector<double>           Z_;
+//
+public:
+   vjp(void)
+   : tape_ ( ADScalar::getTape() )
+   { }
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m, q
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t q = option.n_direction;
+      //
+      // ax_, ay_
+      ax_.resize(n);
+      ay_.resize(m);
+      //
+      // Z_
+      Z_.resize(q * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() + option_.n_direction * algo_.range(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return option_.n_direction * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xw
+   ) override
+   {  //
+      // n, m, q
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t q = option_.n_direction;
+      assert( xw.size() == n + q * m );
+      //
+      // ax_
+      // independent variable values
+      for(size_t j = 0; j < n; ++j)
+         ax_[j] = xw[j];
+      //
+      // tape_
+      tape_.setActive();
+      for(size_t j = 0; j < n; ++j)
+         tape_.registerInput( ax_[j] );
+      //
+      // ay_
+      // dependent variables
+      ay_ = algo_(ax_);
+      //
+      // tape_
+      for(size_t i = 0; i < m; ++i)
+         tape_.registerOutput( ay_[i] );
+      tape_.setPassive();
+      //
+      // start
+      for(size_t start = 0; start < q; start += n_block)
+      {  //
+         // ay_
+         // weight vectors start, ..., start + n_block - 1
+         tape_.clearAdjoints();
+         for(size_t i = 0; i < m; ++i)
+         {  for(size_t k = 0; k < n_block; ++k)
+            {  size_t ell = start + k;
+               if( ell < q )
+                  ay_[i].gradient()[k] = xw[n + ell * m + i];
+               else
+                  ay_[i].gradient()[k] = 0.0;
+            }
+         }
+         //
+         // ax_
+         tape_.evaluate();
+         //
+         // Z_
+         for(size_t k = 0; k < n_block && start + k < q; ++k)
+         {  for(size_t j = 0; j < n; ++j)
+               Z_[(start + k) * n + j] = ax_[j].getGradient()[k];
+         }
+      }
+      //
+      // clean tape and adjoints
+      tape_.reset();
+      //
+      return Z_;
+   }
+};
+
+} } // END cmpad::codi namespace
+
+# endif // CMPAD_HAS_CODI
+// END C++
+# endif
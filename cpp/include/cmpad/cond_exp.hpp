@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_COND_EXP_HPP
+# define CMPAD_COND_EXP_HPP
+/*
+{xrst_begin cpp_cond_exp}
+{xrst_spell
+   condassign
+}
+
+C++ Conditional Expression That Can be Recorded
+###############################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/cond_exp.hpp>``
+| |tab| *result* = ``cmpad::cond_exp_lt`` (
+| |tab| |tab| *left* , *right* , *if_true* , *if_false*
+| |tab| )
+| |tab| *recorded* = ``cmpad::cond_exp_recorded`` < *Scalar* >:: ``value``
+
+Purpose
+*******
+This computes
+
+| |tab| ``if`` ( *left* < *right* )
+| |tab| |tab| *result* = *if_true*
+| |tab| ``else``
+| |tab| |tab| *result* = *if_false*
+
+For AD packages that support conditional expressions,
+the choice is part of the recording; i.e.,
+a recording made at one argument value is correct for all argument values.
+Otherwise, this is a native C++ branch; see
+:ref:`cpp_fun_obj@x_branch` .
+
+Scalar
+******
+The arguments and *result* all have the same type *Scalar* .
+
+Packages
+********
+The following packages record the choice:
+
+.. csv-table::
+   :widths: auto
+   :header-rows: 1
+
+   Package,   *Scalar*,              Implementation
+   cppad,     ``CppAD::AD<double>``, ``CppAD::CondExpLt``
+   cppad_jit, ``CppAD::AD<double>``, ``CppAD::CondExpLt``
+   cppadcg,   ``CppAD::AD< CppAD::cg::CG<double> >``, ``CppAD::CondExpLt``
+   adolc,     ``adouble``,           ``condassign``
+
+The other packages use the native C++ branch.
+This is correct for the ones that record the algorithm for every
+argument value, or do not use a recording.
+It is not correct for the codi gradient when
+:ref:`option_t@time_setup` is false, because it records once
+and evaluates the recording at other argument values.
+CoDiPack does not have a conditional expression that is recorded.
+
+recorded
+********
+This ``static constexpr bool`` is true if
+*Scalar* is ``double`` , or it is one of the types in the table above.
+Otherwise, a recording of ``cond_exp_lt`` is only correct for the
+argument value at which it was recorded;
+e.g., :ref:`huber_obj <cpp_huber_obj@x_branch>` uses this value to determine
+its :ref:`cpp_fun_obj@x_branch` .
+
+{xrst_toc_hidden
+   cpp/xam/huber_obj.cpp
+}
+Example
+*******
+:ref:`xam_huber_obj.cpp-name` uses the double version of this function.
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end cpp_cond_exp}
+*/
+// BEGIN C++
+namespace cmpad { // BEGIN cmpad namespace
+
+// cond_exp_recorded: native C++ branch
+template <class Scalar> struct cond_exp_recorded
+{  static constexpr bool value = false; };
+template <> struct cond_exp_recorded<double>
+{  static constexpr bool value = true; };
+
+// cond_exp_lt: native C++ branch
+template <class Scalar> Scalar cond_exp_lt(
+   const Scalar& left    ,
+   const Scalar& right   ,
+   const Scalar& if_true ,
+   const Scalar& if_false )
+{  if( left < right )
+      return if_true;
+   return if_false;
+}
+
+} // END cmpad namespace
+// ---------------------------------------------------------------------------
+# if CMPAD_HAS_CPPAD
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// cond_exp_recorded: CppAD
+template <class Base> struct cond_exp_recorded< CppAD::AD<Base> >
+{  static constexpr bool value = true; };
+
+// cond_exp_lt: CppAD
+template <class Base> CppAD::AD<Base> cond_exp_lt(
+   const CppAD::AD<Base>& left    ,
+   const CppAD::AD<Base>& right   ,
+   const CppAD::AD<Base>& if_true ,
+   const CppAD::AD<Base>& if_false )
+{  return CppAD::CondExpLt(left, right, if_true, if_false);
+}
+
+} // END cmpad namespace
+# endif // CMPAD_HAS_CPPAD
+// ---------------------------------------------------------------------------
+# if CMPAD_HAS_ADOLC
+# include <adolc/adolc.h>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// cond_exp_recorded: ADOL-C
+template <> struct cond_exp_recorded<adouble>
+{  static constexpr bool value = true; };
+
+// cond_exp_lt: ADOL-C
+// condassign(result, cond, if_pos, if_not) uses if_pos when cond > 0
+inline adouble cond_exp_lt(
+   const adouble& left    ,
+   const adouble& right   ,
+   const adouble& if_true ,
+   const adouble& if_false )
+{  adouble cond = right - left;
+   adouble result;
+   condassign(result, cond, if_true, if_false);
+   return result;
+}
+
+} // END cmpad namespace
+# endif // CMPAD_HAS_ADOLC
+// END C++
+# endif
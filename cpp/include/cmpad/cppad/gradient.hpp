@@ -23,6 +23,45 @@ Gradients Using CppAD
    @not_cppad_jit@ , true
    @not_codi@      , true
 }
+
+{xrst_toc_hidden
+   cpp/include/cmpad/cppad/tape_file.hpp
+}
+tape_load
+*********
+The tape is recorded, or loaded from a file, by
+:ref:`cppad_tape_file.hpp-name` ; see :ref:`option_t@tape_load` .
+
+data_mode
+*********
+If :ref:`option_t@data_mode` is ``dynamic`` , the
+:ref:`cpp_fun_obj@Data` for the algorithm are CppAD dynamic parameters
+and ``set_data`` uses ``new_dynamic`` to change their values.
+Otherwise, the data are constants and ``set_data`` records the
+function again.
+As in ``setup`` , the recording is optimized if and only if
+:ref:`option_t@time_setup` is false.
+
+x_branch
+********
+If the algorithm's :ref:`cpp_fun_obj@x_branch` is true,
+the comparison operators are not removed when the function is optimized
+and ``compare_change_number`` is used to detect when the result of a
+recorded comparison has changed.
+In this case the function is recorded again at the new argument value
+(without optimizing it) and the change is reported to
+:ref:`cpp_retape_count-name` .
+
+setup_copy
+**********
+| |tab| *copy* ``.setup_copy`` ( *grad* )
+
+If *grad* has been setup, this sets up *copy* so that it
+computes the same gradient as *grad* without recording;
+i.e., the tape in *copy* is a copy of the tape in *grad* .
+This is used by :ref:`cpp_batch_thread-name` to give each of its
+threads a copy of a gradient that was setup once.
+
 {xrst_end cppad_gradient.hpp}
 ------------------------------------------------------------------------------
 {xrst_begin cppad_gradient_special.hpp}
@@ -55,8 +94,12 @@ Source Code
 */
 // BEGIN C++
 # if CMPAD_HAS_CPPAD
+# include <cassert>
+# include <typeinfo>
 # include <cmpad/gradient.hpp>
 # include <cmpad/cppad/cppad.hpp>
+# include <cmpad/cppad/tape_file.hpp>
+# include <cmpad/retape_count.hpp>
 
 namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
 
@@ -85,12 +128,60 @@ private:
    // w_
    vector_type                   w_;
    //
+   // x_
+   // argument value at which the function is recorded
+   vector_type                   x_;
+   //
    // tape_
    CppAD::ADFun<scalar_type>     tape_;
    //
    // g_
    vector_type                   g_;
    //
+   // data_
+   // current value of the algorithm data
+   vector_type                   data_;
+   //
+   // record
+   // record the function corresponding to algo_ and data_ in tape
+   void record(CppAD::ADFun<scalar_type>& tape, bool optimize)
+   {  //
+      // n, m, n_data
+      size_t n      = algo_.domain();
+      size_t m      = algo_.range();
+      size_t n_data = data_.size();
+      //
+      // optimize_options
+      // keep the comparisons if they are needed to detect a change
+      std::string optimize_options =
+         "no_conditional_skip no_print_for_op no_cumulative_sum_op";
+      if( ! algo_.x_branch() )
+         optimize_options += " no_compare_op";
+      //
+      // ax, adata
+      ADVector ax(n), adata(n_data);
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = x_[i];
+      for(size_t k = 0; k < n_data; ++k)
+         adata[k] = data_[k];
+      //
+      // Independent, algo_
+      // if data_mode is dynamic, the data are dynamic parameters
+      if( option_.data_mode == "dynamic" )
+         CppAD::Independent(ax, adata);
+      else
+         CppAD::Independent(ax);
+      algo_.set_data(adata);
+      //
+      // tape
+      ADVector ay(1), az;
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tape.Dependent(ax, ay);
+      if( optimize )
+         tape.optimize(optimize_options);
+   }
+   //
 public:
    //
    // option
@@ -109,32 +200,64 @@ public:
       // n
       size_t n = algo_.domain();
       //
-      // m
-      size_t m = algo_.range();
-      //
       // w_
       w_.resize(1);
       w_[0] = 1.0;
       //
-      // optimize_options
-      std::string optimize_options =
-      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      // x_
+      x_.resize(n);
+      for(size_t i = 0; i < n; ++i)
+         x_[i] = 0.0;
+      //
+      // data_
+      // the default data values are constants
+      ADVector adata = algo_.data();
+      data_.resize( adata.size() );
+      for(size_t k = 0; k < adata.size(); ++k)
+         data_[k] = CppAD::Value( adata[k] );
       //
       // tape_
-      ADVector ax(n);
-      for(size_t i = 0; i < n; ++i)
-         ax[i] = 0.;
-      CppAD::Independent(ax);
-      ADVector ay(1), az;
-      az    = algo_(ax);
-      ay[0] = az[m-1];
-      tape_.Dependent(ax, ay);
-      if( ! option.time_setup )
-         tape_.optimize(optimize_options);
+      auto record_tape = [&](CppAD::ADFun<scalar_type>& tape)
+      {  record(tape, ! option.time_setup); };
+      tape_file::setup(
+         tape_, "grad_cppad", typeid(algo_).name(),
+         algo_version<Algo>::value, option, record_tape
+      );
       //
       // g_
       g_.resize(n);
    }
+   //
+   // setup_copy
+   void setup_copy(const gradient& grad)
+   {  option_ = grad.option_;
+      algo_.setup(option_);
+      w_     = grad.w_;
+      x_     = grad.x_;
+      data_  = grad.data_;
+      g_     = grad.g_;
+      tape_  = grad.tape_;
+   }
+   //
+   // n_data
+   size_t n_data(void) const override
+   {  return data_.size(); }
+   //
+   // data
+   vector_type data(void) const override
+   {  return data_; }
+   //
+   // set_data
+   // if data_mode is dynamic, only the dynamic parameters change,
+   // otherwise the function is recorded again (optimized as in setup).
+   void set_data(const vector_type& data) override
+   {  assert( data.size() == data_.size() );
+      data_ = data;
+      if( option_.data_mode == "dynamic" )
+         tape_.new_dynamic(data_);
+      else
+         record(tape_, ! option_.time_setup);
+   }
    // domain
    size_t domain(void) const override
    {  return algo_.domain(); };
@@ -142,6 +265,18 @@ public:
    // operator
    const vector_type& operator()(const vector_type& x) override
    {  tape_.Forward(0, x);
+      //
+      // tape_
+      // record again if the result of a recorded comparison has changed
+      if( algo_.x_branch() )
+      {  size_t n_change = tape_.compare_change_number();
+         ::cmpad::retape_count::check(n_change);
+         if( n_change > 0 )
+         {  x_ = x;
+            record(tape_, false);
+            tape_.Forward(0, x);
+         }
+      }
       g_ =  tape_.Reverse(1, w_);
       return g_;
    }
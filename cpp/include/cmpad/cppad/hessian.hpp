@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_HESSIAN_HPP
+# define CMPAD_CPPAD_HESSIAN_HPP
+/*
+{xrst_begin cppad_hessian.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian.xrst
+   @Package@       , CppAD
+   @#######@       , #####
+   @package@       , cppad
+}
+
+Method
+******
+The function is recorded once during setup.
+The Hessian is computed using forward-over-reverse; i.e.,
+one zero order forward sweep and then,
+for each component of *x* ,
+a first order forward sweep and a second order reverse sweep.
+
+{xrst_end cppad_hessian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+# include <cmpad/hessian.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
+
+// cmpad::cppad::hessian
+template < template<class ADVector> class Algo> class hessian
+: public
+::cmpad::hessian {
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef ::cmpad::vector<scalar_type> vector_type;
+   //
+private:
+   // ADVector
+   typedef typename ::cmpad::vector< CppAD::AD<scalar_type> >  ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // w_
+   vector_type                   w_;
+   //
+   // tape_
+   CppAD::ADFun<scalar_type>     tape_;
+   //
+   // h_
+   vector_type                   h_;
+   //
+public:
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // w_
+      w_.resize(1);
+      w_[0] = 1.0;
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape_
+      ADVector ax(n);
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = 0.;
+      CppAD::Independent(ax);
+      ADVector ay(1), az;
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tape_.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape_.optimize(optimize_options);
+      //
+      // h_
+      h_.resize(n * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // operator
+   const vector_type& operator()(const vector_type& x) override
+   {  h_ = tape_.Hessian(x, w_);
+      return h_;
+   }
+};
+
+} } // END cmpad::cppad namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
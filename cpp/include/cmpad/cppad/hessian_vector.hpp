@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_HESSIAN_VECTOR_HPP
+# define CMPAD_CPPAD_HESSIAN_VECTOR_HPP
+/*
+{xrst_begin cppad_hessian_vector.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian_vector.xrst
+   @Package@       , CppAD
+   @#######@       , #####
+   @package@       , cppad
+}
+
+Method
+******
+The function is recorded once during setup.
+The Hessian times a vector is computed using forward-over-reverse; i.e.,
+a zero order forward sweep at *x* ,
+a first order forward sweep in the direction *v* ,
+and a second order reverse sweep.
+
+{xrst_end cppad_hessian_vector.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+# include <cmpad/hessian_vector.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
+
+// cmpad::cppad::hessian_vector
+template < template<class ADVector> class Algo> class hessian_vector
+: public
+::cmpad::hessian_vector {
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef ::cmpad::vector<scalar_type> vector_type;
+   //
+private:
+   // ADVector
+   typedef typename ::cmpad::vector< CppAD::AD<scalar_type> >  ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // w_
+   vector_type                   w_;
+   //
+   // x_, v_
+   vector_type                   x_;
+   vector_type                   v_;
+   //
+   // tape_
+   CppAD::ADFun<scalar_type>     tape_;
+   //
+   // dw_, hv_
+   vector_type                   dw_;
+   vector_type                   hv_;
+   //
+public:
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // w_
+      w_.resize(1);
+      w_[0] = 1.0;
+      //
+      // x_, v_
+      x_.resize(n);
+      v_.resize(n);
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape_
+      ADVector ax(n);
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = 0.;
+      CppAD::Independent(ax);
+      ADVector ay(1), az;
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tape_.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape_.optimize(optimize_options);
+      //
+      // hv_
+      hv_.resize(n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return 2 * algo_.domain(); };
+   //
+   // operator
+   const vector_type& operator()(const vector_type& xv) override
+   {  //
+      // n
+      size_t n = algo_.domain();
+      assert( xv.size() == 2 * n );
+      //
+      // x_, v_
+      for(size_t j = 0; j < n; ++j)
+      {  x_[j] = xv[j];
+         v_[j] = xv[n + j];
+      }
+      //
+      // dw_
+      tape_.Forward(0, x_);
+      tape_.Forward(1, v_);
+      dw_ = tape_.Reverse(2, w_);
+      //
+      // hv_
+      for(size_t j = 0; j < n; ++j)
+         hv_[j] = dw_[2 * j + 1];
+      //
+      return hv_;
+   }
+};
+
+} } // END cmpad::cppad namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
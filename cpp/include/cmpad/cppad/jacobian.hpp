@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_JACOBIAN_HPP
+# define CMPAD_CPPAD_JACOBIAN_HPP
+/*
+{xrst_begin cppad_jacobian.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/jacobian.xrst
+   @Package@       , CppAD
+   @#######@       , #####
+   @package@       , cppad
+}
+
+Method
+******
+The function is recorded once during setup.
+Each Jacobian evaluation starts with a zero order forward sweep.
+
+forward
+=======
+One first order forward sweep is used for each column of the Jacobian.
+
+reverse
+=======
+One first order reverse sweep is used for each row of the Jacobian.
+
+{xrst_end cppad_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+# include <cmpad/jacobian.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
+
+// cmpad::cppad::jacobian
+template < template<class ADVector> class Algo> class jacobian
+: public
+::cmpad::jacobian {
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef ::cmpad::vector<scalar_type> vector_type;
+   //
+private:
+   // ADVector
+   typedef typename ::cmpad::vector< CppAD::AD<scalar_type> >  ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // forward_
+   bool                          forward_;
+   //
+   // tape_
+   CppAD::ADFun<scalar_type>     tape_;
+   //
+   // dx_, dy_, w_, dw_
+   vector_type                   dx_;
+   vector_type                   dy_;
+   vector_type                   w_;
+   vector_type                   dw_;
+   //
+   // J_
+   vector_type                   J_;
+   //
+public:
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // forward_
+      choose_mode(m, n);
+      forward_ = mode() == "forward";
+      //
+      // dx_, w_
+      dx_.resize(n);
+      for(size_t j = 0; j < n; ++j)
+         dx_[j] = 0.0;
+      w_.resize(m);
+      for(size_t i = 0; i < m; ++i)
+         w_[i] = 0.0;
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape_
+      ADVector ax(n), ay;
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = 0.;
+      CppAD::Independent(ax);
+      ay = algo_(ax);
+      tape_.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape_.optimize(optimize_options);
+      //
+      // J_
+      J_.resize(m * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * algo_.domain(); };
+   //
+   // operator
+   const vector_type& operator()(const vector_type& x) override
+   {  //
+      // n, m
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      //
+      // tape_
+      tape_.Forward(0, x);
+      //
+      // J_
+      if( forward_ )
+      {  for(size_t j = 0; j < n; ++j)
+         {  dx_[j] = 1.0;
+            dy_    = tape_.Forward(1, dx_);
+            dx_[j] = 0.0;
+            for(size_t i = 0; i < m; ++i)
+               J_[i * n + j] = dy_[i];
+         }
+      }
+      else
+      {  for(size_t i = 0; i < m; ++i)
+         {  w_[i] = 1.0;
+            dw_   = tape_.Reverse(1, w_);
+            w_[i] = 0.0;
+            for(size_t j = 0; j < n; ++j)
+               J_[i * n + j] = dw_[j];
+         }
+      }
+      return J_;
+   }
+};
+
+} } // END cmpad::cppad namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
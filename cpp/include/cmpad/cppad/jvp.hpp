@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_JVP_HPP
+# define CMPAD_CPPAD_JVP_HPP
+/*
+{xrst_begin cppad_jvp.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/jvp.xrst
+   @Package@       , CppAD
+   @#######@       , #####
+   @package@       , cppad
+}
+
+Method
+******
+The function is recorded once during setup.
+The Jacobian times the directions is computed using
+a zero order forward sweep at *x* ,
+followed by one first order forward sweep that carries all *p* directions.
+
+{xrst_end cppad_jvp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+# include <cmpad/jvp.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
+
+// cmpad::cppad::jvp
+template < template<class ADVector> class Algo> class jvp
+: public
+::cmpad::jvp {
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef ::cmpad::vector<scalar_type> vector_type;
+   //
+private:
+   // ADVector
+   typedef typename ::cmpad::vector< CppAD::AD<scalar_type> >  ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // x_, V_
+   vector_type                   x_;
+   vector_type                   V_;
+   //
+   // tape_
+   CppAD::ADFun<scalar_type>     tape_;
+   //
+   // Y_
+   vector_type                   Y_;
+   //
+public:
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, p
+      size_t n = algo_.domain();
+      size_t p = option.n_direction;
+      //
+      // x_, V_
+      x_.resize(n);
+      V_.resize(n * p);
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape_
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = 0.;
+      CppAD::Independent(ax);
+      ADVector ay = algo_(ax);
+      tape_.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape_.optimize(optimize_options);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() * (1 + option_.n_direction); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * option_.n_direction; };
+   //
+   // operator
+   const vector_type& operator()(const vector_type& xv) override
+   {  //
+      // n, p
+      size_t n = algo_.domain();
+      size_t p = option_.n_direction;
+      assert( xv.size() == n * (1 + p) );
+      //
+      // x_, V_
+      for(size_t j = 0; j < n; ++j)
+         x_[j] = xv[j];
+      for(size_t k = 0; k < n * p; ++k)
+         V_[k] = xv[n + k];
+      //
+      // Y_
+      // CppAD uses the same row major order for V_ and Y_ as cmpad::jvp
+      tape_.Forward(0, x_);
+      Y_ = tape_.Forward(1, p, V_);
+      //
+      return Y_;
+   }
+};
+
+} } // END cmpad::cppad namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_PARALLEL_SETUP_HPP
+# define CMPAD_CPPAD_PARALLEL_SETUP_HPP
+/*
+{xrst_begin cppad_parallel_setup.hpp}
+{xrst_spell
+   Gen
+}
+
+Setup CppAD for Use by a Thread Pool
+####################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/cppad/parallel_setup.hpp>``
+| |tab| ``cmpad::cppad::parallel_setup`` ( *n_thread* )
+
+Purpose
+*******
+CppAD keeps some of its memory, and some of its static data, separately
+for each thread.
+This routine informs CppAD about the threads used by
+:ref:`cpp_batch_thread-name` .
+It does nothing when the CppAD package has not been installed.
+
+n_thread
+********
+This ``size_t`` value is the number of worker threads; see
+:ref:`option_t@n_thread` .
+There is one more thread than *n_thread* ; i.e., the thread
+that is not a worker thread.
+
+Sequential Mode
+***************
+This routine must be called in sequential mode; i.e., when
+:ref:`cpp_batch_thread@in_parallel` is false.
+It must be called before any CppAD AD operations are recorded
+and before any *batch* object with *n_thread* worker threads is setup.
+
+CppADCodeGen
+************
+If the CppADCodeGen package has been installed,
+the static data for its ``CppAD::cg::CG<double>`` base type is also setup.
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end cppad_parallel_setup.hpp}
+*/
+// BEGIN C++
+# include <cassert>
+# include <cstddef>
+# include <cmpad/batch_thread.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
+
+inline void parallel_setup([[maybe_unused]] size_t n_thread)
+# if CMPAD_HAS_CPPAD
+{  //
+   // num_threads
+   size_t num_threads = n_thread + 1;
+   assert( num_threads <= CPPAD_MAX_NUM_THREADS );
+   assert( ! cmpad::in_parallel() );
+   //
+   // thread_alloc
+   CppAD::thread_alloc::parallel_setup(
+      num_threads, cmpad::in_parallel, cmpad::thread_num
+   );
+   CppAD::thread_alloc::hold_memory(true);
+   //
+   // parallel_ad
+   CppAD::parallel_ad<double>();
+# if CMPAD_HAS_CPPADCG
+   CppAD::parallel_ad< CppAD::cg::CG<double> >();
+# endif
+}
+# else
+{  assert( n_thread > 0 ); }
+# endif
+
+} } // END cmpad::cppad namespace
+// END C++
+# endif
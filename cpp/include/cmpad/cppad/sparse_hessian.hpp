@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_SPARSE_HESSIAN_HPP
+# define CMPAD_CPPAD_SPARSE_HESSIAN_HPP
+/*
+{xrst_begin cppad_sparse_hessian.hpp}
+{xrst_spell
+   hes
+}
+
+{xrst_template ,
+   cpp/include/cmpad/sparse_hessian.xrst
+   @Package@       , CppAD
+   @#######@       , #####
+   @package@       , cppad
+}
+
+Method
+******
+The function is recorded once during setup.
+The sparsity pattern is computed using ``for_hes_sparsity`` .
+The Hessian is computed using ``sparse_hes`` with the
+``cppad.symmetric`` coloring; i.e., a coloring that uses the symmetry
+of the Hessian to reduce the number of
+forward-over-reverse sweeps (one for each color).
+The coloring is computed by calling ``sparse_hes``
+once during setup (with *x* equal to zero).
+
+{xrst_end cppad_sparse_hessian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+# include <cmpad/sparse_hessian.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
+
+// cmpad::cppad::sparse_hessian
+template < template<class ADVector> class Algo> class sparse_hessian
+: public
+::cmpad::sparse_hessian {
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef ::cmpad::vector<scalar_type> vector_type;
+   //
+private:
+   // ADVector
+   typedef typename ::cmpad::vector< CppAD::AD<scalar_type> >  ADVector;
+   //
+   // size_vector, sparse_rc, sparse_rcv
+   typedef ::cmpad::vector<size_t>                        size_vector;
+   typedef CppAD::sparse_rc<size_vector>                  sparse_rc;
+   typedef CppAD::sparse_rcv<size_vector, vector_type>    sparse_rcv;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // w_
+   vector_type                   w_;
+   //
+   // tape_
+   CppAD::ADFun<scalar_type>     tape_;
+   //
+   // pattern_
+   // sparsity pattern for the entire Hessian
+   sparse_rc                     pattern_;
+   //
+   // row_, col_
+   size_vector                   row_;
+   size_vector                   col_;
+   //
+   // subset_
+   // upper triangle of the Hessian
+   sparse_rcv                    subset_;
+   //
+   // work_
+   CppAD::sparse_hes_work        work_;
+   //
+public:
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // w_
+      w_.resize(1);
+      w_[0] = 1.0;
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape_
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = 0.;
+      CppAD::Independent(ax);
+      ADVector ay(1), az;
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tape_.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape_.optimize(optimize_options);
+      //
+      // pattern_
+      ::cmpad::vector<bool> select_domain(n), select_range(1);
+      for(size_t j = 0; j < n; ++j)
+         select_domain[j] = true;
+      select_range[0]    = true;
+      bool internal_bool = false;
+      tape_.for_hes_sparsity(
+         select_domain, select_range, internal_bool, pattern_
+      );
+      //
+      // row_, col_
+      // upper triangle of the sparsity pattern in row major order
+      size_vector order = pattern_.row_major();
+      row_.resize(0);
+      col_.resize(0);
+      for(size_t k = 0; k < pattern_.nnz(); ++k)
+      {  size_t r = pattern_.row()[ order[k] ];
+         size_t c = pattern_.col()[ order[k] ];
+         if( r <= c )
+         {  row_.push_back(r);
+            col_.push_back(c);
+         }
+      }
+      //
+      // subset_
+      size_t    nnz = row_.size();
+      sparse_rc upper(n, n, nnz);
+      for(size_t k = 0; k < nnz; ++k)
+         upper.set(k, row_[k], col_[k]);
+      subset_ = sparse_rcv(upper);
+      //
+      // work_
+      // the first call computes the coloring and stores it in work_
+      vector_type x(n);
+      for(size_t j = 0; j < n; ++j)
+         x[j] = 0.0;
+      work_.clear();
+      compute(x);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // row
+   const size_vector& row(void) const override
+   {  return row_; }
+   //
+   // col
+   const size_vector& col(void) const override
+   {  return col_; }
+   //
+   // operator
+   const vector_type& operator()(const vector_type& x) override
+   {  compute(x);
+      return subset_.val();
+   }
+private:
+   //
+   // compute
+   void compute(const vector_type& x)
+   {  std::string coloring = "cppad.symmetric";
+      tape_.sparse_hes(x, w_, subset_, pattern_, coloring, work_);
+   }
+};
+
+} } // END cmpad::cppad namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
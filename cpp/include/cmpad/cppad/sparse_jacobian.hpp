@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_SPARSE_JACOBIAN_HPP
+# define CMPAD_CPPAD_SPARSE_JACOBIAN_HPP
+/*
+{xrst_begin cppad_sparse_jacobian.hpp}
+{xrst_spell
+   jac
+   rev
+}
+
+{xrst_template ,
+   cpp/include/cmpad/sparse_jacobian.xrst
+   @Package@       , CppAD
+   @#######@       , #####
+   @package@       , cppad
+}
+
+Method
+******
+The function is recorded once during setup.
+If the domain dimension *n* is less than or equal the range dimension *m* ,
+forward mode is used; i.e.,
+the sparsity pattern is computed using ``for_jac_sparsity`` ,
+and the Jacobian is computed using ``sparse_jac_for``
+with one forward sweep for each column color.
+Otherwise reverse mode is used; i.e.,
+the sparsity pattern is computed using ``rev_jac_sparsity`` ,
+and the Jacobian is computed using ``sparse_jac_rev``
+with one reverse sweep for each row color.
+The coloring is computed by calling the sparse Jacobian routine
+once during setup (with *x* equal to zero).
+The :ref:`cpp_sparse_jacobian@sparsity_time` is the time for the
+sparsity pattern plus this first call.
+
+{xrst_end cppad_sparse_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+# include <chrono>
+# include <cmpad/sparse_jacobian.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
+
+// cmpad::cppad::sparse_jacobian
+template < template<class ADVector> class Algo> class sparse_jacobian
+: public
+::cmpad::sparse_jacobian {
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef ::cmpad::vector<scalar_type> vector_type;
+   //
+private:
+   // ADVector
+   typedef typename ::cmpad::vector< CppAD::AD<scalar_type> >  ADVector;
+   //
+   // size_vector, sparse_rc, sparse_rcv
+   typedef ::cmpad::vector<size_t>                        size_vector;
+   typedef CppAD::sparse_rc<size_vector>                  sparse_rc;
+   typedef CppAD::sparse_rcv<size_vector, vector_type>    sparse_rcv;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // forward_
+   bool                          forward_;
+   //
+   // tape_
+   CppAD::ADFun<scalar_type>     tape_;
+   //
+   // pattern_
+   sparse_rc                     pattern_;
+   //
+   // row_, col_
+   size_vector                   row_;
+   size_vector                   col_;
+   //
+   // subset_
+   sparse_rcv                    subset_;
+   //
+   // work_
+   CppAD::sparse_jac_work        work_;
+   //
+public:
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // forward_
+      forward_ = n <= m;
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape_
+      ADVector ax(n), ay;
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = 0.;
+      CppAD::Independent(ax);
+      ay = algo_(ax);
+      tape_.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape_.optimize(optimize_options);
+      //
+      // t_start
+      using std::chrono::steady_clock;
+      steady_clock::time_point t_start = steady_clock::now();
+      //
+      // pattern
+      // sparsity pattern in the order computed by CppAD
+      bool      transpose     = false;
+      bool      dependency    = false;
+      bool      internal_bool = false;
+      sparse_rc pattern;
+      if( forward_ )
+      {  sparse_rc eye(n, n, n);
+         for(size_t k = 0; k < n; ++k)
+            eye.set(k, k, k);
+         tape_.for_jac_sparsity(
+            eye, transpose, dependency, internal_bool, pattern
+         );
+      }
+      else
+      {  sparse_rc eye(m, m, m);
+         for(size_t k = 0; k < m; ++k)
+            eye.set(k, k, k);
+         tape_.rev_jac_sparsity(
+            eye, transpose, dependency, internal_bool, pattern
+         );
+      }
+      //
+      // pattern_, row_, col_
+      // sparsity pattern in row major order
+      size_t      nnz   = pattern.nnz();
+      size_vector order = pattern.row_major();
+      pattern_.resize(m, n, nnz);
+      row_.resize(nnz);
+      col_.resize(nnz);
+      for(size_t k = 0; k < nnz; ++k)
+      {  row_[k] = pattern.row()[ order[k] ];
+         col_[k] = pattern.col()[ order[k] ];
+         pattern_.set(k, row_[k], col_[k]);
+      }
+      //
+      // subset_
+      subset_ = sparse_rcv(pattern_);
+      //
+      // work_
+      // the first call computes the coloring and stores it in work_
+      vector_type x(n);
+      for(size_t j = 0; j < n; ++j)
+         x[j] = 0.0;
+      work_.clear();
+      compute(x);
+      //
+      // sparsity_time
+      std::chrono::duration<double> t_sparsity = steady_clock::now() - t_start;
+      set_sparsity_time( t_sparsity.count() );
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // row
+   const size_vector& row(void) const override
+   {  return row_; }
+   //
+   // col
+   const size_vector& col(void) const override
+   {  return col_; }
+   //
+   // operator
+   const vector_type& operator()(const vector_type& x) override
+   {  compute(x);
+      return subset_.val();
+   }
+private:
+   //
+   // compute
+   void compute(const vector_type& x)
+   {  std::string coloring = "cppad";
+      if( forward_ )
+      {  size_t group_max = 1;
+         tape_.sparse_jac_for(
+            group_max, x, subset_, pattern_, coloring, work_
+         );
+      }
+      else
+      {  tape_.sparse_jac_rev(x, subset_, pattern_, coloring, work_);
+      }
+   }
+};
+
+} } // END cmpad::cppad namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
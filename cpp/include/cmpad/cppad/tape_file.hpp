@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_TAPE_FILE_HPP
+# define CMPAD_CPPAD_TAPE_FILE_HPP
+/*
+{xrst_begin cppad_tape_file.hpp}
+{xrst_spell
+   dir
+   fnv
+   json
+   typeid
+}
+
+Record a CppAD Function Once and Load it at Startup
+###################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/cppad/tape_file.hpp>``
+| |tab| ``cmpad::cppad::tape_file::setup`` (
+| |tab| |tab| *tape* , *tape_name* , *algo_name* , *algo_version* ,
+| |tab| |tab| *option* , *record*
+| |tab| )
+| |tab| *cache_path* = ``cmpad::cppad::tape_file::cache_path`` ()
+| |tab| *n_load* = ``cmpad::cppad::tape_file::n_load`` ()
+| |tab| *second* = ``cmpad::cppad::tape_file::load_second`` ()
+| |tab| *n_record* = ``cmpad::cppad::tape_file::n_record`` ()
+| |tab| *second* = ``cmpad::cppad::tape_file::record_second`` ()
+
+Purpose
+*******
+This is used by the cppad and cppad_jit gradients so that a process
+that starts many times, for the same algorithm, does not re-run the
+algorithm under recording each time it starts.
+The function is saved using the CppAD json representation of a function
+(``to_json`` ) and loaded using ``from_json`` .
+
+tape
+****
+This ``CppAD::ADFun<double>`` object is the function that is
+recorded or loaded.
+
+tape_name
+*********
+This ``std::string`` identifies the derivative that uses *tape* ;
+e.g., ``grad_cppad`` .
+It is used in the name of the tape file.
+
+algo_name
+*********
+This ``std::string`` identifies the algorithm that is recorded;
+e.g., ``typeid`` ( *algo* ) ``.name()`` .
+
+algo_version
+************
+This ``size_t`` is the version of the algorithm that is recorded.
+The cppad and cppad_jit gradients use
+
+| |tab| ``cmpad::cppad::algo_version`` < *Algo* >:: ``value``
+
+which is one unless it is specialized for *Algo* .
+When a change to an algorithm changes the operation sequence that it
+records, its version must be incremented so that tapes recorded
+before the change are not loaded; e.g.,
+
+| |tab| ``template <> struct cmpad::cppad::algo_version<cmpad::an_ode>``
+| |tab| ``{  static constexpr size_t value = 2; };``
+
+option
+******
+This :ref:`option_t-name` object is the setup options for the
+derivative that uses *tape* .
+If its *tape_load* field is ``record`` , *tape* is recorded.
+If it is ``file`` and *tape* is in the `Tape Cache`_ , it is loaded.
+Otherwise *tape* is recorded and then saved in the cache.
+Its *n_arg* , *n_other* , *time_setup* , and *data_mode* fields
+are part of the cache key.
+
+record
+******
+The syntax *record* ( *tape* ) records *tape* using the algorithm
+(and optimizes it when :ref:`option_t@time_setup` is false).
+
+Tape Cache
+**********
+The tape files are stored in the directory
+
+   *temp_dir*\ ``/cmpad_tape_cache``
+
+where *temp_dir* is the C++ temporary directory.
+The file name is *tape_name*\ ``_``\ *key*\ ``.json`` where
+*key* is a 64 bit FNV-1a hash of the cache key text.
+The cache key text is *tape_name* , *algo_name* , *algo_version* ,
+the options above, ``tape_file::format_version`` ,
+and the CppAD version ( ``CPPAD_PACKAGE_STRING`` ).
+The key text is the first line of the tape file,
+so a tape file is only loaded if its key text is the same.
+The ``format_version`` is incremented when the way that cmpad records,
+or saves, a tape changes; e.g., the optimization options.
+Rebuilding the program without changing any of these does not change
+the key, so the tapes stay valid across builds.
+A tape file is written in a :ref:`cpp_private_dir-name` and then
+renamed into the cache. Renaming is atomic, so concurrent processes
+(and threads) that use the same cache do not see partially written files.
+The tape files are not removed by cmpad.
+
+cache_path
+**********
+This ``std::filesystem::path`` is the absolute path of the
+tape cache directory above.
+
+n_load, n_record
+****************
+These ``size_t`` values are the number of times a *tape* was loaded
+and recorded, by all the calls to setup in this process.
+
+load_second, record_second
+**************************
+These ``double`` values are the total wall clock time
+for the loads and records.
+Comparing *second* / *n_load* with *second* / *n_record* gives
+the time saved by loading a tape instead of recording it.
+
+Threads
+*******
+All the file names used by setup are absolute,
+so setup can be called at the same time in different threads.
+Recording or loading a *tape* in parallel mode requires
+:ref:`cppad_parallel_setup.hpp-name` .
+
+{xrst_toc_hidden
+   cpp/xam/cppad/tape_file.cpp
+}
+Example
+*******
+:ref:`xam_cppad_tape_file.cpp-name` is an example and test
+that shows a changed *n_other* , *algo_name* , or *algo_version*
+misses the cache.
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end cppad_tape_file.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+
+# include <atomic>
+# include <chrono>
+# include <cstdint>
+# include <filesystem>
+# include <fstream>
+# include <iostream>
+# include <sstream>
+# include <string>
+# include <cmpad/option_t.hpp>
+# include <cmpad/private_dir.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
+
+// cmpad::cppad::algo_version
+template < template<class Vector> class Algo > struct algo_version
+{  static constexpr size_t value = 1; };
+
+// cmpad::cppad::tape_file
+class tape_file {
+private:
+   //
+   // load_count, record_count
+   static std::atomic<size_t>& load_count(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   static std::atomic<size_t>& record_count(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   //
+   // load_nanosecond, record_nanosecond
+   static std::atomic<size_t>& load_nanosecond(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   static std::atomic<size_t>& record_nanosecond(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   //
+   // hash_key
+   // 64 bit FNV-1a hash of text as a hexadecimal string
+   static std::string hash_key(const std::string& text)
+   {  uint64_t hash = 14695981039346656037ULL;
+      for(char c : text)
+      {  hash ^= uint64_t( static_cast<unsigned char>(c) );
+         hash *= 1099511628211ULL;
+      }
+      std::stringstream ss;
+      ss << std::hex << hash;
+      return ss.str();
+   }
+   //
+   // read_file
+   // contents of a file, empty if it cannot be read
+   static std::string read_file(const std::filesystem::path& file)
+   {  std::ifstream ifs(file, std::ifstream::in);
+      std::stringstream ss;
+      if( ifs.good() )
+         ss << ifs.rdbuf();
+      return ss.str();
+   }
+   //
+   // elapsed
+   // nanoseconds since t_start
+   static size_t elapsed(std::chrono::steady_clock::time_point t_start)
+   {  auto t_end = std::chrono::steady_clock::now();
+      return size_t( std::chrono::duration_cast<
+         std::chrono::nanoseconds >(t_end - t_start).count()
+      );
+   }
+//
+public:
+   // format_version
+   static constexpr size_t format_version = 1;
+   //
+   // cache_path
+   static std::filesystem::path cache_path(void)
+   {  std::filesystem::path temp_path =
+         std::filesystem::absolute( std::filesystem::temp_directory_path() );
+      return temp_path / "cmpad_tape_cache";
+   }
+   //
+   // n_load, load_second
+   static size_t n_load(void)
+   {  return load_count(); }
+   static double load_second(void)
+   {  return double( load_nanosecond() ) * 1e-9; }
+   //
+   // n_record, record_second
+   static size_t n_record(void)
+   {  return record_count(); }
+   static double record_second(void)
+   {  return double( record_nanosecond() ) * 1e-9; }
+   //
+   // setup
+   template <class Record>
+   static void setup(
+      CppAD::ADFun<double>& tape         ,
+      const std::string&    tape_name    ,
+      const std::string&    algo_name    ,
+      size_t                algo_version ,
+      const option_t&       option       ,
+      Record                record       )
+   {  //
+      // string, path
+      using std::string;
+      using std::filesystem::path;
+      //
+      // t_start
+      auto t_start = std::chrono::steady_clock::now();
+      //
+      // record
+      if( option.tape_load != "file" )
+      {  record(tape);
+         record_nanosecond() += elapsed(t_start);
+         ++record_count();
+         return;
+      }
+      //
+      // key_text
+      std::stringstream ss;
+      ss << tape_name << " " << algo_name
+         << " algo_version=" << algo_version
+         << " n_arg=" << option.n_arg
+         << " n_other=" << option.n_other
+         << " time_setup=" << option.time_setup
+         << " data_mode=" << option.data_mode
+         << " format_version=" << format_version
+         << " cppad=" << CPPAD_PACKAGE_STRING << "\n";
+      string key_text = ss.str();
+      //
+      // cache_dir
+      path cache_dir = cache_path();
+      std::error_code ec;
+      std::filesystem::create_directories(cache_dir, ec);
+      //
+      // tape_cache
+      string stem     = tape_name + "_" + hash_key(key_text);
+      path tape_cache = cache_dir / (stem + ".json");
+      //
+      // load
+      string contents = read_file(tape_cache);
+      if( contents.compare(0, key_text.size(), key_text) == 0 )
+      {  tape.from_json( contents.substr( key_text.size() ) );
+         load_nanosecond() += elapsed(t_start);
+         ++load_count();
+         return;
+      }
+      //
+      // record
+      record(tape);
+      record_nanosecond() += elapsed(t_start);
+      ++record_count();
+      //
+      // save_dir
+      // the file is moved to the cache, so it does not matter that
+      // save_dir is removed when this routine returns
+      cmpad::private_dir save_dir("cmpad_tape");
+      //
+      // tape_file
+      path tape_file = save_dir.path() / (stem + ".json");
+      std::ofstream ofs;
+      ofs.open(tape_file, std::ofstream::out);
+      ofs << key_text << tape.to_json();
+      ofs.close();
+      //
+      // tape_cache
+      std::filesystem::rename(tape_file, tape_cache, ec);
+      if( ec )
+      {  std::cerr << "cppad::tape_file::setup: err_msg = ";
+         std::cerr << ec.message() << "\n";
+      }
+   }
+};
+
+} } // END cmpad::cppad namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_VJP_HPP
+# define CMPAD_CPPAD_VJP_HPP
+/*
+{xrst_begin cppad_vjp.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/vjp.xrst
+   @Package@       , CppAD
+   @#######@       , #####
+   @package@       , cppad
+}
+
+Method
+******
+The function is recorded once during setup.
+The weight vectors times the Jacobian are computed using
+one zero order forward sweep at *x* ,
+followed by a first order reverse sweep for each of the *q* weight vectors.
+The CppAD ``Reverse`` function carries one weight vector per sweep,
+so the zero order forward sweep is shared by the *q* reverse sweeps.
+
+{xrst_end cppad_vjp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+# include <cmpad/vjp.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppad { // BEGIN cmpad::cppad namespace
+
+// cmpad::cppad::vjp
+template < template<class ADVector> class Algo> class vjp
+: public
+::cmpad::vjp {
+public:
+   //
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef ::cmpad::vector<scalar_type> vector_type;
+   //
+private:
+   // ADVector
+   typedef typename ::cmpad::vector< CppAD::AD<scalar_type> >  ADVector;
+   //
+   // option_
+   option_t                      option_;
+   //
+   // algo_
+   Algo<ADVector>                algo_;
+   //
+   // x_, w_, dw_
+   vector_type                   x_;
+   vector_type                   w_;
+   vector_type                   dw_;
+   //
+   // tape_
+   CppAD::ADFun<scalar_type>     tape_;
+   //
+   // Z_
+   vector_type                   Z_;
+   //
+public:
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m, q
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t q = option.n_direction;
+      //
+      // x_, w_
+      x_.resize(n);
+      w_.resize(m);
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape_
+      ADVector ax(n);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = 0.;
+      CppAD::Independent(ax);
+      ADVector ay = algo_(ax);
+      tape_.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape_.optimize(optimize_options);
+      //
+      // Z_
+      Z_.resize(q * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() + option_.n_direction * algo_.range(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return option_.n_direction * algo_.domain(); };
+   //
+   // operator
+   const vector_type& operator()(const vector_type& xw) override
+   {  //
+      // n, m, q
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t q = option_.n_direction;
+      assert( xw.size() == n + q * m );
+      //
+      // x_
+      for(size_t j = 0; j < n; ++j)
+         x_[j] = xw[j];
+      //
+      // tape_
+      tape_.Forward(0, x_);
+      //
+      // Z_
+      for(size_t k = 0; k < q; ++k)
+      {  for(size_t i = 0; i < m; ++i)
+            w_[i] = xw[n + k * m + i];
+         dw_ = tape_.Reverse(1, w_);
+         for(size_t j = 0; j < n; ++j)
+            Z_[k * n + j] = dw_[j];
+      }
+      //
+      return Z_;
+   }
+};
+
+} } // END cmpad::cppad namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
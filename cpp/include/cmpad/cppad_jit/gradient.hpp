@@ -20,28 +20,54 @@
    @not_codi@      , true
 }
 
+{xrst_toc_hidden
+   cpp/include/cmpad/cppad_jit/jit_function.hpp
+}
+jit_function
+************
+The compiling and linking is done by :ref:`cppad_jit_function.hpp-name` .
+
+tape_load
+*********
+The gradient function that is compiled is recorded, or loaded from a file,
+by :ref:`cppad_tape_file.hpp-name` ; see :ref:`option_t@tape_load` .
+
+data_mode
+*********
+If :ref:`option_t@data_mode` is ``dynamic`` , the
+:ref:`cpp_fun_obj@Data` for the algorithm are extra arguments to the
+compiled function and ``set_data`` only changes their values.
+Otherwise, the data are constants and ``set_data`` records the
+gradient again and compiles it again.
+As in ``setup`` , the recording is optimized if and only if
+:ref:`option_t@time_setup` is false.
+These compiles do not use the :ref:`cppad_jit_function.hpp@Cache`
+(even if :ref:`option_t@jit_load` is ``cache`` ),
+because each new data value would add a dll to the cache.
+
+setup_copy
+**********
+| |tab| *copy* ``.setup_copy`` ( *grad* )
+
+If *grad* has been setup, this sets up *copy* so that it
+computes the same gradient as *grad* without recording or compiling.
+The two objects use the same dll; see :ref:`cppad_jit_function.hpp@copy` .
+This is used by :ref:`cpp_batch_thread-name` to give each of its
+threads a copy of a gradient that was setup once.
+
 {xrst_end cppad_jit_gradient.hpp}
 */
 // BEGIN C++
 # if CMPAD_HAS_CPPAD
 
-# include <filesystem>
+# include <typeinfo>
 # include <cmpad/gradient.hpp>
 # include <cmpad/cppad/cppad.hpp>
-
-# ifdef _WIN32
-# define CMPAD_DLL_EXT ".dll"
-# else
-# define CMPAD_DLL_EXT ".so"
-# endif
+# include <cmpad/cppad/tape_file.hpp>
+# include <cmpad/cppad_jit/jit_function.hpp>
 
 namespace cmpad { namespace cppad_jit { // BEGIN cmpad::cppad_jit namespace
 
-static_assert(
-   CPPAD_C_COMPILER_GNU_FLAGS || CPPAD_C_COMPILER_MSVC_FLAGS,
-   "C compiler does not use same flags as GNU or MCVC"
-);
-
 // cmpad::cppad_jit::gradient
 template < template<class ADVector> class Algo > class gradient
 : public
@@ -61,21 +87,75 @@ private:
    // g_
    cmpad::vector<double>             g_;
    //
-   // dll_linker_
-   // grad_cppad_jit_ is only valid for life of dll_linker_.
-   CppAD::link_dll_lib*              dll_linker_;
+   // data_
+   // current value of the algorithm data
+   cmpad::vector<double>             data_;
+   //
+   // xd_
+   // argument to the compiled function; i.e., x followed by data_
+   // when data_mode is dynamic and just x otherwise
+   cmpad::vector<double>             xd_;
    //
    // grad_cppad_jit_
-   CppAD::jit_double                 grad_cppad_jit_;
+   jit_function                      grad_cppad_jit_;
+   //
+   // record
+   // record the gradient corresponding to algo_ and data_ in tapeg
+   void record(CppAD::ADFun<double>& tapeg, bool optimize)
+   {  //
+      // n, m, n_xd
+      size_t n    = algo_.domain();
+      size_t m    = algo_.range();
+      size_t n_xd = xd_.size();
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // axd, ax, ay, az, aw, ag, adata
+      ADVector axd(n_xd), ax(n), ay(1), az, aw(1), ag(n);
+      ADVector adata( data_.size() );
+      //
+      // tapef
+      CppAD::ADFun<double> tapef;
+      for(size_t i = 0; i < n_xd; ++i)
+         axd[i] = xd_[i];
+      CppAD::Independent(axd);
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = axd[i];
+      for(size_t k = 0; k < data_.size(); ++k)
+      {  if( n < n_xd )
+            adata[k] = axd[n + k];
+         else
+            adata[k] = data_[k];
+      }
+      algo_.set_data(adata);
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tapef.Dependent(axd, ay);
+      if( optimize )
+         tapef.optimize(optimize_options);
+      //
+      // atapef
+      CppAD::ADFun< ADScalar, double > atapef;
+      atapef = tapef.base2ad();
+      //
+      // axd, aw
+      CppAD::Independent(axd);
+      aw[0] = ADScalar( 1.0 );
+      //
+      // tapeg
+      // the derivative with respect to the data is not a result
+      atapef.Forward(0, axd);
+      ADVector agd = atapef.Reverse(1, aw);
+      for(size_t i = 0; i < n; ++i)
+         ag[i] = agd[i];
+      tapeg.Dependent(axd, ag);
+      if( optimize )
+         tapeg.optimize(optimize_options);
+   }
 //
 public:
-   // ctor, dtor
-   gradient(void)
-   {  dll_linker_ = nullptr; }
-   ~gradient(void)
-   {  if( dll_linker_ != nullptr )
-         delete dll_linker_;
-   }
    // scalar_type
    typedef double scalar_type;
    //
@@ -100,147 +180,99 @@ public:
       // n
       size_t n = algo_.domain();
       //
-      // m
-      size_t m = algo_.range();
-      //
       // g_
       g_.resize(n);
       //
-      // ax, ay, az, aw
-      ADVector ax(n), ay(1), az, aw(1), ag(n);
-      //
-      // function_name
-      string function_name = "grad_cppad_jit";
-      //
-      // optimize_options
-      std::string optimize_options =
-      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      // data_
+      // the default data values are constants
+      ADVector adata = algo_.data();
+      data_.resize( adata.size() );
+      for(size_t k = 0; k < adata.size(); ++k)
+         data_[k] = CppAD::Value( adata[k] );
       //
-      // tapef
-      CppAD::ADFun<double> tapef;
+      // xd_
+      if( option.data_mode == "dynamic" )
+         xd_.resize(n + data_.size());
+      else
+         xd_.resize(n);
       for(size_t i = 0; i < n; ++i)
-         ax[i] = 0.;
-      CppAD::Independent(ax);
-      az    = algo_(ax);
-      ay[0] = az[m-1];
-      tapef.Dependent(ax, ay);
-      if( ! option.time_setup )
-         tapef.optimize(optimize_options);
+         xd_[i] = 0.0;
+      for(size_t i = n; i < xd_.size(); ++i)
+         xd_[i] = data_[i - n];
       //
-      // atapef
-      CppAD::ADFun< ADScalar, double > atapef;
-      atapef = tapef.base2ad();
-      //
-      // ax, aw
-      CppAD::Independent(ax);
-      aw[0] = ADScalar( 1.0 );
+      // function_name
+      string function_name = "grad_cppad_jit";
       //
       // tapeg
-      atapef.Forward(0, ax);
-      ag = atapef.Reverse(1, aw);
+      auto record_tape = [&](CppAD::ADFun<double>& tapeg)
+      {  record(tapeg, ! option.time_setup); };
       CppAD::ADFun<double> tapeg;
-      tapeg.Dependent(ax, ag);
-      tapeg.function_name_set(function_name);
-      if( ! option.time_setup )
-         tapeg.optimize(optimize_options);
-      //
-      // path
-      using std::filesystem::path;
-      //
-      // original_path
-      path original_path = std::filesystem::current_path();
-      //
-      // current_path
-      path temp_path = std::filesystem::temp_directory_path();
-      std::filesystem::current_path(temp_path);
-      //
-      // csrc_file
-      string type = "double";
-      string csrc_file = function_name + ".c";
-      std::ofstream ofs;
-      ofs.open(csrc_file, std::ofstream::out);
-      tapeg.to_csrc(ofs, type);
-      ofs.close();
-      //
-      // dll_file
-      string  dll_file = function_name + CMPAD_DLL_EXT;
-      cmpad::vector<string> csrc_files = {csrc_file};
-      std::map< string, string > dll_options;
-# if CMPAD_COMPILER_IS_MSVC
-      dll_options["compile"] = "cl /EHs /EHc /c /LD /TC /O2";
-# endif
-# if CMPAD_COMPILER_IS_GNU
-# ifndef NDEBUG
-      dll_options["compile"] = "gcc -c -g -fPIC";
-# else
-      dll_options["compile"] = "gcc -c -O2 -fPIC";
-# endif
-# endif
-# if CMPAD_COMPILER_IS_CLANG
-# ifndef NDEBUG
-      dll_options["compile"] = "clang -c -g -fPIC";
-# else
-      dll_options["compile"] = "clang -c -O2 -fPIC";
-# endif
-# endif
-      string err_msg =
-         CppAD::create_dll_lib(dll_file, csrc_files, dll_options);
-      if( err_msg != "" )
-      {  std::cerr << "cppad_jit::gradient::setup: err_msg = ";
-         std::cerr << err_msg << "\n";
-         dll_file = "";
-      }
-      //
-      if( dll_file != "" )
-      {  std::filesystem::path path = std::filesystem::current_path();
-         path /= dll_file;
-         dll_file = path.string();
-      }
-      //
-      // dll_linker_
-      if( dll_linker_ != nullptr )
-         delete dll_linker_;
-      if( dll_file != "" )
-      {  dll_linker_ = new CppAD::link_dll_lib(dll_file, err_msg);
-         if( err_msg != "" )
-         {  std::cerr << "cppad_jit::gradient::setup: err_msg = ";
-            std::cerr << err_msg << "\n";
-            if( dll_linker_ != nullptr )
-               delete dll_linker_;
-            dll_linker_ = nullptr;
-         }
-      }
+      cmpad::cppad::tape_file::setup(
+         tapeg, function_name, typeid(algo_).name(),
+         cmpad::cppad::algo_version<Algo>::value, option, record_tape
+      );
       //
       // grad_cppad_jit_
-      void* void_ptr = nullptr;
-      if( dll_linker_ != nullptr )
-      {  void_ptr = (*dll_linker_)("cppad_jit_" + function_name, err_msg);
-         if( err_msg != "" )
-         {  std::cerr << "cppad_jit::gradient::setup: err_msg = ";
-            std::cerr << err_msg << "\n";
-            void_ptr = nullptr;
-         }
-      }
-      grad_cppad_jit_ = reinterpret_cast<CppAD::jit_double>(void_ptr);
-      //
-      // current_path
-      std::filesystem::current_path(original_path);
+      grad_cppad_jit_.setup(tapeg, function_name, option);
+   }
+   //
+   // setup_copy
+   void setup_copy(const gradient& grad)
+   {  option_ = grad.option_;
+      algo_.setup(option_);
+      g_              = grad.g_;
+      data_           = grad.data_;
+      xd_             = grad.xd_;
+      grad_cppad_jit_ = grad.grad_cppad_jit_;
    }
    // domain
    size_t domain(void) const override
    {  return algo_.domain(); };
    //
+   // n_data
+   size_t n_data(void) const override
+   {  return data_.size(); }
+   //
+   // data
+   vector_type data(void) const override
+   {  return data_; }
+   //
+   // set_data
+   // if data_mode is dynamic, only the data arguments change,
+   // otherwise the gradient is recorded (optimized as in setup) and compiled
+   // again.
+   void set_data(const vector_type& data) override
+   {  assert( data.size() == data_.size() );
+      data_ = data;
+      size_t n = domain();
+      if( option_.data_mode == "dynamic" )
+      {  for(size_t k = 0; k < data_.size(); ++k)
+            xd_[n + k] = data_[k];
+      }
+      else
+      {  CppAD::ADFun<double> tapeg;
+         record(tapeg, ! option_.time_setup);
+         //
+         // option
+         // each new data value is a new dll, so do not put it in the cache
+         option_t option = option_;
+         if( option.jit_load == "cache" )
+            option.jit_load = "file";
+         grad_cppad_jit_.setup(tapeg, "grad_cppad_jit", option);
+      }
+   }
+   //
    // operator
    const cmpad::vector<double>& operator()(
       const cmpad::vector<double>& x
    ) override
-   {  size_t n              = domain();
-      size_t compare_change = 0;
+   {  size_t n = domain();
       assert( x.size() == n );
       assert( g_.size() == n );
       //
-      grad_cppad_jit_(n, x.data(), n, g_.data(), &compare_change);
-      assert( compare_change == 0 );
+      for(size_t i = 0; i < n; ++i)
+         xd_[i] = x[i];
+      grad_cppad_jit_(xd_.size(), xd_.data(), n, g_.data());
       return g_;
    }
 };
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_JIT_HESSIAN_HPP
+# define CMPAD_CPPAD_JIT_HESSIAN_HPP
+/*
+{xrst_begin cppad_jit_hessian.hpp}
+{xrst_spell
+   dll
+   ext
+}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian.xrst
+   @Package@       , CppAD Jit
+   @#######@       , #########
+   @package@       , cppad_jit
+}
+
+Method
+******
+The function is recorded during setup.
+The Hessian of the recording is then computed using CppAD,
+recorded as a function of *x* , and compiled using
+:ref:`cppad_jit_function.hpp-name` .
+
+Side Effect
+***********
+If :ref:`option_t@jit_load` is ``cache`` ,
+this routine uses the following files in the
+:ref:`cppad_jit_function.hpp@Cache` directory:
+
+   ``hes_cppad_jit_``\ *key*\ ``.``\ *ext*
+
+were *key* is the cache key and
+*ext* is the file extension for C source files and dll object files.
+Different objects can be setup at the same time in different threads;
+see :ref:`cppad_jit_function.hpp@Threads` .
+
+{xrst_end cppad_jit_hessian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+
+# include <cmpad/hessian.hpp>
+# include <cmpad/cppad/cppad.hpp>
+# include <cmpad/cppad_jit/jit_function.hpp>
+
+namespace cmpad { namespace cppad_jit { // BEGIN cmpad::cppad_jit namespace
+
+// cmpad::cppad_jit::hessian
+template < template<class ADVector> class Algo > class hessian
+: public
+cmpad::hessian {
+private:
+   //
+   // ADScalar, ADVector
+   typedef CppAD::AD<double>       ADScalar;
+   typedef cmpad::vector<ADScalar> ADVector;
+   //
+   // option_
+   option_t                          option_;
+   //
+   // algo_
+   Algo<ADVector>                    algo_;
+   //
+   // h_
+   cmpad::vector<double>             h_;
+   //
+   // hes_cppad_jit_
+   jit_function                      hes_cppad_jit_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // h_
+      h_.resize(n * n);
+      //
+      // ax, ay, az, aw, ah
+      ADVector ax(n), ay(1), az, aw(1), ah(n * n);
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tapef
+      CppAD::ADFun<double> tapef;
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = 0.;
+      CppAD::Independent(ax);
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tapef.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tapef.optimize(optimize_options);
+      //
+      // atapef
+      CppAD::ADFun< ADScalar, double > atapef;
+      atapef = tapef.base2ad();
+      //
+      // ax, aw
+      CppAD::Independent(ax);
+      aw[0] = ADScalar( 1.0 );
+      //
+      // tapeh
+      ah = atapef.Hessian(ax, aw);
+      CppAD::ADFun<double> tapeh;
+      tapeh.Dependent(ax, ah);
+      if( ! option.time_setup )
+         tapeh.optimize(optimize_options);
+      //
+      // hes_cppad_jit_
+      hes_cppad_jit_.setup(tapeh, "hes_cppad_jit", option);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  size_t n = domain();
+      assert( x.size() == n );
+      assert( h_.size() == n * n );
+      //
+      hes_cppad_jit_(n, x.data(), n * n, h_.data());
+      return h_;
+   }
+};
+
+} } // END cmpad::cppad_jit namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
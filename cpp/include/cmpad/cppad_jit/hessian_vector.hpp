@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_JIT_HESSIAN_VECTOR_HPP
+# define CMPAD_CPPAD_JIT_HESSIAN_VECTOR_HPP
+/*
+{xrst_begin cppad_jit_hessian_vector.hpp}
+{xrst_spell
+   dll
+   ext
+}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian_vector.xrst
+   @Package@       , CppAD Jit
+   @#######@       , #########
+   @package@       , cppad_jit
+}
+
+Method
+******
+The function is recorded during setup.
+The forward-over-reverse calculation of the Hessian times a vector
+is then recorded as a function of ( *x* , *v* ) and compiled using
+:ref:`cppad_jit_function.hpp-name` .
+
+Side Effect
+***********
+If :ref:`option_t@jit_load` is ``cache`` ,
+this routine uses the following files in the
+:ref:`cppad_jit_function.hpp@Cache` directory:
+
+   ``hvp_cppad_jit_``\ *key*\ ``.``\ *ext*
+
+were *key* is the cache key and
+*ext* is the file extension for C source files and dll object files.
+Different objects can be setup at the same time in different threads;
+see :ref:`cppad_jit_function.hpp@Threads` .
+
+{xrst_end cppad_jit_hessian_vector.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+
+# include <cmpad/hessian_vector.hpp>
+# include <cmpad/cppad/cppad.hpp>
+# include <cmpad/cppad_jit/jit_function.hpp>
+
+namespace cmpad { namespace cppad_jit { // BEGIN cmpad::cppad_jit namespace
+
+// cmpad::cppad_jit::hessian_vector
+template < template<class ADVector> class Algo > class hessian_vector
+: public
+cmpad::hessian_vector {
+private:
+   //
+   // ADScalar, ADVector
+   typedef CppAD::AD<double>       ADScalar;
+   typedef cmpad::vector<ADScalar> ADVector;
+   //
+   // option_
+   option_t                          option_;
+   //
+   // algo_
+   Algo<ADVector>                    algo_;
+   //
+   // hv_
+   cmpad::vector<double>             hv_;
+   //
+   // hvp_cppad_jit_
+   jit_function                      hvp_cppad_jit_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // hv_
+      hv_.resize(n);
+      //
+      // ax, ay, az, aw
+      ADVector ax(n), ay(1), az, aw(1);
+      //
+      // axv, av, adw, ahv
+      ADVector axv(2 * n), av(n), adw(2 * n), ahv(n);
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tapef
+      CppAD::ADFun<double> tapef;
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = 0.;
+      CppAD::Independent(ax);
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tapef.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tapef.optimize(optimize_options);
+      //
+      // atapef
+      CppAD::ADFun< ADScalar, double > atapef;
+      atapef = tapef.base2ad();
+      //
+      // axv, ax, av, aw
+      for(size_t i = 0; i < 2 * n; ++i)
+         axv[i] = 0.;
+      CppAD::Independent(axv);
+      for(size_t j = 0; j < n; ++j)
+      {  ax[j] = axv[j];
+         av[j] = axv[n + j];
+      }
+      aw[0] = ADScalar( 1.0 );
+      //
+      // tapehv
+      atapef.Forward(0, ax);
+      atapef.Forward(1, av);
+      adw = atapef.Reverse(2, aw);
+      for(size_t j = 0; j < n; ++j)
+         ahv[j] = adw[2 * j + 1];
+      CppAD::ADFun<double> tapehv;
+      tapehv.Dependent(axv, ahv);
+      if( ! option.time_setup )
+         tapehv.optimize(optimize_options);
+      //
+      // hvp_cppad_jit_
+      hvp_cppad_jit_.setup(tapehv, "hvp_cppad_jit", option);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return 2 * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  size_t n = algo_.domain();
+      assert( xv.size() == 2 * n );
+      assert( hv_.size() == n );
+      //
+      hvp_cppad_jit_(2 * n, xv.data(), n, hv_.data());
+      return hv_;
+   }
+};
+
+} } // END cmpad::cppad_jit namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_JIT_JACOBIAN_HPP
+# define CMPAD_CPPAD_JIT_JACOBIAN_HPP
+/*
+{xrst_begin cppad_jit_jacobian.hpp}
+{xrst_spell
+   dll
+   ext
+}
+
+{xrst_template ,
+   cpp/include/cmpad/jacobian.xrst
+   @Package@       , CppAD Jit
+   @#######@       , #########
+   @package@       , cppad_jit
+}
+
+Method
+******
+The function is recorded during setup.
+The Jacobian calculation, using the forward or reverse sweeps
+specified by the mode, is then recorded as a function of *x*
+and compiled using :ref:`cppad_jit_function.hpp-name` .
+
+forward
+=======
+One first order forward sweep is recorded for each column of the Jacobian.
+
+reverse
+=======
+One first order reverse sweep is recorded for each row of the Jacobian.
+
+Side Effect
+***********
+If :ref:`option_t@jit_load` is ``cache`` ,
+this routine uses the following files in the
+:ref:`cppad_jit_function.hpp@Cache` directory:
+
+   ``jac_cppad_jit_``\ *key*\ ``.``\ *ext*
+
+were *key* is the cache key and
+*ext* is the file extension for C source files and dll object files.
+Different objects can be setup at the same time in different threads;
+see :ref:`cppad_jit_function.hpp@Threads` .
+
+{xrst_end cppad_jit_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+
+# include <cmpad/jacobian.hpp>
+# include <cmpad/cppad/cppad.hpp>
+# include <cmpad/cppad_jit/jit_function.hpp>
+
+namespace cmpad { namespace cppad_jit { // BEGIN cmpad::cppad_jit namespace
+
+// cmpad::cppad_jit::jacobian
+template < template<class ADVector> class Algo > class jacobian
+: public
+cmpad::jacobian {
+private:
+   //
+   // ADScalar, ADVector
+   typedef CppAD::AD<double>       ADScalar;
+   typedef cmpad::vector<ADScalar> ADVector;
+   //
+   // option_
+   option_t                          option_;
+   //
+   // algo_
+   Algo<ADVector>                    algo_;
+   //
+   // J_
+   cmpad::vector<double>             J_;
+   //
+   // jac_cppad_jit_
+   jit_function                      jac_cppad_jit_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // mode
+      choose_mode(m, n);
+      //
+      // J_
+      J_.resize(m * n);
+      //
+      // ax, ay, adx, ady, aw, adw, aJ
+      ADVector ax(n), ay, adx(n), ady, aw(m), adw, aJ(m * n);
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tapef
+      CppAD::ADFun<double> tapef;
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = 0.;
+      CppAD::Independent(ax);
+      ay = algo_(ax);
+      tapef.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tapef.optimize(optimize_options);
+      //
+      // atapef
+      CppAD::ADFun< ADScalar, double > atapef;
+      atapef = tapef.base2ad();
+      //
+      // adx, aw
+      for(size_t j = 0; j < n; ++j)
+         adx[j] = 0.0;
+      for(size_t i = 0; i < m; ++i)
+         aw[i] = 0.0;
+      //
+      // aJ
+      CppAD::Independent(ax);
+      atapef.Forward(0, ax);
+      if( mode() == "forward" )
+      {  for(size_t j = 0; j < n; ++j)
+         {  adx[j] = 1.0;
+            ady    = atapef.Forward(1, adx);
+            adx[j] = 0.0;
+            for(size_t i = 0; i < m; ++i)
+               aJ[i * n + j] = ady[i];
+         }
+      }
+      else
+      {  for(size_t i = 0; i < m; ++i)
+         {  aw[i] = 1.0;
+            adw   = atapef.Reverse(1, aw);
+            aw[i] = 0.0;
+            for(size_t j = 0; j < n; ++j)
+               aJ[i * n + j] = adw[j];
+         }
+      }
+      //
+      // tapeJ
+      CppAD::ADFun<double> tapeJ;
+      tapeJ.Dependent(ax, aJ);
+      if( ! option.time_setup )
+         tapeJ.optimize(optimize_options);
+      //
+      // jac_cppad_jit_
+      jac_cppad_jit_.setup(tapeJ, "jac_cppad_jit", option);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  size_t n = algo_.domain();
+      size_t m = algo_.range();
+      assert( x.size() == n );
+      assert( J_.size() == m * n );
+      //
+      jac_cppad_jit_(n, x.data(), m * n, J_.data());
+      return J_;
+   }
+};
+
+} } // END cmpad::cppad_jit namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
@@ -0,0 +1,726 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_JIT_JIT_FUNCTION_HPP
+# define CMPAD_CPPAD_JIT_JIT_FUNCTION_HPP
+/*
+{xrst_begin cppad_jit_function.hpp}
+{xrst_spell
+   cloexec
+   dir
+   dll
+   fd
+   fnv
+   memfd
+   mfd
+   nx
+   ny
+   pid
+   proc
+}
+
+Compile and Link a CppAD Function
+#################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/cppad_jit/jit_function.hpp>``
+| |tab| ``cmpad::cppad_jit::jit_function`` *jit*
+| |tab| *jit* ``.setup`` ( *tape* , *function_name* , *option* )
+| |tab| *jit* ( *nx* , *x* , *ny* , *y* )
+| |tab| ``cmpad::cppad_jit::jit_function`` *copy* ( *jit* )
+
+Purpose
+*******
+This is used by the cppad_jit derivatives to convert a CppAD function
+to C source code, compile it, and link it in.
+
+tape
+****
+This ``CppAD::ADFun<double>`` object is the function that is compiled.
+Its function name is set to *function_name* .
+
+function_name
+*************
+This ``std::string`` is the name of the function in the dll.
+
+option
+******
+This :ref:`option_t-name` object is the setup options for the
+derivative that uses *jit* .
+Only its *jit_load* , *n_split* , and *jit_flags* fields are used.
+
+jit_load
+========
+If :ref:`option_t@jit_load` is ``file`` ,
+the C source is written to a file in a :ref:`cpp_private_dir-name` ,
+compiled using ``CppAD::create_dll_lib`` , and linked in.
+The directory is removed at the end of setup; i.e.,
+every setup compiles and no files are left in the temporary directory.
+
+If *jit_load* is ``cache`` , the C source is compiled as for ``file``
+and the dll is stored in the `Cache`_ ,
+or it is linked in from the cache without compiling.
+
+If *jit_load* is ``memory`` , the cache is not used.
+The C source is piped to the standard input of the C compiler,
+which writes the dll to a ``memfd_create`` file using the name
+``/proc/``\ *pid*\ ``/fd/``\ *fd* , where *pid* is this process id,
+and the dll is loaded using the name ``/proc/self/fd/``\ *fd* .
+The memory file is created with ``MFD_CLOEXEC`` , so the compilers
+started by other threads do not inherit it.
+The memory file is closed when the dll is no longer loaded.
+(The C compiler still uses its temporary directory for the object
+file that it passes to the linker.)
+This is only available on Linux with the gcc or clang compilers.
+
+n_split
+=======
+If :ref:`option_t@n_split` is greater than one,
+the range of *tape* is split into *n_split* contiguous blocks
+(or *ny* blocks if *ny* is less than *n_split* ).
+The function for each block is recorded and optimized separately,
+converted to its own C source code, and compiled to its own dll.
+The dlls are compiled at the same time using one thread for each block.
+Hence the compiler runs on smaller functions, and on more cores,
+at the cost of the operations that the blocks have in common being
+repeated in each block.
+The function name for block *p* is *function_name*\ ``_``\ *p* .
+
+jit_flags
+=========
+If :ref:`option_t@jit_flags` is empty, the C compiler flags are
+``-O2`` (``-g`` if ``NDEBUG`` is not defined); ``/O2`` for MSVC.
+Otherwise *jit_flags* replaces these flags.
+The compile command, and hence *jit_flags* , is part of the `Cache`_ key.
+
+Cache
+*****
+The cache is only used when *jit_load* is ``cache`` .
+The compiled dll files are cached in the directory
+
+   *temp_dir*\ ``/cmpad_jit_cache``
+
+where *temp_dir* is the C++ temporary directory.
+The cache key is a 64 bit FNV-1a hash of the C source code for *tape*
+and the compile command.
+If the dll for the key is already in the cache
+(and the C source code in the cache is the same),
+it is linked in without compiling; i.e., a cache hit.
+Otherwise the source is compiled in a :ref:`cpp_private_dir-name`
+and the results are renamed to the cache file names; i.e., a cache miss.
+Renaming is atomic, so concurrent processes that use the same cache
+do not see partially written files.
+
+Eviction
+========
+The modification time of a cached dll is set to the current time
+when it is added to the cache and when it is a cache hit.
+When a dll is added to the cache,
+and there are more than *cache_max* = 100 dlls in the cache,
+the least recently used dlls (and their C source files) are removed.
+The source is removed first, so a partially removed entry is a cache miss.
+
+cache_hit, cache_miss
+=====================
+| |tab| *n_hit* = ``cmpad::cppad_jit::jit_function::cache_hit`` ()
+| |tab| *n_miss* = ``cmpad::cppad_jit::jit_function::cache_miss`` ()
+
+These ``size_t`` values are the number of cache hits and misses
+by all the jit_function objects in this process.
+A setup with *jit_load* not equal to ``cache`` is neither a hit nor a miss.
+If *n_split* is greater than one, each block is a hit or miss.
+
+compile_byte, compile_second
+============================
+| |tab| *n_byte* = ``cmpad::cppad_jit::jit_function::compile_byte`` ()
+| |tab| *second* = ``cmpad::cppad_jit::jit_function::compile_second`` ()
+
+The ``size_t`` value *n_byte* is the total number of bytes of C source code
+that was compiled (not linked in from the cache)
+by all the jit_function objects in this process.
+The ``double`` value *second* is the total wall clock time,
+for all the setups, from the start of the first compile
+to the end of the last compile in each setup.
+
+Errors
+******
+If the C compiler fails, the dll can not be linked in, or the function
+can not be found in the dll, setup prints an error message on ``std::cerr``
+and the program exits with status one.
+Hence *jit* never calls a function that was not compiled.
+
+Threads
+*******
+All the file names used by setup are absolute, the memory files have
+different file descriptors, and the current working directory is not changed.
+Hence different *jit* objects can be setup at the same time
+in different threads.
+Recording the *tape* in parallel mode requires
+:ref:`cppad_parallel_setup.hpp-name` .
+
+copy
+****
+A copy of *jit* links to the same dlls as *jit* ; i.e.,
+it does not compile or link anything.
+The dlls stay linked in (and their memory files stay open) until
+the last object that uses them is destroyed or setup again.
+Different objects that use the same dlls can be evaluated at the same time
+in different threads.
+
+nx, x
+*****
+is the size and values of the argument to the function.
+
+ny, y
+*****
+is the size of the result of the function.
+The input values of the elements of *y* do not matter.
+Upon return they are the function values corresponding to *x* .
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end cppad_jit_function.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+
+# include <algorithm>
+# include <atomic>
+# include <cassert>
+# include <chrono>
+# include <cstdint>
+# include <cstdio>
+# include <cstdlib>
+# include <filesystem>
+# include <fstream>
+# include <iostream>
+# include <map>
+# include <memory>
+# include <sstream>
+# include <string>
+# include <thread>
+# include <utility>
+# include <vector>
+# include <cmpad/vector.hpp>
+# include <cmpad/option_t.hpp>
+# include <cmpad/private_dir.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+# ifdef __linux__
+# include <sys/mman.h>
+# include <unistd.h>
+# endif
+
+# ifdef _WIN32
+# define CMPAD_DLL_EXT ".dll"
+# else
+# define CMPAD_DLL_EXT ".so"
+# endif
+
+namespace cmpad { namespace cppad_jit { // BEGIN cmpad::cppad_jit namespace
+
+static_assert(
+   CPPAD_C_COMPILER_GNU_FLAGS || CPPAD_C_COMPILER_MSVC_FLAGS,
+   "C compiler does not use same flags as GNU or MCVC"
+);
+
+// cmpad::cppad_jit::jit_function
+class jit_function {
+private:
+   //
+   // dll_t
+   // the dlls that are linked in and their memory files
+   struct dll_t {
+      //
+      // linker
+      cmpad::vector<CppAD::link_dll_lib*> linker;
+      //
+      // fd
+      // fd[p] is the memory file that contains dll p, -1 if there is no
+      // such file. It stays open while the dll is loaded because its name
+      // is only valid while it is open.
+      cmpad::vector<int>                  fd;
+      //
+      // dtor
+      // unload the dlls and then close their memory files
+      ~dll_t(void)
+      {  for(size_t p = 0; p < linker.size(); ++p)
+            delete linker[p];
+# ifdef __linux__
+         for(size_t p = 0; p < fd.size(); ++p)
+         {  if( fd[p] >= 0 )
+               ::close(fd[p]);
+         }
+# endif
+      }
+   };
+   //
+   // dll_
+   // fun_[p] is only valid for life of dll_; dll_ is shared by the copies
+   std::shared_ptr<dll_t>              dll_;
+   //
+   // fun_
+   // fun_[p] computes the components of y from begin_[p] to begin_[p+1]-1
+   cmpad::vector<CppAD::jit_double>    fun_;
+   //
+   // begin_
+   cmpad::vector<size_t>               begin_;
+   //
+   // hit_count, miss_count
+   static std::atomic<size_t>& hit_count(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   static std::atomic<size_t>& miss_count(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   //
+   // byte_count, nanosecond_count
+   static std::atomic<size_t>& byte_count(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   static std::atomic<size_t>& nanosecond_count(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   //
+   // cache_max
+   // maximum number of dlls in the cache
+   static constexpr size_t cache_max = 100;
+   //
+   // hash_key
+   // 64 bit FNV-1a hash of text as a hexadecimal string
+   static std::string hash_key(const std::string& text)
+   {  uint64_t hash = 14695981039346656037ULL;
+      for(char c : text)
+      {  hash ^= uint64_t( static_cast<unsigned char>(c) );
+         hash *= 1099511628211ULL;
+      }
+      std::stringstream ss;
+      ss << std::hex << hash;
+      return ss.str();
+   }
+   //
+   // read_file
+   // contents of a file, empty if it cannot be read
+   static std::string read_file(const std::filesystem::path& file)
+   {  std::ifstream ifs(file, std::ifstream::in);
+      std::stringstream ss;
+      if( ifs.good() )
+         ss << ifs.rdbuf();
+      return ss.str();
+   }
+   //
+   // split_csrc
+   // C source code for the function that computes the components of
+   // the range of tape from begin to end-1
+   static std::string split_csrc(
+      CppAD::ADFun<double>& tape          ,
+      const std::string&    function_name ,
+      size_t                begin         ,
+      size_t                end           )
+   {  //
+      // ADScalar, ADVector
+      typedef CppAD::AD<double>       ADScalar;
+      typedef cmpad::vector<ADScalar> ADVector;
+      //
+      // nx
+      size_t nx = tape.Domain();
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // atape
+      CppAD::ADFun<ADScalar, double> atape = tape.base2ad();
+      //
+      // part
+      // optimizing removes the operations that are not needed for this part
+      ADVector ax(nx), ay, ay_part(end - begin);
+      for(size_t j = 0; j < nx; ++j)
+         ax[j] = 0.0;
+      CppAD::Independent(ax);
+      ay = atape.Forward(0, ax);
+      for(size_t i = begin; i < end; ++i)
+         ay_part[i - begin] = ay[i];
+      CppAD::ADFun<double> part;
+      part.Dependent(ax, ay_part);
+      part.optimize(optimize_options);
+      part.function_name_set(function_name);
+      //
+      // csrc
+      std::stringstream ss;
+      part.to_csrc(ss, "double");
+      return ss.str();
+   }
+   //
+   // evict
+   // remove the least recently used dlls, and their source files,
+   // so that there are at most cache_max dlls in the cache
+   static void evict(const std::filesystem::path& cache_path)
+   {  //
+      // path, file_time_type
+      using std::filesystem::path;
+      using std::filesystem::file_time_type;
+      //
+      // dll_list
+      std::error_code ec;
+      std::vector< std::pair<file_time_type, path> > dll_list;
+      std::filesystem::directory_iterator itr(cache_path, ec);
+      for( ; ! ec && itr != std::filesystem::directory_iterator(); ++itr)
+      {  path file = itr->path();
+         if( file.extension() == CMPAD_DLL_EXT )
+         {  file_time_type time = itr->last_write_time(ec);
+            if( ! ec )
+               dll_list.push_back( {time, file} );
+         }
+      }
+      if( dll_list.size() <= cache_max )
+         return;
+      //
+      // remove
+      // oldest first; the source first so a partial entry is a miss
+      std::sort( dll_list.begin(), dll_list.end() );
+      size_t n_remove = dll_list.size() - cache_max;
+      for(size_t i = 0; i < n_remove; ++i)
+      {  path dll_file  = dll_list[i].second;
+         path csrc_file = dll_file;
+         csrc_file.replace_extension(".c");
+         std::filesystem::remove(csrc_file, ec);
+         std::filesystem::remove(dll_file, ec);
+      }
+   }
+   //
+   // file_dll
+   // compile csrc in build_path and return the name of the dll file,
+   // empty if an error occurred. If cache is true, the dll is linked in
+   // from the cache, or moved to the cache after it is compiled.
+   static std::string file_dll(
+      const std::string&           function_name ,
+      const std::string&           csrc          ,
+      const std::string&           flags         ,
+      const std::filesystem::path& build_path    ,
+      bool                         cache         )
+   {  //
+      // string, path
+      using std::string;
+      using std::filesystem::path;
+      //
+      // dll_options
+      std::map< string, string > dll_options;
+# if CMPAD_COMPILER_IS_MSVC
+      dll_options["compile"] = "cl /EHs /EHc /c /LD /TC " + flags;
+# endif
+# if CMPAD_COMPILER_IS_GNU
+      dll_options["compile"] = "gcc -c -fPIC " + flags;
+# endif
+# if CMPAD_COMPILER_IS_CLANG
+      dll_options["compile"] = "clang -c -fPIC " + flags;
+# endif
+      //
+      // stem
+      string stem = function_name + "_" +
+         hash_key( dll_options["compile"] + "\n" + csrc );
+      //
+      // cache_path, csrc_cache, dll_cache
+      path cache_path, csrc_cache, dll_cache;
+      std::error_code ec;
+      if( cache )
+      {  cache_path = std::filesystem::absolute(
+            std::filesystem::temp_directory_path()
+         ) / "cmpad_jit_cache";
+         std::filesystem::create_directories(cache_path, ec);
+         csrc_cache = cache_path / (stem + ".c");
+         dll_cache  = cache_path / (stem + CMPAD_DLL_EXT);
+         //
+         // hit
+         // The dll is renamed into the cache before the source,
+         // so if the cached source is complete, so is the cached dll.
+         bool hit = read_file(csrc_cache) == csrc;
+         hit     &= std::filesystem::exists(dll_cache);
+         if( hit )
+         {  ++hit_count();
+            std::filesystem::last_write_time(
+               dll_cache, std::filesystem::file_time_type::clock::now(), ec
+            );
+            return dll_cache.string();
+         }
+         ++miss_count();
+      }
+      byte_count() += csrc.size();
+      //
+      // csrc_file
+      path csrc_file = build_path / (stem + ".c");
+      std::ofstream ofs;
+      ofs.open(csrc_file, std::ofstream::out);
+      ofs << csrc;
+      ofs.close();
+      //
+      // dll_unique
+      path dll_unique = build_path / (stem + CMPAD_DLL_EXT);
+      cmpad::vector<string> csrc_files = { csrc_file.string() };
+      string err_msg = CppAD::create_dll_lib(
+         dll_unique.string(), csrc_files, dll_options
+      );
+      if( err_msg != "" )
+      {  std::cerr << "cppad_jit::jit_function::setup: err_msg = ";
+         std::cerr << err_msg << "\n";
+         return "";
+      }
+      if( ! cache )
+         return dll_unique.string();
+      //
+      // dll_cache
+      std::filesystem::rename(dll_unique, dll_cache, ec);
+      if( ! ec )
+         std::filesystem::rename(csrc_file, csrc_cache, ec);
+      if( ec )
+      {  std::cerr << "cppad_jit::jit_function::setup: err_msg = ";
+         std::cerr << ec.message() << "\n";
+         return "";
+      }
+      std::filesystem::last_write_time(
+         dll_cache, std::filesystem::file_time_type::clock::now(), ec
+      );
+      evict(cache_path);
+      return dll_cache.string();
+   }
+   //
+   // memory_dll
+   // compile csrc into a memory file and return the name of the dll file,
+   // empty if an error occurred. The memory file descriptor is returned
+   // in fd (-1 if there is no memory file).
+   static std::string memory_dll(
+      const std::string& function_name ,
+      const std::string& csrc          ,
+      const std::string& flags         ,
+      int&               fd            )
+   {  fd = -1;
+# if ! defined(__linux__) || CMPAD_COMPILER_IS_MSVC
+      std::cerr << "cppad_jit::jit_function::setup: err_msg = ";
+      std::cerr << "jit_load = memory is not available on this system\n";
+      return "";
+# else
+      //
+      // string
+      using std::string;
+      //
+      // fd
+      // This file is closed on exec, so compilers that other threads start
+      // do not inherit it. The compiler writes to it using this process id.
+      fd = ::memfd_create( function_name.c_str(), MFD_CLOEXEC );
+      if( fd < 0 )
+      {  std::cerr << "cppad_jit::jit_function::setup: err_msg = ";
+         std::cerr << "memfd_create failed\n";
+         return "";
+      }
+      byte_count() += csrc.size();
+      //
+      // dll_file, out_file
+      string dll_file = "/proc/self/fd/" + std::to_string(fd);
+      string out_file = "/proc/" + std::to_string( ::getpid() ) +
+         "/fd/" + std::to_string(fd);
+      //
+      // command
+      // The source is read from standard input and the dll is written
+      // directly to the memory file.
+# if CMPAD_COMPILER_IS_GNU
+      string command = "gcc " + flags;
+# else
+      string command = "clang " + flags;
+# endif
+      command += " -fPIC -shared -pipe -x c - -o " + out_file;
+      //
+      // status
+      int status = -1;
+      FILE* pipe = ::popen( command.c_str(), "w" );
+      if( pipe != nullptr )
+      {  size_t n_write = std::fwrite(csrc.data(), 1, csrc.size(), pipe);
+         status         = ::pclose(pipe);
+         if( n_write != csrc.size() )
+            status = -1;
+      }
+      if( status != 0 )
+      {  std::cerr << "cppad_jit::jit_function::setup: err_msg = ";
+         std::cerr << "the command\n" << command << "\nfailed\n";
+         ::close(fd);
+         fd = -1;
+         return "";
+      }
+      return dll_file;
+# endif
+   }
+//
+public:
+   // ctor
+   jit_function(void)
+   { }
+   // a copy shares the dlls
+   jit_function(const jit_function&)            = default;
+   jit_function& operator=(const jit_function&) = default;
+   //
+   // cache_hit, cache_miss
+   static size_t cache_hit(void)
+   {  return hit_count(); }
+   static size_t cache_miss(void)
+   {  return miss_count(); }
+   //
+   // compile_byte, compile_second
+   static size_t compile_byte(void)
+   {  return byte_count(); }
+   static double compile_second(void)
+   {  return double( nanosecond_count() ) * 1e-9; }
+   //
+   // setup
+   void setup(
+      CppAD::ADFun<double>& tape          ,
+      const std::string&    function_name ,
+      const option_t&       option        )
+   {  //
+      // string
+      using std::string;
+      //
+      // n_part
+      size_t ny     = tape.Range();
+      size_t n_part = std::max( size_t(1), std::min(option.n_split, ny) );
+      //
+      // begin_
+      begin_.resize(n_part + 1);
+      for(size_t p = 0; p <= n_part; ++p)
+         begin_[p] = (p * ny) / n_part;
+      //
+      // part_name, csrc
+      cmpad::vector<string> part_name(n_part), csrc(n_part);
+      if( n_part == 1 )
+      {  part_name[0] = function_name;
+         tape.function_name_set(function_name);
+         std::stringstream ss;
+         tape.to_csrc(ss, "double");
+         csrc[0] = ss.str();
+      }
+      else
+      {  for(size_t p = 0; p < n_part; ++p)
+         {  part_name[p] = function_name + "_" + std::to_string(p);
+            csrc[p]      = split_csrc(
+               tape, part_name[p], begin_[p], begin_[p+1]
+            );
+         }
+      }
+      //
+      // flags
+      string flags = option.jit_flags;
+      if( flags == "" )
+      {
+# if CMPAD_COMPILER_IS_MSVC
+         flags = "/O2";
+# elif defined(NDEBUG)
+         flags = "-O2";
+# else
+         flags = "-g";
+# endif
+      }
+      //
+      // build_dir
+      // the dlls are linked in before these directories are removed
+      std::vector< std::unique_ptr<cmpad::private_dir> > build_dir(n_part);
+      //
+      // dll_file, fd
+      // part p is compiled by thread p - 1, part 0 by this thread
+      cmpad::vector<string> dll_file(n_part);
+      cmpad::vector<int>    fd(n_part, -1);
+      auto compile = [&](size_t p)
+      {  if( option.jit_load == "memory" )
+            dll_file[p] = memory_dll(part_name[p], csrc[p], flags, fd[p]);
+         else
+         {  build_dir[p].reset( new cmpad::private_dir("cmpad_jit") );
+            bool cache  = option.jit_load == "cache";
+            dll_file[p] = file_dll(
+               part_name[p], csrc[p], flags, build_dir[p]->path(), cache
+            );
+         }
+      };
+      auto t_start = std::chrono::steady_clock::now();
+      cmpad::vector<std::thread> thread;
+      for(size_t p = 1; p < n_part; ++p)
+         thread.emplace_back(compile, p);
+      compile(0);
+      for(size_t t = 0; t < thread.size(); ++t)
+         thread[t].join();
+      auto t_end = std::chrono::steady_clock::now();
+      nanosecond_count() += size_t( std::chrono::duration_cast<
+         std::chrono::nanoseconds >(t_end - t_start).count()
+      );
+      //
+      // dll_, fun_
+      // the previous dlls are unloaded, and their files are closed,
+      // when they are not used by a copy of this object
+      dll_.reset( new dll_t );
+      dll_->linker.resize(n_part);
+      dll_->fd = fd;
+      fun_.resize(n_part);
+      cmpad::vector<CppAD::link_dll_lib*>& linker = dll_->linker;
+      for(size_t p = 0; p < n_part; ++p)
+      {  //
+         // linker
+         string err_msg = "";
+         linker[p] = nullptr;
+         if( dll_file[p] != "" )
+         {  linker[p] = new CppAD::link_dll_lib(dll_file[p], err_msg);
+            if( err_msg != "" )
+            {  std::cerr << "cppad_jit::jit_function::setup: err_msg = ";
+               std::cerr << err_msg << "\n";
+               delete linker[p];
+               linker[p] = nullptr;
+            }
+         }
+         //
+         // fun_
+         void* void_ptr = nullptr;
+         if( linker[p] != nullptr )
+         {  void_ptr = (*linker[p])(
+               "cppad_jit_" + part_name[p], err_msg
+            );
+            if( err_msg != "" )
+            {  std::cerr << "cppad_jit::jit_function::setup: err_msg = ";
+               std::cerr << err_msg << "\n";
+               void_ptr = nullptr;
+            }
+         }
+         fun_[p] = reinterpret_cast<CppAD::jit_double>(void_ptr);
+         //
+         // check for an error in the compile, link, or symbol lookup
+         if( fun_[p] == nullptr )
+         {  std::cerr << "cppad_jit::jit_function::setup: could not create "
+                      << "cppad_jit_" << part_name[p] << "\n";
+            std::exit(1);
+         }
+      }
+   }
+   //
+   // operator
+   void operator()(size_t nx, const double* x, size_t ny, double* y)
+   {  assert( ny == begin_[ fun_.size() ] );
+      for(size_t p = 0; p < fun_.size(); ++p)
+      {  size_t compare_change = 0;
+         size_t ny_p           = begin_[p+1] - begin_[p];
+         assert( fun_[p] != nullptr );
+         fun_[p](nx, x, ny_p, y + begin_[p], &compare_change);
+         assert( compare_change == 0 );
+      }
+   }
+};
+
+} } // END cmpad::cppad_jit namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_JIT_JVP_HPP
+# define CMPAD_CPPAD_JIT_JVP_HPP
+/*
+{xrst_begin cppad_jit_jvp.hpp}
+{xrst_spell
+   dll
+   ext
+   jvp
+}
+
+{xrst_template ,
+   cpp/include/cmpad/jvp.xrst
+   @Package@       , CppAD Jit
+   @#######@       , #########
+   @package@       , cppad_jit
+}
+
+Method
+******
+The function is recorded during setup.
+The zero order forward sweep,
+and the first order forward sweep that carries all *p* directions,
+are then recorded as a function of ( *x* , *V* ) and compiled using
+:ref:`cppad_jit_function.hpp-name` .
+
+Side Effect
+***********
+If :ref:`option_t@jit_load` is ``cache`` ,
+this routine uses the following files in the
+:ref:`cppad_jit_function.hpp@Cache` directory:
+
+   ``jvp_cppad_jit_``\ *key*\ ``.``\ *ext*
+
+were *key* is the cache key and
+*ext* is the file extension for C source files and dll object files.
+Different objects can be setup at the same time in different threads;
+see :ref:`cppad_jit_function.hpp@Threads` .
+
+{xrst_end cppad_jit_jvp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+
+# include <cmpad/jvp.hpp>
+# include <cmpad/cppad/cppad.hpp>
+# include <cmpad/cppad_jit/jit_function.hpp>
+
+namespace cmpad { namespace cppad_jit { // BEGIN cmpad::cppad_jit namespace
+
+// cmpad::cppad_jit::jvp
+template < template<class ADVector> class Algo > class jvp
+: public
+cmpad::jvp {
+private:
+   //
+   // ADScalar, ADVector
+   typedef CppAD::AD<double>       ADScalar;
+   typedef cmpad::vector<ADScalar> ADVector;
+   //
+   // option_
+   option_t                          option_;
+   //
+   // algo_
+   Algo<ADVector>                    algo_;
+   //
+   // Y_
+   cmpad::vector<double>             Y_;
+   //
+   // jvp_cppad_jit_
+   jit_function                      jvp_cppad_jit_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m, p
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t p = option.n_direction;
+      //
+      // Y_
+      Y_.resize(m * p);
+      //
+      // ax, ay, axv, aV, aY
+      ADVector ax(n), ay, axv(n * (1 + p)), aV(n * p), aY;
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tapef
+      CppAD::ADFun<double> tapef;
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = 0.;
+      CppAD::Independent(ax);
+      ay = algo_(ax);
+      tapef.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tapef.optimize(optimize_options);
+      //
+      // atapef
+      CppAD::ADFun< ADScalar, double > atapef;
+      atapef = tapef.base2ad();
+      //
+      // axv, ax, aV
+      for(size_t k = 0; k < n * (1 + p); ++k)
+         axv[k] = 0.;
+      CppAD::Independent(axv);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = axv[j];
+      for(size_t k = 0; k < n * p; ++k)
+         aV[k] = axv[n + k];
+      //
+      // tapeY
+      atapef.Forward(0, ax);
+      aY = atapef.Forward(1, p, aV);
+      CppAD::ADFun<double> tapeY;
+      tapeY.Dependent(axv, aY);
+      if( ! option.time_setup )
+         tapeY.optimize(optimize_options);
+      //
+      // jvp_cppad_jit_
+      jvp_cppad_jit_.setup(tapeY, "jvp_cppad_jit", option);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() * (1 + option_.n_direction); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * option_.n_direction; };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t p = option_.n_direction;
+      assert( xv.size() == n * (1 + p) );
+      assert( Y_.size() == m * p );
+      //
+      jvp_cppad_jit_(n * (1 + p), xv.data(), m * p, Y_.data());
+      return Y_;
+   }
+};
+
+} } // END cmpad::cppad_jit namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
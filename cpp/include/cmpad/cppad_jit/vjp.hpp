@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPAD_JIT_VJP_HPP
+# define CMPAD_CPPAD_JIT_VJP_HPP
+/*
+{xrst_begin cppad_jit_vjp.hpp}
+{xrst_spell
+   dll
+   ext
+   vjp
+}
+
+{xrst_template ,
+   cpp/include/cmpad/vjp.xrst
+   @Package@       , CppAD Jit
+   @#######@       , #########
+   @package@       , cppad_jit
+}
+
+Method
+******
+The function is recorded during setup.
+The zero order forward sweep,
+and the first order reverse sweep for each of the *q* weight vectors,
+are then recorded as one function of ( *x* , *W* ) and compiled using
+:ref:`cppad_jit_function.hpp-name` .
+Optimizing this recording shares the forward sweep
+between the weight vectors.
+
+Side Effect
+***********
+If :ref:`option_t@jit_load` is ``cache`` ,
+this routine uses the following files in the
+:ref:`cppad_jit_function.hpp@Cache` directory:
+
+   ``vjp_cppad_jit_``\ *key*\ ``.``\ *ext*
+
+were *key* is the cache key and
+*ext* is the file extension for C source files and dll object files.
+Different objects can be setup at the same time in different threads;
+see :ref:`cppad_jit_function.hpp@Threads` .
+
+{xrst_end cppad_jit_vjp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPAD
+
+# include <cmpad/vjp.hpp>
+# include <cmpad/cppad/cppad.hpp>
+# include <cmpad/cppad_jit/jit_function.hpp>
+
+namespace cmpad { namespace cppad_jit { // BEGIN cmpad::cppad_jit namespace
+
+// cmpad::cppad_jit::vjp
+template < template<class ADVector> class Algo > class vjp
+: public
+cmpad::vjp {
+private:
+   //
+   // ADScalar, ADVector
+   typedef CppAD::AD<double>       ADScalar;
+   typedef cmpad::vector<ADScalar> ADVector;
+   //
+   // option_
+   option_t                          option_;
+   //
+   // algo_
+   Algo<ADVector>                    algo_;
+   //
+   // Z_
+   cmpad::vector<double>             Z_;
+   //
+   // vjp_cppad_jit_
+   jit_function                      vjp_cppad_jit_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m, q
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t q = option.n_direction;
+      //
+      // Z_
+      Z_.resize(q * n);
+      //
+      // ax, ay, axw, aw, adw, aZ
+      ADVector ax(n), ay, axw(n + q * m), aw(m), adw, aZ(q * n);
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tapef
+      CppAD::ADFun<double> tapef;
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = 0.;
+      CppAD::Independent(ax);
+      ay = algo_(ax);
+      tapef.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tapef.optimize(optimize_options);
+      //
+      // atapef
+      CppAD::ADFun< ADScalar, double > atapef;
+      atapef = tapef.base2ad();
+      //
+      // axw, ax
+      for(size_t k = 0; k < n + q * m; ++k)
+         axw[k] = 0.;
+      CppAD::Independent(axw);
+      for(size_t j = 0; j < n; ++j)
+         ax[j] = axw[j];
+      //
+      // aZ
+      atapef.Forward(0, ax);
+      for(size_t k = 0; k < q; ++k)
+      {  for(size_t i = 0; i < m; ++i)
+            aw[i] = axw[n + k * m + i];
+         adw = atapef.Reverse(1, aw);
+         for(size_t j = 0; j < n; ++j)
+            aZ[k * n + j] = adw[j];
+      }
+      //
+      // tapeZ
+      CppAD::ADFun<double> tapeZ;
+      tapeZ.Dependent(axw, aZ);
+      if( ! option.time_setup )
+         tapeZ.optimize(optimize_options);
+      //
+      // vjp_cppad_jit_
+      vjp_cppad_jit_.setup(tapeZ, "vjp_cppad_jit", option);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() + option_.n_direction * algo_.range(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return option_.n_direction * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xw
+   ) override
+   {  size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t q = option_.n_direction;
+      assert( xw.size() == n + q * m );
+      assert( Z_.size() == q * n );
+      //
+      vjp_cppad_jit_(n + q * m, xw.data(), q * n, Z_.data());
+      return Z_;
+   }
+};
+
+} } // END cmpad::cppad_jit namespace
+
+# endif // CMPAD_HAS_CPPAD
+// END C++
+# endif
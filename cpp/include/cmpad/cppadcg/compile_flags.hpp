@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPADCG_COMPILE_FLAGS_HPP
+# define CMPAD_CPPADCG_COMPILE_FLAGS_HPP
+/*
+{xrst_begin cppadcg_compile_flags.hpp}
+
+Set the Compile Flags for a CppADCodeGen Compiler
+#################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/cppadcg/compile_flags.hpp>``
+| |tab| ``cmpad::cppadcg::compile_flags`` ( *compiler* , *option* )
+
+compiler
+********
+This is the ``CppAD::cg::GccCompiler<double>`` or
+``CppAD::cg::ClangCompiler<double>`` object that the cppadcg derivatives
+use to compile the source code they generate.
+
+option
+******
+If :ref:`option_t@jit_flags` is empty, *compiler* is not changed
+and it uses the CppADCodeGen default flags.
+Otherwise, the flags in *jit_flags* (separated by white space)
+replace the flags that *compiler* uses to compile the source files.
+The flags that it uses to link the library are not changed.
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end cppadcg_compile_flags.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPADCG
+
+# include <sstream>
+# include <string>
+# include <vector>
+# include <cmpad/option_t.hpp>
+# include <cmpad/cppad/cppad.hpp>
+
+namespace cmpad { namespace cppadcg { // BEGIN cmpad::cppadcg namespace
+
+template <class Compiler>
+void compile_flags(Compiler& compiler, const option_t& option)
+{  if( option.jit_flags == "" )
+      return;
+   //
+   // flags
+   std::stringstream        ss( option.jit_flags );
+   std::vector<std::string> flags;
+   std::string              flag;
+   while( ss >> flag )
+      flags.push_back(flag);
+   //
+   // compiler
+   compiler.setCompileFlags(flags);
+}
+
+} } // END cmpad::cppadcg namespace
+
+# endif // CMPAD_HAS_CPPADCG
+// END C++
+# endif
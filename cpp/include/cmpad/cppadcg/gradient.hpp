@@ -19,14 +19,49 @@
    @not_codi@      , true
 }
 
+{xrst_toc_hidden
+   cpp/include/cmpad/cppadcg/compile_flags.hpp
+}
+compile_flags
+*************
+The C compiler flags are set by :ref:`cppadcg_compile_flags.hpp-name` .
+
+n_split
+*******
+If :ref:`option_t@n_split` is greater than one,
+the maximum number of assignments in each generated function is
+the number of variables in the tape divided by *n_split* .
+CppADCodeGen splits the gradient into functions that satisfy this limit,
+each in its own source file.
+This reduces the time that the compiler spends on each function,
+but the files are compiled one at a time.
+
+setup_copy
+**********
+| |tab| *copy* ``.setup_copy`` ( *grad* )
+
+If *grad* has been setup, this sets up *copy* so that it
+computes the same gradient as *grad* without recording or compiling.
+The two objects use the same dynamic library,
+which stays loaded until both objects are destroyed or setup again,
+and each object has its own model in the library.
+Creating or destroying a model changes the list of models in the library,
+so this must not be done at the same time as creating or destroying
+another object that uses the same library.
+This is used by :ref:`cpp_batch_thread-name` to give each of its
+threads a copy of a gradient that was setup once.
+
 {xrst_end cppadcg_gradient.hpp}
 */
 // BEGIN C++
 # if CMPAD_HAS_CPPADCG
 
 # include <filesystem>
+# include <memory>
 # include <cmpad/gradient.hpp>
 # include <cmpad/cppad/cppad.hpp>
+# include <cmpad/private_dir.hpp>
+# include <cmpad/cppadcg/compile_flags.hpp>
 
 namespace cmpad { namespace cppadcg { // BEGIN cmpad::cppadcg namespace
 //
@@ -50,7 +85,8 @@ private:
    cmpad::vector<double>                              w_;
    //
    // dynamic_lib_
-   std::unique_ptr< CppAD::cg::DynamicLib<double> >   dynamic_lib_;
+   // shared by the copies of this gradient
+   std::shared_ptr< CppAD::cg::DynamicLib<double> >   dynamic_lib_;
    //
    // model_
    std::unique_ptr< CppAD::cg::GenericModel<double> > model_;
@@ -108,34 +144,52 @@ public:
       if( ! option.time_setup )
          tape.optimize(optimize_options);
       //
-      // path
-      using std::filesystem::path;
+      // build_dir
+      // private directory for the generated files; the library stays
+      // loaded after build_dir removes them at the end of setup
+      cmpad::private_dir build_dir("cmpad_cppadcg");
       //
-      // original_path
-      path original_path = std::filesystem::current_path();
-      //
-      // current_path
-      path temp_path = std::filesystem::temp_directory_path();
-      std::filesystem::current_path(temp_path);
+      // compiler
+      compiler.setTemporaryFolder( (build_dir.path() / "temp").string() );
+      compiler.setSourcesFolder( (build_dir.path() / "sources").string() );
+      cmpad::cppadcg::compile_flags(compiler, option);
       //
       // cgen
       CppAD::cg::ModelCSourceGen<double> cgen(tape, "model");
       cgen.setCreateJacobian(true);
+      if( option.n_split > 1 )
+         cgen.setMaxAssignmentsPerFunc( tape.size_var() / option.n_split + 1 );
       //
       // libcgen
       CppAD::cg::ModelLibraryCSourceGen<double> libcgen(cgen);
       //
       // dynamic_lib_
-      CppAD::cg::DynamicModelLibraryProcessor<double> proc(libcgen);
+      std::string library_name = (build_dir.path() / "model").string();
+      CppAD::cg::DynamicModelLibraryProcessor<double> proc(
+         libcgen, library_name
+      );
+      //
+      // the previous model is destroyed before its library
+      model_       = nullptr;
       dynamic_lib_ = nullptr;
       dynamic_lib_ = proc.createDynamicLibrary(compiler);
       //
       // model_
-      model_ = nullptr;
       model_ = dynamic_lib_->model("model");
+   }
+   //
+   // setup_copy
+   void setup_copy(const gradient& grad)
+   {  option_ = grad.option_;
+      algo_.setup(option_);
+      w_     = grad.w_;
+      g_     = grad.g_;
       //
-      // current_path
-      std::filesystem::current_path(original_path);
+      // model_, dynamic_lib_
+      // the model for this object is destroyed before its library
+      model_       = nullptr;
+      dynamic_lib_ = grad.dynamic_lib_;
+      model_       = dynamic_lib_->model("model");
    }
    // domain
    size_t domain(void) const override
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPADCG_HESSIAN_HPP
+# define CMPAD_CPPADCG_HESSIAN_HPP
+/*
+{xrst_begin cppadcg_hessian.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian.xrst
+   @Package@       , CppAD CodeGen
+   @#######@       , #############
+   @package@       , cppadcg
+}
+
+Method
+******
+The function is recorded during setup and CppADCodeGen is used to
+generate, compile, and link source code for its Hessian.
+
+{xrst_end cppadcg_hessian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPADCG
+
+# include <filesystem>
+# include <cmpad/hessian.hpp>
+# include <cmpad/cppad/cppad.hpp>
+# include <cmpad/private_dir.hpp>
+# include <cmpad/cppadcg/compile_flags.hpp>
+
+namespace cmpad { namespace cppadcg { // BEGIN cmpad::cppadcg namespace
+//
+// cmpad::cppadcg::hessian
+template < template<class ADVector> class Algo> class hessian
+: public
+cmpad::hessian {
+private:
+   //
+   // Scalar, ADVector
+   typedef CppAD::cg::CG<double>                   Scalar;
+   typedef cmpad::vector< CppAD::AD<Scalar> >      ADVector;
+   //
+   // option_
+   option_t                                           option_;
+   //
+   // algo_
+   Algo<ADVector>                                     algo_;
+   //
+   // dynamic_lib_
+   std::unique_ptr< CppAD::cg::DynamicLib<double> >   dynamic_lib_;
+   //
+   // model_
+   std::unique_ptr< CppAD::cg::GenericModel<double> > model_;
+   //
+   // h_
+   cmpad::vector<double>                              h_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  // see https://github.com/joaoleal/CppADCodeGen/wiki/LibGeneration
+      //
+      // compiler
+# if CMPAD_COMPILER_IS_GNU
+      CppAD::cg::GccCompiler<double> compiler;
+# endif
+# if CMPAD_COMPILER_IS_CLANG
+      CppAD::cg::ClangCompiler<double> compiler;
+# endif
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape
+      CppAD::ADFun<Scalar>  tape;
+      ADVector ax(n);
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = 0.;
+      CppAD::Independent(ax);
+      ADVector ay(1), az;
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tape.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape.optimize(optimize_options);
+      //
+      // build_dir
+      // private directory for the generated files; the library stays
+      // loaded after build_dir removes them at the end of setup
+      cmpad::private_dir build_dir("cmpad_cppadcg");
+      //
+      // compiler
+      compiler.setTemporaryFolder( (build_dir.path() / "temp").string() );
+      compiler.setSourcesFolder( (build_dir.path() / "sources").string() );
+      cmpad::cppadcg::compile_flags(compiler, option);
+      //
+      // cgen
+      CppAD::cg::ModelCSourceGen<double> cgen(tape, "model");
+      cgen.setCreateHessian(true);
+      //
+      // libcgen
+      CppAD::cg::ModelLibraryCSourceGen<double> libcgen(cgen);
+      //
+      // dynamic_lib_
+      std::string library_name = (build_dir.path() / "model").string();
+      CppAD::cg::DynamicModelLibraryProcessor<double> proc(
+         libcgen, library_name
+      );
+      dynamic_lib_ = nullptr;
+      dynamic_lib_ = proc.createDynamicLibrary(compiler);
+      //
+      // model_
+      model_ = nullptr;
+      model_ = dynamic_lib_->model("model");
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  h_ = model_->Hessian(x, 0);
+      return h_;
+   }
+};
+
+} } // END cmpad::cppadcg namespace
+
+# endif // CMPAD_HAS_CPPADCG
+// END C++
+# endif
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPADCG_HESSIAN_VECTOR_HPP
+# define CMPAD_CPPADCG_HESSIAN_VECTOR_HPP
+/*
+{xrst_begin cppadcg_hessian_vector.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian_vector.xrst
+   @Package@       , CppAD CodeGen
+   @#######@       , #############
+   @package@       , cppadcg
+}
+
+Method
+******
+The function is recorded during setup and CppADCodeGen is used to
+generate, compile, and link source code for its second order reverse mode
+(``setCreateReverseTwo`` ).
+The Hessian times a vector is computed by the generated ``Reverse2``
+function with the first order Taylor coefficient of the argument equal to *v*
+and the zero order range weight equal to zero; i.e., forward-over-reverse.
+
+{xrst_end cppadcg_hessian_vector.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPADCG
+
+# include <cassert>
+# include <filesystem>
+# include <cmpad/hessian_vector.hpp>
+# include <cmpad/cppad/cppad.hpp>
+# include <cmpad/private_dir.hpp>
+# include <cmpad/cppadcg/compile_flags.hpp>
+
+namespace cmpad { namespace cppadcg { // BEGIN cmpad::cppadcg namespace
+//
+// cmpad::cppadcg::hessian_vector
+template < template<class ADVector> class Algo> class hessian_vector
+: public
+cmpad::hessian_vector {
+private:
+   //
+   // Scalar, ADVector
+   typedef CppAD::cg::CG<double>                   Scalar;
+   typedef cmpad::vector< CppAD::AD<Scalar> >      ADVector;
+   //
+   // option_
+   option_t                                           option_;
+   //
+   // algo_
+   Algo<ADVector>                                     algo_;
+   //
+   // dynamic_lib_
+   std::unique_ptr< CppAD::cg::DynamicLib<double> >   dynamic_lib_;
+   //
+   // model_
+   std::unique_ptr< CppAD::cg::GenericModel<double> > model_;
+   //
+   // tx_, ty_, py_
+   // Taylor coefficients for the argument and range, range weights
+   cmpad::vector<double>                              tx_;
+   cmpad::vector<double>                              ty_;
+   cmpad::vector<double>                              py_;
+   //
+   // px_, hv_
+   cmpad::vector<double>                              px_;
+   cmpad::vector<double>                              hv_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  // see https://github.com/joaoleal/CppADCodeGen/wiki/LibGeneration
+      //
+      // compiler
+# if CMPAD_COMPILER_IS_GNU
+      CppAD::cg::GccCompiler<double> compiler;
+# endif
+# if CMPAD_COMPILER_IS_CLANG
+      CppAD::cg::ClangCompiler<double> compiler;
+# endif
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape
+      CppAD::ADFun<Scalar>  tape;
+      ADVector ax(n);
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = 0.;
+      CppAD::Independent(ax);
+      ADVector ay(1), az;
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tape.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape.optimize(optimize_options);
+      //
+      // build_dir
+      // private directory for the generated files; the library stays
+      // loaded after build_dir removes them at the end of setup
+      cmpad::private_dir build_dir("cmpad_cppadcg");
+      //
+      // compiler
+      compiler.setTemporaryFolder( (build_dir.path() / "temp").string() );
+      compiler.setSourcesFolder( (build_dir.path() / "sources").string() );
+      cmpad::cppadcg::compile_flags(compiler, option);
+      //
+      // cgen
+      CppAD::cg::ModelCSourceGen<double> cgen(tape, "model");
+      cgen.setCreateReverseTwo(true);
+      //
+      // libcgen
+      CppAD::cg::ModelLibraryCSourceGen<double> libcgen(cgen);
+      //
+      // dynamic_lib_
+      std::string library_name = (build_dir.path() / "model").string();
+      CppAD::cg::DynamicModelLibraryProcessor<double> proc(
+         libcgen, library_name
+      );
+      dynamic_lib_ = nullptr;
+      dynamic_lib_ = proc.createDynamicLibrary(compiler);
+      //
+      // model_
+      model_ = nullptr;
+      model_ = dynamic_lib_->model("model");
+      //
+      // tx_, ty_, py_
+      // tx_[2*j] = x[j], tx_[2*j+1] = v[j], ty_ is not used,
+      // py_[0] = 0 weights the zero order and py_[1] = 1 the first order
+      tx_.resize(2 * n);
+      ty_.resize(2);
+      py_.resize(2);
+      ty_[0] = ty_[1] = 0.0;
+      py_[0] = 0.0;
+      py_[1] = 1.0;
+      //
+      // hv_
+      hv_.resize(n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return 2 * algo_.domain(); };
+   //
+   // operator
+   const vector_type& operator()(const vector_type& xv) override
+   {  //
+      // n
+      size_t n = algo_.domain();
+      assert( xv.size() == 2 * n );
+      //
+      // tx_
+      for(size_t j = 0; j < n; ++j)
+      {  tx_[2 * j]     = xv[j];
+         tx_[2 * j + 1] = xv[n + j];
+      }
+      //
+      // px_
+      // px_[2*j] is the partial of ( f'(x) v ) w.r.t. x_j
+      px_ = model_->Reverse2(tx_, ty_, py_);
+      //
+      // hv_
+      for(size_t j = 0; j < n; ++j)
+         hv_[j] = px_[2 * j];
+      //
+      return hv_;
+   }
+};
+
+} } // END cmpad::cppadcg namespace
+
+# endif // CMPAD_HAS_CPPADCG
+// END C++
+# endif
@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPADCG_SPARSE_HESSIAN_HPP
+# define CMPAD_CPPADCG_SPARSE_HESSIAN_HPP
+/*
+{xrst_begin cppadcg_sparse_hessian.hpp}
+
+{xrst_template ,
+   cpp/include/cmpad/sparse_hessian.xrst
+   @Package@       , CppAD CodeGen
+   @#######@       , #############
+   @package@       , cppadcg
+}
+
+Method
+******
+The function is recorded during setup and CppADCodeGen is used to
+generate, compile, and link source code for its sparse Hessian.
+CppADCodeGen computes the sparsity pattern, and the corresponding
+compressed evaluation, while it generates the source code.
+The non-zeros returned by the generated code are mapped to the
+upper triangle of the Hessian and converted to row major order.
+
+{xrst_end cppadcg_sparse_hessian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPADCG
+
+# include <filesystem>
+# include <algorithm>
+# include <cmpad/sparse_hessian.hpp>
+# include <cmpad/cppad/cppad.hpp>
+# include <cmpad/private_dir.hpp>
+# include <cmpad/cppadcg/compile_flags.hpp>
+
+namespace cmpad { namespace cppadcg { // BEGIN cmpad::cppadcg namespace
+//
+// cmpad::cppadcg::sparse_hessian
+template < template<class ADVector> class Algo> class sparse_hessian
+: public
+cmpad::sparse_hessian {
+private:
+   //
+   // Scalar, ADVector
+   typedef CppAD::cg::CG<double>                   Scalar;
+   typedef cmpad::vector< CppAD::AD<Scalar> >      ADVector;
+   //
+   // option_
+   option_t                                           option_;
+   //
+   // algo_
+   Algo<ADVector>                                     algo_;
+   //
+   // dynamic_lib_
+   std::unique_ptr< CppAD::cg::DynamicLib<double> >   dynamic_lib_;
+   //
+   // model_
+   std::unique_ptr< CppAD::cg::GenericModel<double> > model_;
+   //
+   // order_
+   // values_[ order_[k] ] corresponds to row_[k] and col_[k]
+   cmpad::vector<size_t>                              order_;
+   //
+   // row_, col_
+   cmpad::vector<size_t>                              row_;
+   cmpad::vector<size_t>                              col_;
+   //
+   // values_, row_cg_, col_cg_
+   // results in the order returned by the generated code
+   std::vector<double>                                values_;
+   std::vector<size_t>                                row_cg_;
+   std::vector<size_t>                                col_cg_;
+   //
+   // w_
+   std::vector<double>                                w_;
+   //
+   // H_
+   cmpad::vector<double>                              H_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  // see https://github.com/joaoleal/CppADCodeGen/wiki/LibGeneration
+      //
+      // compiler
+# if CMPAD_COMPILER_IS_GNU
+      CppAD::cg::GccCompiler<double> compiler;
+# endif
+# if CMPAD_COMPILER_IS_CLANG
+      CppAD::cg::ClangCompiler<double> compiler;
+# endif
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape
+      CppAD::ADFun<Scalar>  tape;
+      ADVector ax(n);
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = 0.;
+      CppAD::Independent(ax);
+      ADVector ay(1), az;
+      az    = algo_(ax);
+      ay[0] = az[m-1];
+      tape.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape.optimize(optimize_options);
+      //
+      // build_dir
+      // private directory for the generated files; the library stays
+      // loaded after build_dir removes them at the end of setup
+      cmpad::private_dir build_dir("cmpad_cppadcg");
+      //
+      // compiler
+      compiler.setTemporaryFolder( (build_dir.path() / "temp").string() );
+      compiler.setSourcesFolder( (build_dir.path() / "sources").string() );
+      cmpad::cppadcg::compile_flags(compiler, option);
+      //
+      // cgen
+      CppAD::cg::ModelCSourceGen<double> cgen(tape, "model");
+      cgen.setCreateSparseHessian(true);
+      //
+      // libcgen
+      CppAD::cg::ModelLibraryCSourceGen<double> libcgen(cgen);
+      //
+      // dynamic_lib_
+      std::string library_name = (build_dir.path() / "model").string();
+      CppAD::cg::DynamicModelLibraryProcessor<double> proc(
+         libcgen, library_name
+      );
+      dynamic_lib_ = nullptr;
+      dynamic_lib_ = proc.createDynamicLibrary(compiler);
+      //
+      // model_
+      model_ = nullptr;
+      model_ = dynamic_lib_->model("model");
+      //
+      // w_
+      w_.resize(1);
+      w_[0] = 1.0;
+      //
+      // values_, row_cg_, col_cg_
+      std::vector<double> x(n);
+      for(size_t j = 0; j < n; ++j)
+         x[j] = 0.0;
+      model_->SparseHessian(x, w_, values_, row_cg_, col_cg_);
+      //
+      // upper_row, upper_col
+      // the generated code may return an entry in the lower triangle
+      size_t nnz_cg = values_.size();
+      std::vector<size_t> upper_row(nnz_cg), upper_col(nnz_cg);
+      for(size_t k = 0; k < nnz_cg; ++k)
+      {  upper_row[k] = std::min(row_cg_[k], col_cg_[k]);
+         upper_col[k] = std::max(row_cg_[k], col_cg_[k]);
+      }
+      //
+      // order
+      cmpad::vector<size_t> order(nnz_cg);
+      for(size_t k = 0; k < nnz_cg; ++k)
+         order[k] = k;
+      std::sort( order.begin(), order.end(),
+         [&upper_row, &upper_col](size_t k1, size_t k2)
+         {  if( upper_row[k1] != upper_row[k2] )
+               return upper_row[k1] < upper_row[k2];
+            return upper_col[k1] < upper_col[k2];
+         }
+      );
+      //
+      // order_, row_, col_
+      // an entry and its transpose are only included once
+      order_.resize(0);
+      row_.resize(0);
+      col_.resize(0);
+      for(size_t k = 0; k < nnz_cg; ++k)
+      {  size_t r = upper_row[ order[k] ];
+         size_t c = upper_col[ order[k] ];
+         size_t nnz = row_.size();
+         bool   duplicate = false;
+         if( nnz > 0 )
+            duplicate = row_[nnz-1] == r && col_[nnz-1] == c;
+         if( ! duplicate )
+         {  order_.push_back( order[k] );
+            row_.push_back(r);
+            col_.push_back(c);
+         }
+      }
+      //
+      // H_
+      H_.resize( row_.size() );
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // row
+   const cmpad::vector<size_t>& row(void) const override
+   {  return row_; }
+   //
+   // col
+   const cmpad::vector<size_t>& col(void) const override
+   {  return col_; }
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  //
+      // values_
+      model_->SparseHessian(x, w_, values_, row_cg_, col_cg_);
+      //
+      // H_
+      for(size_t k = 0; k < H_.size(); ++k)
+         H_[k] = values_[ order_[k] ];
+      return H_;
+   }
+};
+
+} } // END cmpad::cppadcg namespace
+
+# endif // CMPAD_HAS_CPPADCG
+// END C++
+# endif
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CPPADCG_SPARSE_JACOBIAN_HPP
+# define CMPAD_CPPADCG_SPARSE_JACOBIAN_HPP
+/*
+{xrst_begin cppadcg_sparse_jacobian.hpp}
+{xrst_spell
+   nan
+}
+
+{xrst_template ,
+   cpp/include/cmpad/sparse_jacobian.xrst
+   @Package@       , CppAD CodeGen
+   @#######@       , #############
+   @package@       , cppadcg
+}
+
+Method
+******
+The function is recorded during setup and CppADCodeGen is used to
+generate, compile, and link source code for its sparse Jacobian.
+CppADCodeGen computes the sparsity pattern, and the corresponding
+compressed evaluation, while it generates the source code.
+Hence the :ref:`cpp_sparse_jacobian@sparsity_time` is nan.
+The order of the non-zeros returned by the generated code
+is converted to row major order.
+
+{xrst_end cppadcg_sparse_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_CPPADCG
+
+# include <filesystem>
+# include <algorithm>
+# include <cmpad/sparse_jacobian.hpp>
+# include <cmpad/cppad/cppad.hpp>
+# include <cmpad/private_dir.hpp>
+# include <cmpad/cppadcg/compile_flags.hpp>
+
+namespace cmpad { namespace cppadcg { // BEGIN cmpad::cppadcg namespace
+//
+// cmpad::cppadcg::sparse_jacobian
+template < template<class ADVector> class Algo> class sparse_jacobian
+: public
+cmpad::sparse_jacobian {
+private:
+   //
+   // Scalar, ADVector
+   typedef CppAD::cg::CG<double>                   Scalar;
+   typedef cmpad::vector< CppAD::AD<Scalar> >      ADVector;
+   //
+   // option_
+   option_t                                           option_;
+   //
+   // algo_
+   Algo<ADVector>                                     algo_;
+   //
+   // dynamic_lib_
+   std::unique_ptr< CppAD::cg::DynamicLib<double> >   dynamic_lib_;
+   //
+   // model_
+   std::unique_ptr< CppAD::cg::GenericModel<double> > model_;
+   //
+   // order_
+   // values_[ order_[k] ] corresponds to row_[k] and col_[k]
+   cmpad::vector<size_t>                              order_;
+   //
+   // row_, col_
+   cmpad::vector<size_t>                              row_;
+   cmpad::vector<size_t>                              col_;
+   //
+   // values_, row_cg_, col_cg_
+   // results in the order returned by the generated code
+   std::vector<double>                                values_;
+   std::vector<size_t>                                row_cg_;
+   std::vector<size_t>                                col_cg_;
+   //
+   // J_
+   cmpad::vector<double>                              J_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  // see https://github.com/joaoleal/CppADCodeGen/wiki/LibGeneration
+      //
+      // compiler
+# if CMPAD_COMPILER_IS_GNU
+      CppAD::cg::GccCompiler<double> compiler;
+# endif
+# if CMPAD_COMPILER_IS_CLANG
+      CppAD::cg::ClangCompiler<double> compiler;
+# endif
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n
+      size_t n = algo_.domain();
+      //
+      // m
+      size_t m = algo_.range();
+      //
+      // optimize_options
+      std::string optimize_options =
+      "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+      //
+      // tape
+      CppAD::ADFun<Scalar>  tape;
+      ADVector ax(n);
+      for(size_t i = 0; i < n; ++i)
+         ax[i] = 0.;
+      CppAD::Independent(ax);
+      ADVector ay = algo_(ax);
+      assert( ay.size() == m );
+      tape.Dependent(ax, ay);
+      if( ! option.time_setup )
+         tape.optimize(optimize_options);
+      //
+      // build_dir
+      // private directory for the generated files; the library stays
+      // loaded after build_dir removes them at the end of setup
+      cmpad::private_dir build_dir("cmpad_cppadcg");
+      //
+      // compiler
+      compiler.setTemporaryFolder( (build_dir.path() / "temp").string() );
+      compiler.setSourcesFolder( (build_dir.path() / "sources").string() );
+      cmpad::cppadcg::compile_flags(compiler, option);
+      //
+      // cgen
+      CppAD::cg::ModelCSourceGen<double> cgen(tape, "model");
+      cgen.setCreateSparseJacobian(true);
+      //
+      // libcgen
+      CppAD::cg::ModelLibraryCSourceGen<double> libcgen(cgen);
+      //
+      // dynamic_lib_
+      std::string library_name = (build_dir.path() / "model").string();
+      CppAD::cg::DynamicModelLibraryProcessor<double> proc(
+         libcgen, library_name
+      );
+      dynamic_lib_ = nullptr;
+      dynamic_lib_ = proc.createDynamicLibrary(compiler);
+      //
+      // model_
+      model_ = nullptr;
+      model_ = dynamic_lib_->model("model");
+      //
+      // values_, row_cg_, col_cg_
+      std::vector<double> x(n);
+      for(size_t j = 0; j < n; ++j)
+         x[j] = 0.0;
+      model_->SparseJacobian(x, values_, row_cg_, col_cg_);
+      //
+      // order_
+      size_t nnz = values_.size();
+      order_.resize(nnz);
+      for(size_t k = 0; k < nnz; ++k)
+         order_[k] = k;
+      const std::vector<size_t>& row_cg = row_cg_;
+      const std::vector<size_t>& col_cg = col_cg_;
+      std::sort( order_.begin(), order_.end(),
+         [&row_cg, &col_cg](size_t k1, size_t k2)
+         {  if( row_cg[k1] != row_cg[k2] )
+               return row_cg[k1] < row_cg[k2];
+            return col_cg[k1] < col_cg[k2];
+         }
+      );
+      //
+      // row_, col_
+      row_.resize(nnz);
+      col_.resize(nnz);
+      for(size_t k = 0; k < nnz; ++k)
+      {  row_[k] = row_cg_[ order_[k] ];
+         col_[k] = col_cg_[ order_[k] ];
+      }
+      //
+      // J_
+      J_.resize(nnz);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // row
+   const cmpad::vector<size_t>& row(void) const override
+   {  return row_; }
+   //
+   // col
+   const cmpad::vector<size_t>& col(void) const override
+   {  return col_; }
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  //
+      // values_
+      model_->SparseJacobian(x, values_, row_cg_, col_cg_);
+      //
+      // J_
+      for(size_t k = 0; k < J_.size(); ++k)
+         J_[k] = values_[ order_[k] ];
+      return J_;
+   }
+};
+
+} } // END cmpad::cppadcg namespace
+
+# endif // CMPAD_HAS_CPPADCG
+// END C++
+# endif
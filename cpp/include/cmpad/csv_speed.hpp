@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2023 Bradley M. Bell
+// SPDX-FileContributor: 2023-24 Bradley M. Bell
 // ---------------------------------------------------------------------------
 # ifndef CMPAD_CSV_SPEED_HPP
 # define CMPAD_CSV_SPEED_HPP
@@ -15,8 +15,10 @@ namespace cmpad {
       double             min_time  ,
       const std::string& package   ,
       const std::string& algorithm ,
+      const std::string& derivative,
       bool               special   ,
-      const option_t&    option
+      const option_t&    option    ,
+      double             rel_error
    );
 }
 
@@ -0,0 +1,563 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_DER_CHECK_HPP
+# define CMPAD_DER_CHECK_HPP
+/*
+{xrst_begin cpp_der_check}
+{xrst_spell
+   rel
+   tol
+   jvp
+   vjp
+}
+
+Check a C++ Derivative Before Timing It
+#######################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/der_check.hpp>``
+| |tab| *ok* = ``cmpad::der_check`` < *Algo* > (
+| |tab| |tab| *der* , *option* , *rel_tol* , *rel_error*
+| |tab| )
+| |tab| *ok* = ``cmpad::der_check`` < *Algo* > (
+| |tab| |tab| *der* , *grad* , *option* , *rel_tol* , *rel_error*
+| |tab| )
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+   // BEGIN SECOND_ORDER
+   // END SECOND_ORDER
+}
+
+Purpose
+*******
+This routine does the same job as :ref:`cpp_grad_check-name`
+for the derivatives that are not gradients; i.e.,
+a speed is only reported for derivatives that pass the check.
+
+Algo
+****
+This is the algorithm that *der* computes the derivative for; e.g.,
+:ref:`det_by_minor <cpp_det_by_minor-name>` .
+
+der
+***
+This is the derivative object that is checked.
+It is setup using *option* and it is derived from one of the following
+abstract classes:
+
+.. csv-table::
+   :widths: auto
+   :header-rows: 1
+
+   Class,                                Reference
+   :ref:`cpp_jacobian-name` ,            central differences of *Algo*
+   :ref:`cpp_jvp-name` ,                 central differences of *Algo*
+   :ref:`cpp_vjp-name` ,                 central differences of *Algo*
+   :ref:`cpp_sparse_jacobian-name` ,     central differences of *Algo*
+   :ref:`cpp_hessian-name` ,             central differences of *grad*
+   :ref:`cpp_hessian_vector-name` ,      central differences of *grad*
+   :ref:`cpp_sparse_hessian-name` ,      central differences of *grad*
+
+grad
+****
+This argument is only present (and must be present) when *der*
+is one of the second order derivatives.
+It is a :ref:`cpp_gradient-name` for *Algo* that uses the same package
+as *der* .
+It is first checked using :ref:`cpp_grad_check-name` ;
+if that check fails, *der* is not checked and *ok* is false.
+The reference second derivatives are central differences of *grad*
+(which are more accurate than second order differences of *Algo* ).
+
+option
+******
+This is the :ref:`option_t-name` used to setup *der* , *grad* ,
+and the ``none`` version of the algorithm.
+The arguments to *der* are the first values in the
+:ref:`uniform_01-name` stream corresponding to *option*\ ``.seed`` .
+The :ref:`cpp_fun_obj@Data` for the algorithm is not changed.
+
+Reference
+*********
+The reference derivative in direction *v* , at the point *x* ,
+is the fourth order central difference approximation
+
+.. math::
+
+   f^{(1)} (x) v \approx \frac{
+      - f( x + 2 h v ) + 8 f( x + h v )
+      - 8 f( x - h v ) + f( x - 2 h v )
+   }{ 12 h }
+
+where *f* is *Algo* or *grad* and
+:math:`h \| v \|_\infty = 10^{-3} \max( 1 , \| x \|_\infty )` .
+For the Jacobians and Hessians, *v* is an elementary vector
+and at most ``n_component`` columns are checked at each of
+``n_point`` points; see the source code.
+For the sparse derivatives, the entries that are not in the sparsity pattern
+are checked to be zero.
+For :ref:`cpp_jvp-name` and :ref:`cpp_hessian_vector-name` ,
+*v* is each of the directions in the argument to *der* .
+For :ref:`cpp_vjp-name` , the weight vectors are applied to the
+reference columns of the Jacobian.
+
+Non-Smooth Functions
+====================
+As in :ref:`cpp_grad_check@Reference@Non-Smooth Functions` ,
+the approximation is also computed with *h* replaced by :math:`2 h` ,
+components where the two do not agree to within *rel_tol* are skipped,
+and the check fails if more than one quarter of the candidates are skipped.
+
+rel_tol
+*******
+This is the relative tolerance used to check each component of the
+derivative using :ref:`cpp_near_equal-name` .
+The values of the reference for the corresponding column, or direction,
+are included in the scaling.
+
+rel_error
+*********
+The input value of this argument does not matter.
+Upon return, it is the maximum over the checked components of
+
+   | *d* [ *k* ] - *r* [ *k* ] | / *scale*
+
+where *d* is the derivative value, *r* is the reference value,
+and *scale* is the maximum of the absolute values of *d* [ *k* ]
+and the reference values for the column, or direction, that contains *k* .
+
+ok
+**
+is true (false) if *der* passed (failed) the check.
+
+{xrst_toc_hidden
+   cpp/xam/der_check.cpp
+}
+Example
+*******
+:ref:`xam_der_check.cpp-name` is an example and test of this routine.
+
+{xrst_end cpp_der_check}
+*/
+// BEGIN C++
+# include <cmath>
+# include <cassert>
+# include <limits>
+# include <iostream>
+# include <algorithm>
+# include <type_traits>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/option_t.hpp>
+# include <cmpad/grad_check.hpp>
+# include <cmpad/jacobian.hpp>
+# include <cmpad/jvp.hpp>
+# include <cmpad/vjp.hpp>
+# include <cmpad/sparse_jacobian.hpp>
+# include <cmpad/hessian.hpp>
+# include <cmpad/hessian_vector.hpp>
+# include <cmpad/sparse_hessian.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+namespace detail { // BEGIN cmpad::detail namespace
+
+// der_check_t
+// compares derivative values with central difference references
+class der_check_t {
+private:
+   // rel_tol_
+   const double rel_tol_;
+   //
+   // ok_, rel_error_
+   bool   ok_;
+   double rel_error_;
+   //
+   // n_skip_, n_candidate_
+   size_t n_skip_;
+   size_t n_candidate_;
+   //
+   // x_step_, y_plus_, diff_
+   cmpad::vector<double> x_step_, y_plus_, diff_[3];
+public:
+   // n_point, n_component
+   static constexpr size_t n_point     = 3;
+   static constexpr size_t n_component = 10;
+   //
+   // ctor
+   der_check_t(double rel_tol)
+   : rel_tol_(rel_tol), ok_(true), rel_error_(0.0),
+     n_skip_(0), n_candidate_(0)
+   { }
+   //
+   // column
+   // index of the k-th column that is checked at point p
+   static size_t column(size_t n, size_t p, size_t k)
+   {  size_t stride = std::max( size_t(1), n / n_component );
+      return (p + k * stride) % n;
+   }
+   //
+   // direction
+   // Set r (r2) to the fourth order central difference approximation,
+   // with step size h (2 h), for the derivative of f at x in direction v.
+   template <class Fun>
+   void direction(
+      Fun&                         f  ,
+      const cmpad::vector<double>& x  ,
+      const cmpad::vector<double>& v  ,
+      cmpad::vector<double>&       r  ,
+      cmpad::vector<double>&       r2 )
+   {  //
+      // n, m
+      size_t n = x.size();
+      size_t m = f.range();
+      assert( f.domain() == n && v.size() == n );
+      //
+      // h
+      double x_max = 1.0;
+      double v_max = std::numeric_limits<double>::min();
+      for(size_t j = 0; j < n; ++j)
+      {  x_max = std::max( x_max, std::fabs( x[j] ) );
+         v_max = std::max( v_max, std::fabs( v[j] ) );
+      }
+      double h = 1e-3 * x_max / v_max;
+      //
+      // diff_
+      // diff_[s] = f(x + 2^s h v) - f(x - 2^s h v)
+      x_step_.resize(n);
+      for(size_t s = 0; s < 3; ++s)
+      {  double h_s = h * double(1 << s);
+         for(size_t j = 0; j < n; ++j)
+            x_step_[j] = x[j] + h_s * v[j];
+         y_plus_ = f(x_step_);
+         for(size_t j = 0; j < n; ++j)
+            x_step_[j] = x[j] - h_s * v[j];
+         const cmpad::vector<double>& y_minus = f(x_step_);
+         diff_[s].resize(m);
+         for(size_t i = 0; i < m; ++i)
+            diff_[s][i] = y_plus_[i] - y_minus[i];
+      }
+      //
+      // r, r2
+      r.resize(m);
+      r2.resize(m);
+      for(size_t i = 0; i < m; ++i)
+      {  r[i]  = ( 8.0 * diff_[0][i] - diff_[1][i] ) / (12.0 * h);
+         r2[i] = ( 8.0 * diff_[1][i] - diff_[2][i] ) / (24.0 * h);
+      }
+   }
+   //
+   // compare
+   // compare the derivative values d with the reference r,
+   // r2 is the reference using step size 2 h.
+   void compare(
+      const cmpad::vector<double>& d  ,
+      const cmpad::vector<double>& r  ,
+      const cmpad::vector<double>& r2 )
+   {  assert( d.size() == r.size() && r.size() == r2.size() );
+      //
+      // scale
+      double scale = std::numeric_limits<double>::min();
+      for(size_t k = 0; k < r.size(); ++k)
+         scale = std::max( scale, std::fabs( r[k] ) );
+      //
+      // ok_, rel_error_, n_skip_, n_candidate_
+      for(size_t k = 0; k < r.size(); ++k)
+      {  ++n_candidate_;
+         bool smooth = std::fabs( r[k] - r2[k] ) <= rel_tol_ * scale;
+         if( smooth )
+         {  ok_       &= cmpad::near_equal(d[k], r[k], rel_tol_, r);
+            double s   = std::max( scale, std::fabs( d[k] ) );
+            double err = std::fabs( d[k] - r[k] ) / s;
+            //
+            // rel_error_
+            // (use not less than so that a nan derivative is reported as nan)
+            if( ! (err <= rel_error_) )
+               rel_error_ = err;
+         }
+         else
+            ++n_skip_;
+      }
+   }
+   //
+   // ok
+   // fail if more than one quarter of the components were skipped
+   bool ok(void) const
+   {  bool result = ok_;
+      if( n_skip_ > 0 )
+      {  std::cerr << "cmpad::der_check: n_skip = " << n_skip_
+                   << ", n_candidate = " << n_candidate_
+                   << ": components not checked because not smooth\n";
+         if( 4 * n_skip_ > n_candidate_ )
+            result = false;
+      }
+      return result;
+   }
+   //
+   // rel_error
+   double rel_error(void) const
+   {  return rel_error_; }
+};
+
+// dense_point
+// check a dense Jacobian of f, d[i * n + j] is the partial of f_i w.r.t. x_j
+template <class Derivative, class Fun>
+void dense_point(
+   der_check_t& check, Derivative& der, Fun& f, size_t p, uniform_01_t& rng)
+{  //
+   // n, m
+   size_t n = f.domain();
+   size_t m = f.range();
+   assert( der.domain() == n && der.range() == m * n );
+   //
+   // x, J
+   cmpad::vector<double> x(n);
+   rng(x);
+   cmpad::vector<double> J = der(x);
+   //
+   // check
+   cmpad::vector<double> e(n, 0.0), d(m), r, r2;
+   for(size_t k = 0; k < std::min(n, check.n_component); ++k)
+   {  size_t j = check.column(n, p, k);
+      e[j]     = 1.0;
+      check.direction(f, x, e, r, r2);
+      e[j]     = 0.0;
+      for(size_t i = 0; i < m; ++i)
+         d[i] = J[i * n + j];
+      check.compare(d, r, r2);
+   }
+}
+
+// direction_point
+// check the derivative of f times directions,
+// d[i * q + ell] is the derivative of f_i in direction ell.
+template <class Derivative, class Fun>
+void direction_point(
+   der_check_t& check, Derivative& der, Fun& f, size_t, uniform_01_t& rng)
+{  //
+   // n, m, q
+   size_t n = f.domain();
+   size_t m = f.range();
+   size_t q = der.domain() / n - 1;
+   assert( der.domain() == n * (1 + q) && der.range() == m * q );
+   //
+   // xv, Y
+   cmpad::vector<double> xv(n * (1 + q));
+   rng(xv);
+   cmpad::vector<double> Y = der(xv);
+   //
+   // check
+   cmpad::vector<double> x(n), v(n), d(m), r, r2;
+   for(size_t j = 0; j < n; ++j)
+      x[j] = xv[j];
+   for(size_t ell = 0; ell < q; ++ell)
+   {  for(size_t j = 0; j < n; ++j)
+         v[j] = xv[n + j * q + ell];
+      check.direction(f, x, v, r, r2);
+      for(size_t i = 0; i < m; ++i)
+         d[i] = Y[i * q + ell];
+      check.compare(d, r, r2);
+   }
+}
+
+// check_point
+// one overload for each type of derivative
+template <class Fun> void check_point(
+   der_check_t& check, jacobian& der, Fun& f, size_t p, uniform_01_t& rng)
+{  dense_point(check, der, f, p, rng); }
+//
+template <class Fun> void check_point(
+   der_check_t& check, hessian& der, Fun& f, size_t p, uniform_01_t& rng)
+{  dense_point(check, der, f, p, rng); }
+//
+template <class Fun> void check_point(
+   der_check_t& check, jvp& der, Fun& f, size_t p, uniform_01_t& rng)
+{  direction_point(check, der, f, p, rng); }
+//
+template <class Fun> void check_point(
+   der_check_t& check, hessian_vector& der, Fun& f, size_t p,
+   uniform_01_t& rng)
+{  direction_point(check, der, f, p, rng); }
+//
+template <class Fun> void check_point(
+   der_check_t& check, vjp& der, Fun& f, size_t p, uniform_01_t& rng)
+{  //
+   // n, m, q
+   size_t n = f.domain();
+   size_t m = f.range();
+   size_t q = (der.domain() - n) / m;
+   assert( der.domain() == n + q * m && der.range() == q * n );
+   //
+   // xw, Z
+   cmpad::vector<double> xw(n + q * m);
+   rng(xw);
+   cmpad::vector<double> Z = der(xw);
+   //
+   // check
+   // reference for column j of Z is the weights times column j of Jacobian
+   cmpad::vector<double> x(n), e(n, 0.0), r, r2, d(q), w_r(q), w_r2(q);
+   for(size_t j = 0; j < n; ++j)
+      x[j] = xw[j];
+   for(size_t k = 0; k < std::min(n, check.n_component); ++k)
+   {  size_t j = check.column(n, p, k);
+      e[j]     = 1.0;
+      check.direction(f, x, e, r, r2);
+      e[j]     = 0.0;
+      for(size_t ell = 0; ell < q; ++ell)
+      {  w_r[ell]  = 0.0;
+         w_r2[ell] = 0.0;
+         for(size_t i = 0; i < m; ++i)
+         {  w_r[ell]  += xw[n + ell * m + i] * r[i];
+            w_r2[ell] += xw[n + ell * m + i] * r2[i];
+         }
+         d[ell] = Z[ell * n + j];
+      }
+      check.compare(d, w_r, w_r2);
+   }
+}
+//
+template <class Fun> void check_point(
+   der_check_t& check, sparse_jacobian& der, Fun& f, size_t p,
+   uniform_01_t& rng)
+{  //
+   // n, m, row, col
+   size_t n = f.domain();
+   size_t m = f.range();
+   const cmpad::vector<size_t>& row = der.row();
+   const cmpad::vector<size_t>& col = der.col();
+   //
+   // x, J
+   cmpad::vector<double> x(n);
+   rng(x);
+   cmpad::vector<double> J = der(x);
+   //
+   // check
+   // entries that are not in the sparsity pattern must be zero
+   cmpad::vector<double> e(n, 0.0), d(m), r, r2;
+   for(size_t k = 0; k < std::min(n, check.n_component); ++k)
+   {  size_t j = check.column(n, p, k);
+      e[j]     = 1.0;
+      check.direction(f, x, e, r, r2);
+      e[j]     = 0.0;
+      for(size_t i = 0; i < m; ++i)
+         d[i] = 0.0;
+      for(size_t ell = 0; ell < J.size(); ++ell)
+         if( col[ell] == j )
+            d[ row[ell] ] = J[ell];
+      check.compare(d, r, r2);
+   }
+}
+//
+template <class Fun> void check_point(
+   der_check_t& check, sparse_hessian& der, Fun& f, size_t p,
+   uniform_01_t& rng)
+{  //
+   // n, row, col
+   size_t n = f.domain();
+   const cmpad::vector<size_t>& row = der.row();
+   const cmpad::vector<size_t>& col = der.col();
+   assert( f.range() == n );
+   //
+   // x, H
+   cmpad::vector<double> x(n);
+   rng(x);
+   cmpad::vector<double> H = der(x);
+   //
+   // check
+   // H only has the upper triangle, the lower triangle is by symmetry
+   // and entries that are not in the sparsity pattern must be zero
+   cmpad::vector<double> e(n, 0.0), d(n), r, r2;
+   for(size_t k = 0; k < std::min(n, check.n_component); ++k)
+   {  size_t j = check.column(n, p, k);
+      e[j]     = 1.0;
+      check.direction(f, x, e, r, r2);
+      e[j]     = 0.0;
+      for(size_t i = 0; i < n; ++i)
+         d[i] = 0.0;
+      for(size_t ell = 0; ell < H.size(); ++ell)
+      {  if( col[ell] == j )
+            d[ row[ell] ] = H[ell];
+         if( row[ell] == j )
+            d[ col[ell] ] = H[ell];
+      }
+      check.compare(d, r, r2);
+   }
+}
+
+// check_all
+// check der using central differences of f at all the points
+template <class Derivative, class Fun>
+bool check_all(
+   Derivative&      der       ,
+   Fun&             f         ,
+   const option_t&  option    ,
+   double           rel_tol   ,
+   double&          rel_error )
+{  //
+   // check, rng
+   der_check_t check(rel_tol);
+   cmpad::uniform_01_t rng(option.seed);
+   //
+   // check
+   for(size_t p = 0; p < check.n_point; ++p)
+      check_point(check, der, f, p, rng);
+   //
+   rel_error = check.rel_error();
+   return check.ok();
+}
+
+} // END cmpad::detail namespace
+
+// BEGIN PROTOTYPE
+template < template<class Vector> class Algo, class Derivative >
+bool der_check(
+   Derivative&      der       ,
+   const option_t&  option    ,
+   double           rel_tol   ,
+   double&          rel_error )
+// END PROTOTYPE
+{  static_assert(
+      ! std::is_base_of<hessian, Derivative>::value &&
+      ! std::is_base_of<hessian_vector, Derivative>::value &&
+      ! std::is_base_of<sparse_hessian, Derivative>::value ,
+      "der_check: second order derivatives require a gradient argument"
+   );
+   //
+   // algo
+   Algo< cmpad::vector<double> > algo;
+   algo.setup(option);
+   //
+   // der
+   der.setup(option);
+   //
+   return detail::check_all(der, algo, option, rel_tol, rel_error);
+}
+// BEGIN SECOND_ORDER
+template < template<class Vector> class Algo, class Derivative, class Gradient >
+bool der_check(
+   Derivative&      der       ,
+   Gradient&        grad      ,
+   const option_t&  option    ,
+   double           rel_tol   ,
+   double&          rel_error )
+// END SECOND_ORDER
+{  //
+   // grad
+   if( ! grad_check<Algo>(grad, option, rel_tol, rel_error) )
+      return false;
+   //
+   // der
+   der.setup(option);
+   //
+   return detail::check_all(der, grad, option, rel_tol, rel_error);
+}
+
+} // END cmpad namespace
+// END C++
+# endif
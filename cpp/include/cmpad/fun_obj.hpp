@@ -26,6 +26,10 @@ Syntax
 | |tab| *fun* . ``domain`` ( )
 | |tab| *fun* . ``range`` ( )
 | |tab| *y* = *fun* ( *x* )
+| |tab| *n_data* = *fun* . ``n_data`` ( )
+| |tab| *data* = *fun* . ``data`` ( )
+| |tab| *fun* . ``set_data`` ( *data* )
+| |tab| *branch* = *fun* . ``x_branch`` ( )
 
 Source Code
 ***********
@@ -121,6 +125,45 @@ y
 This *Vector* has size *m* and
 is the function value corresponding to *x*.
 
+Data
+****
+Some algorithms use data values that do not depend on *x* and that
+can change between calls; e.g., the measurement values for
+:ref:`llsq_obj-name` .
+The default implementation of the functions below is for an algorithm
+that does not have any such data; i.e., *n_data* is zero.
+
+n_data
+======
+The ``size_t`` return value *n_data* is the number of data values.
+It is not valid until after the first ``setup`` .
+
+data
+====
+The *Vector* return value *data* has size *n_data* and is
+the current data values.
+The ``setup`` function sets the data values to their defaults.
+
+set_data
+========
+The *Vector* *data* has size *n_data* and is the new data values.
+These values are used by the function calls that follow
+(until the next ``setup`` or ``set_data`` ).
+If the elements of *data* are AD dynamic parameters, or independent
+variables, the recorded function depends on them.
+
+x_branch
+********
+The ``bool`` return value *branch* is true if the algorithm uses
+native C++ branches, that depend on the value of *x* ,
+to compute a value that is not correct for other values of *x* .
+In this case, an AD package that records the operation sequence
+at one *x* , and evaluates it at another, must detect when the
+result of a comparison has changed and record the function again;
+see :ref:`cpp_retape_count-name` .
+The default implementation returns false.
+It is not valid until after the first ``setup`` .
+
 {xrst_toc_hidden
    cpp/xam/fun_obj.cpp
 }
@@ -133,6 +176,7 @@ Example
 */
 // BEGIN C++
 
+# include <cassert>
 # include <cmpad/option_t.hpp>
 namespace cmpad {
    template <class Vector> struct fun_obj {
@@ -155,6 +199,22 @@ namespace cmpad {
       //
       // operator()
       virtual const Vector& operator()(const Vector& x) = 0;
+      //
+      // n_data
+      virtual size_t n_data(void) const
+      {  return 0; }
+      //
+      // data
+      virtual Vector data(void) const
+      {  return Vector(); }
+      //
+      // set_data
+      virtual void set_data([[maybe_unused]] const Vector& data)
+      {  assert( data.size() == 0 ); }
+      //
+      // x_branch
+      virtual bool x_branch(void) const
+      {  return false; }
    };
 }
 // END C++
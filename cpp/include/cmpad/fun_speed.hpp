@@ -53,7 +53,25 @@ time_setup
 If option.time_setup is true (false) the setup function is (is not)
 included in the time for each function evaluation.
 If the setup time is not included, the only thing that changes
-between function evaluations is the argument vector *x* .
+between function evaluations is the argument vector *x*
+(and the data when *data_mode* is not ``constant`` ).
+
+data_mode
+=========
+If option.data_mode is not ``constant`` ,
+the :ref:`cpp_fun_obj@Data` is changed before each function evaluation
+using the call
+{xrst_code cpp}
+   fun_obj.set_data(data)
+{xrst_code}
+and this call is included in the time for each function evaluation.
+
+seed
+====
+The argument vectors *x* (and *data* vectors) are the
+:ref:`uniform_01-name` stream corresponding to option.seed .
+Hence the same *x* values are used each time ``fun_speed`` is called
+with the same seed.
 
 min_time
 ********
@@ -76,6 +94,7 @@ Example
 {xrst_end cpp_fun_speed}
 -------------------------------------------------------------------------------
 */
+# include <cstdlib>
 # include <iostream>
 # include <chrono>
 # include <cmpad/uniform_01.hpp>
@@ -104,6 +123,13 @@ template <class Fun_Obj> double fun_speed(
    size_t n = fun_obj.domain();
    cmpad::vector<double> x(n);
    //
+   // change_data, data
+   bool change_data = option.data_mode != "constant";
+   cmpad::vector<double> data( fun_obj.n_data() );
+   //
+   // rng
+   cmpad::uniform_01_t rng(option.seed);
+   //
    // repeat, t_start, t_end, t_diff
    size_t     repeat  = 0;
    time_point t_start = steady_clock::now();
@@ -129,9 +155,13 @@ template <class Fun_Obj> double fun_speed(
       //
       // computation
       for(size_t i = 0; i < repeat; ++i)
-      {  uniform_01(x);
+      {  rng(x);
          if( option.time_setup )
             fun_obj.setup(option);
+         if( change_data )
+         {  rng(data);
+            fun_obj.set_data(data);
+         }
          fun_obj(x);
       }
       // t_diff
@@ -0,0 +1,269 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_GRAD_CHECK_HPP
+# define CMPAD_GRAD_CHECK_HPP
+/*
+{xrst_begin cpp_grad_check}
+{xrst_spell
+   rel
+   tol
+}
+
+Check a C++ Gradient Before Timing It
+#####################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/grad_check.hpp>``
+| |tab| *ok* = ``cmpad::grad_check`` < *Algo* > (
+| |tab| |tab| *grad* , *option* , *rel_tol* , *rel_error*
+| |tab| )
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+Purpose
+*******
+A fast gradient is of no use if it is wrong; e.g.,
+if it was computed using a tape that does not correspond to the algorithm.
+This routine checks a gradient against a reference gradient
+so that a speed is only reported for gradients that pass the check.
+
+Algo
+****
+This is the algorithm that *grad* computes the gradient for; e.g.,
+:ref:`det_by_minor <cpp_det_by_minor-name>` .
+The reference gradient is computed using
+*Algo* < ``cmpad::vector<double>`` > ; i.e., the ``none`` package.
+
+grad
+****
+This is the :ref:`cpp_gradient-name` object that is checked.
+It is setup using *option* .
+
+option
+******
+This is the :ref:`option_t-name` used to setup *grad*
+and the ``none`` version of the algorithm.
+The points at which the gradient is checked are the first points in the
+:ref:`uniform_01-name` stream corresponding to *option*\ ``.seed`` .
+If *option*\ ``.data_mode`` is not ``constant`` ,
+the :ref:`cpp_fun_obj@Data` for *grad* and the ``none`` algorithm
+is changed to the next values in the stream before each point.
+
+Reference
+*********
+The reference gradient is computed using the fourth order
+central difference approximation
+
+.. math::
+
+   \partial_j f(x) \approx \frac{
+      - f( x + 2 h e^j ) + 8 f( x + h e^j )
+      - 8 f( x - h e^j ) + f( x - 2 h e^j )
+   }{ 12 h }
+
+where :math:`e^j` is the *j*-th elementary vector and
+:math:`h = 10^{-3} \max( 1 , | x_j | )` .
+This approximation is exact (except for roundoff) when
+:math:`f(x)` is a polynomial of degree four or less in :math:`x_j` .
+
+Non-Smooth Functions
+====================
+Some algorithms, e.g. ones with adaptive step sizes,
+are not smooth at all points.
+The approximation above is also computed with *h* replaced by :math:`2 h` .
+If the two approximations do not agree to within *rel_tol*
+(relative to the same scale used for checking the gradient),
+the function is not smooth near *x* and the component is skipped
+(not checked).
+To limit the cost, at most ``n_component`` components of the gradient are
+checked at each point and ``n_point`` points are checked; see the source code.
+
+Skipped Components
+==================
+If any components are skipped, the number skipped and the number that
+were candidates for checking are printed on ``std::cerr`` .
+If more than one quarter of the candidates are skipped
+(this includes the case where all of them are skipped),
+the check fails because it is not a meaningful test of *grad* .
+
+rel_tol
+*******
+This is the relative tolerance used to check each component of the
+gradient using :ref:`cpp_near_equal-name` .
+The values of the reference gradient are included in the scaling
+(through the *vec* argument to ``near_equal`` ).
+
+rel_error
+*********
+The input value of this argument does not matter.
+Upon return, it is the maximum over the checked components of
+
+   | *g* [ *j* ] - *r* [ *j* ] | / *scale*
+
+where *g* is the gradient, *r* is the reference gradient,
+and *scale* is the maximum of the absolute values of *g* [ *j* ]
+and the elements of *r* .
+
+ok
+**
+is true (false) if *grad* passed (failed) the check.
+
+{xrst_toc_hidden
+   cpp/xam/grad_check.cpp
+}
+Example
+*******
+:ref:`xam_grad_check.cpp-name` is an example and test of this routine.
+
+{xrst_end cpp_grad_check}
+-------------------------------------------------------------------------------
+*/
+# include <cmath>
+# include <cassert>
+# include <limits>
+# include <iostream>
+# include <algorithm>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/option_t.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// BEGIN PROTOTYPE
+template < template<class Vector> class Algo, class Gradient >
+bool grad_check(
+   Gradient&        grad      ,
+   const option_t&  option    ,
+   double           rel_tol   ,
+   double&          rel_error )
+// END PROTOTYPE
+{  //
+   // n_point, n_component
+   const size_t n_point     = 3;
+   const size_t n_component = 10;
+   //
+   // algo
+   Algo< cmpad::vector<double> > algo;
+   algo.setup(option);
+   //
+   // grad
+   grad.setup(option);
+   //
+   // n, m
+   size_t n = algo.domain();
+   size_t m = algo.range();
+   assert( grad.domain() == n );
+   //
+   // stride
+   size_t stride = std::max( size_t(1), n / n_component );
+   //
+   // rng
+   cmpad::uniform_01_t rng(option.seed);
+   //
+   // ok, rel_error
+   bool ok   = true;
+   rel_error = 0.0;
+   //
+   // n_skip
+   // number of components that were skipped because they are not smooth
+   size_t n_skip = 0;
+   //
+   // x, x_step, r, r2
+   // r2 is the approximation using step size 2 h
+   cmpad::vector<double> x(n), x_step(n), r( std::min(n, n_component) );
+   cmpad::vector<double> r2( r.size() );
+   //
+   // change_data, data
+   bool change_data = option.data_mode != "constant";
+   cmpad::vector<double> data( algo.n_data() );
+   //
+   // p
+   for(size_t p = 0; p < n_point; ++p)
+   {  //
+      // algo, grad
+      if( change_data )
+      {  rng(data);
+         algo.set_data(data);
+         grad.set_data(data);
+      }
+      //
+      // x, g
+      rng(x);
+      cmpad::vector<double> g = grad(x);
+      //
+      // x_step, r, r2
+      x_step = x;
+      for(size_t k = 0; k < r.size(); ++k)
+      {  //
+         // j
+         size_t j = (p + k * stride) % n;
+         //
+         // h
+         double h = 1e-3 * std::max( 1.0, std::fabs( x[j] ) );
+         //
+         // diff
+         // diff[s] = f(x + 2^s h e^j) - f(x - 2^s h e^j)
+         double diff[3];
+         for(size_t s = 0; s < 3; ++s)
+         {  double h_s = h * double(1 << s);
+            x_step[j]  = x[j] + h_s;
+            diff[s]    = algo(x_step)[m-1];
+            x_step[j]  = x[j] - h_s;
+            diff[s]   -= algo(x_step)[m-1];
+         }
+         x_step[j] = x[j];
+         //
+         // r[k], r2[k]
+         r[k]  = ( 8.0 * diff[0] - diff[1] ) / (12.0 * h);
+         r2[k] = ( 8.0 * diff[1] - diff[2] ) / (24.0 * h);
+      }
+      //
+      // scale
+      double scale = std::numeric_limits<double>::min();
+      for(size_t k = 0; k < r.size(); ++k)
+         scale = std::max( scale, std::fabs( r[k] ) );
+      //
+      // ok, rel_error
+      for(size_t k = 0; k < r.size(); ++k)
+      {  //
+         // smooth
+         bool smooth = std::fabs( r[k] - r2[k] ) <= rel_tol * scale;
+         if( smooth )
+         {  size_t j   = (p + k * stride) % n;
+            ok        &= cmpad::near_equal(g[j], r[k], rel_tol, r);
+            double s   = std::max( scale, std::fabs( g[j] ) );
+            double err = std::fabs( g[j] - r[k] ) / s;
+            //
+            // rel_error
+            // (use not less than so that a nan gradient is reported as nan)
+            if( ! (err <= rel_error) )
+               rel_error = err;
+         }
+         else
+            ++n_skip;
+      }
+   }
+   //
+   // ok
+   // fail if more than one quarter of the components were skipped
+   if( n_skip > 0 )
+   {  size_t n_candidate = n_point * r.size();
+      std::cerr << "cmpad::grad_check: n_skip = " << n_skip
+                << ", n_candidate = " << n_candidate
+                << ": components not checked because not smooth\n";
+      if( 4 * n_skip > n_candidate )
+         ok = false;
+   }
+   return ok;
+}
+
+} // END cmpad namespace
+# endif
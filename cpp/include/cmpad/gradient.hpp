@@ -124,6 +124,23 @@ Example and Derived Classes
 }
 {xrst_comment END_SORT_THIS_LINE_MINUS_2}
 
+{xrst_toc_hidden
+   cpp/include/cmpad/checkpoint_gradient.hpp
+}
+Checkpointing
+*************
+:ref:`cpp_checkpoint_gradient-name` uses one of the gradients above
+to compute the gradient of :ref:`an_ode-name` with less memory.
+
+{xrst_toc_hidden
+   cpp/include/cmpad/tiered_gradient.hpp
+}
+Tiered
+******
+:ref:`cpp_tiered_gradient-name` uses two of the gradients above,
+one that is fast to setup and one that is fast to evaluate,
+to lower the time to the first gradient.
+
 {xrst_end cpp_gradient}
 -------------------------------------------------------------------------------
 */
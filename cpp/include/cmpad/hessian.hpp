@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_HESSIAN_HPP
+# define CMPAD_HESSIAN_HPP
+/*
+{xrst_begin cpp_hessian}
+{xrst_spell
+   typedef
+}
+
+C++ Abstract Class For Calculating Hessian
+##########################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/hessian.hpp>``
+| |tab| ``template< template<class`` *ADVector* ``> class`` *Algo* ``> class``
+| |tab| *Hes* ``: public cmpad::hessian`` {
+| |tab| |tab| *...*
+| |tab| };
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+ADVector
+********
+see :ref:`cpp_gradient@ADVector` .
+
+Algo
+****
+see :ref:`cpp_gradient@Algo` .
+The Hessian is for the last component of the range space of the algorithm.
+
+Hes
+***
+This is a :ref:`cpp_fun_obj-name` interface to the
+Hessian of the function corresponding to *Algo*
+(we use *hes* for a corresponding object).
+The object *hes* calculates the Hessian of the last component of the vector
+returned by *algo*.
+
+setup
+=====
+The object *hes* is initialized using its ``setup`` member function
+(which in turn initializes *algo* using its ``setup`` member function).
+The ``setup`` functions should do calculations that do not depend on *x*
+(to make the evaluation of the Hessian faster).
+
+vector_type
+***********
+The type of the vectors *x* and *h* is
+
+| |tab| ``typedef cmpad::vector<double>`` *Hes* :: ``vector_type``
+
+scalar_type
+***********
+The type of the elements of *x* and *h* is
+
+| |tab| ``typedef double`` *Hes* :: ``scalar_type``
+
+domain
+******
+This returns the dimension of the
+:ref:`cpp_fun_obj@domain` space dimension for the function and Hessian.
+We use *n* to denote this dimension.
+
+range
+*****
+This returns the dimension of the
+:ref:`cpp_fun_obj@range` space dimension for the Hessian
+which is *n* * *n* .
+Hence ``range`` is implemented by this interface and not virtual.
+
+x
+*
+This vector has size *n* .
+It is the point at which the Hessian,
+of the function represented by *algo* , is evaluated.
+
+h
+*
+This result has size *n* * *n* .
+For *i* and *j* less than *n* ,
+*h* [ *i* * *n* + *j* ] is the second partial derivative
+with respect to *x* [ *i* ] and *x* [ *j* ] .
+All of the elements of the Hessian are computed
+(even though it is symmetric).
+
+Example and Derived Classes
+***************************
+{xrst_comment BEGIN_SORT_THIS_LINE_PLUS_3}
+{xrst_toc_table
+   cpp/xam/hessian/hessian.xrst
+   cpp/include/cmpad/adolc/hessian.hpp
+   cpp/include/cmpad/autodiff/hessian.hpp
+   cpp/include/cmpad/codi/hessian.hpp
+   cpp/include/cmpad/cppad/hessian.hpp
+   cpp/include/cmpad/cppad_jit/hessian.hpp
+   cpp/include/cmpad/cppadcg/hessian.hpp
+   cpp/include/cmpad/sacado/hessian.hpp
+}
+{xrst_comment END_SORT_THIS_LINE_MINUS_2}
+
+{xrst_end cpp_hessian}
+-------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad {
+   // hessian
+   class hessian : public fun_obj< cmpad::vector<double> > {
+   public:
+      // scalar_type
+      typedef double scalar_type;
+      // setup
+      virtual void setup(const option_t& option) override = 0;
+      // option
+      virtual const option_t& option(void) const override = 0;
+      // domain
+      virtual size_t domain(void) const override  = 0;
+      // range
+      size_t range(void) const override
+      {  return domain() * domain(); }
+      // operator
+      virtual const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override = 0;
+   };
+
+}
+// END C++
+# endif
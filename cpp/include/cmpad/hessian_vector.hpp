@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_HESSIAN_VECTOR_HPP
+# define CMPAD_HESSIAN_VECTOR_HPP
+/*
+{xrst_begin cpp_hessian_vector}
+{xrst_spell
+   typedef
+   hv
+   xv
+}
+
+C++ Abstract Class For Calculating Hessian Times a Vector
+#########################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/hessian_vector.hpp>``
+| |tab| ``template< template<class`` *ADVector* ``> class`` *Algo* ``> class``
+| |tab| *HesVec* ``: public cmpad::hessian_vector`` {
+| |tab| |tab| *...*
+| |tab| };
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+Purpose
+*******
+A Hessian times a vector can be computed without forming the Hessian;
+e.g., using one forward-over-reverse pass.
+Its cost, relative to a :ref:`gradient <cpp_gradient-name>` ,
+determines if matrix-free methods, like truncated Newton,
+are practical for large problems.
+
+ADVector
+********
+see :ref:`cpp_gradient@ADVector` .
+
+Algo
+****
+see :ref:`cpp_gradient@Algo` .
+The Hessian is for the last component of the range space of the algorithm.
+
+HesVec
+******
+This is a :ref:`cpp_fun_obj-name` interface to the
+Hessian times a vector for the function corresponding to *Algo*
+(we use *hv_obj* for a corresponding object).
+
+setup
+=====
+The object *hv_obj* is initialized using its ``setup`` member function
+(which in turn initializes *algo* using its ``setup`` member function).
+The ``setup`` functions should do calculations that do not depend on
+*x* or *v* .
+
+vector_type
+***********
+The type of the vectors *xv* and *hv* is
+
+| |tab| ``typedef cmpad::vector<double>`` *HesVec* :: ``vector_type``
+
+scalar_type
+***********
+The type of the elements of *xv* and *hv* is
+
+| |tab| ``typedef double`` *HesVec* :: ``scalar_type``
+
+n
+*
+We use *n* to denote the dimension of the domain space for *algo* .
+
+domain
+******
+This returns the dimension of the
+:ref:`cpp_fun_obj@domain` space dimension for *hv_obj*
+which is 2 * *n* .
+
+range
+*****
+This returns the dimension of the
+:ref:`cpp_fun_obj@range` space dimension for *hv_obj*
+which is *n* .
+Hence ``range`` is implemented by this interface and not virtual.
+
+xv
+**
+This vector has size 2 * *n* .
+The first *n* elements are the point *x* at which the Hessian is evaluated.
+The last *n* elements are the vector *v* that the Hessian multiplies.
+Putting both in one vector makes *hv_obj* a :ref:`cpp_fun_obj-name`
+and hence its speed can be measured using :ref:`cpp_fun_speed-name` .
+
+hv
+**
+This result has size *n* and is the Hessian at *x* times *v* ; i.e.,
+for *i* less than *n* ,
+
+   *hv* [ *i* ] = sum_j H( *x* )[ *i* , *j* ] * *v* [ *j* ]
+
+where H( *x* ) is the Hessian of the last component of the range of *algo* .
+
+Example and Derived Classes
+***************************
+{xrst_comment BEGIN_SORT_THIS_LINE_PLUS_3}
+{xrst_toc_table
+   cpp/xam/hessian_vector/hessian_vector.xrst
+   cpp/include/cmpad/adolc/hessian_vector.hpp
+   cpp/include/cmpad/codi/hessian_vector.hpp
+   cpp/include/cmpad/cppad/hessian_vector.hpp
+   cpp/include/cmpad/cppad_jit/hessian_vector.hpp
+   cpp/include/cmpad/cppadcg/hessian_vector.hpp
+   cpp/include/cmpad/sacado/hessian_vector.hpp
+}
+{xrst_comment END_SORT_THIS_LINE_MINUS_2}
+
+{xrst_end cpp_hessian_vector}
+-------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad {
+   // hessian_vector
+   class hessian_vector : public fun_obj< cmpad::vector<double> > {
+   public:
+      // scalar_type
+      typedef double scalar_type;
+      // setup
+      virtual void setup(const option_t& option) override = 0;
+      // option
+      virtual const option_t& option(void) const override = 0;
+      // domain
+      virtual size_t domain(void) const override  = 0;
+      // range
+      size_t range(void) const override
+      {  return domain() / 2; }
+      // operator
+      virtual const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& xv
+      ) override = 0;
+   };
+
+}
+// END C++
+# endif
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_JACOBIAN_HPP
+# define CMPAD_JACOBIAN_HPP
+/*
+{xrst_begin cpp_jacobian}
+{xrst_spell
+   typedef
+}
+
+C++ Abstract Class For Calculating Jacobian
+###########################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/jacobian.hpp>``
+| |tab| ``template< template<class`` *ADVector* ``> class`` *Algo* ``> class``
+| |tab| *Jac* ``: public cmpad::jacobian`` {
+| |tab| |tab| *...*
+| |tab| };
+| |tab| *jac* . ``set_mode`` ( *request* )
+| |tab| *used* = *jac* . ``mode`` ()
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+ADVector
+********
+see :ref:`cpp_gradient@ADVector` .
+
+Algo
+****
+see :ref:`cpp_gradient@Algo` .
+The Jacobian is for all the components of the range space of the algorithm.
+
+Jac
+***
+This is a :ref:`cpp_fun_obj-name` interface to the
+Jacobian of the function corresponding to *Algo*
+(we use *jac* for a corresponding object).
+
+setup
+=====
+The object *jac* is initialized using its ``setup`` member function
+(which in turn initializes *algo* using its ``setup`` member function).
+The ``setup`` functions should do calculations that do not depend on *x*
+(to make the evaluation of the Jacobian faster).
+The derived class ``setup`` must call ``choose_mode`` ( *m* , *n* )
+after it determines the range and domain dimensions for *algo* .
+
+vector_type
+***********
+The type of the vectors *x* and *J* is
+
+| |tab| ``typedef cmpad::vector<double>`` *Jac* :: ``vector_type``
+
+scalar_type
+***********
+The type of the elements of *x* and *J* is
+
+| |tab| ``typedef double`` *Jac* :: ``scalar_type``
+
+m
+*
+We use *m* to denote the dimension of the range space for *algo* .
+
+domain
+******
+This returns the dimension of the
+:ref:`cpp_fun_obj@domain` space dimension for the function and Jacobian.
+We use *n* to denote this dimension.
+
+range
+*****
+This returns the dimension of the
+:ref:`cpp_fun_obj@range` space dimension for the Jacobian
+which is *m* * *n* .
+
+x
+*
+This vector has size *n* .
+It is the point at which the Jacobian,
+of the function represented by *algo* , is evaluated.
+
+J
+*
+This result has size *m* * *n* .
+For *i* less than *m* and *j* less than *n* ,
+*J* [ *i* * *n* + *j* ] is the partial derivative
+of the *i*-th component of the range of *algo*
+with respect to *x* [ *j* ] .
+
+set_mode
+********
+This must be called before ``setup`` .
+The ``std::string`` *request* is ``forward`` , ``reverse`` , or ``auto``
+and its default value is ``auto`` .
+
+forward
+=======
+The Jacobian is computed one column at a time using forward mode;
+i.e., the number of first order sweeps is *n* .
+
+reverse
+=======
+The Jacobian is computed one row at a time using reverse mode;
+i.e., the number of first order sweeps is *m* .
+
+auto
+====
+If *n* <= *m* , forward mode is used, otherwise reverse mode is used.
+
+mode
+****
+The ``std::string`` *used* is the mode, ``forward`` or ``reverse`` ,
+chosen during the most recent ``setup`` .
+A derived class that only implements one mode
+uses that mode for all requests.
+
+Example and Derived Classes
+***************************
+{xrst_comment BEGIN_SORT_THIS_LINE_PLUS_3}
+{xrst_toc_table
+   cpp/xam/jacobian/jacobian.xrst
+   cpp/include/cmpad/adept/jacobian.hpp
+   cpp/include/cmpad/adolc/jacobian.hpp
+   cpp/include/cmpad/autodiff/jacobian.hpp
+   cpp/include/cmpad/codi/jacobian.hpp
+   cpp/include/cmpad/cppad/jacobian.hpp
+   cpp/include/cmpad/cppad_jit/jacobian.hpp
+   cpp/include/cmpad/sacado/jacobian.hpp
+}
+{xrst_comment END_SORT_THIS_LINE_MINUS_2}
+
+{xrst_end cpp_jacobian}
+-------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cassert>
+# include <string>
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad {
+   // jacobian
+   class jacobian : public fun_obj< cmpad::vector<double> > {
+   private:
+      // request_
+      std::string request_;
+      //
+      // mode_
+      std::string mode_;
+   protected:
+      // choose_mode
+      void choose_mode(size_t m, size_t n)
+      {  if( request_ == "auto" )
+         {  if( n <= m )
+               mode_ = "forward";
+            else
+               mode_ = "reverse";
+         }
+         else
+            mode_ = request_;
+      }
+   public:
+      // scalar_type
+      typedef double scalar_type;
+      //
+      // ctor
+      jacobian(void) : request_("auto"), mode_("")
+      { }
+      //
+      // set_mode
+      void set_mode(const std::string& request)
+      {  assert(
+            request == "auto" || request == "forward" || request == "reverse"
+         );
+         request_ = request;
+      }
+      //
+      // mode
+      const std::string& mode(void) const
+      {  return mode_; }
+      //
+      // setup
+      virtual void setup(const option_t& option) override = 0;
+      // option
+      virtual const option_t& option(void) const override = 0;
+      // domain
+      virtual size_t domain(void) const override  = 0;
+      // range
+      virtual size_t range(void) const override  = 0;
+      // operator
+      virtual const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override = 0;
+   };
+
+}
+// END C++
+# endif
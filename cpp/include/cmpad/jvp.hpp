@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_JVP_HPP
+# define CMPAD_JVP_HPP
+/*
+{xrst_begin cpp_jvp}
+{xrst_spell
+   typedef
+   jvp
+   xv
+}
+
+C++ Abstract Class For Calculating Jacobian Times Directions
+############################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/jvp.hpp>``
+| |tab| ``template< template<class`` *ADVector* ``> class`` *Algo* ``> class``
+| |tab| *Jvp* ``: public cmpad::jvp`` {
+| |tab| |tab| *...*
+| |tab| };
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+Purpose
+*******
+A Jacobian times a few directions is what forward sensitivity
+calculations need.
+When the number of directions is small, compared to the
+dimension of the range space, forward mode computes this without
+the overhead of recording a tape for reverse mode.
+Packages that support it carry all the directions in one forward pass.
+
+ADVector
+********
+see :ref:`cpp_gradient@ADVector` .
+
+Algo
+****
+see :ref:`cpp_gradient@Algo` .
+The Jacobian is for all the components of the range space of the algorithm.
+
+Jvp
+***
+This is a :ref:`cpp_fun_obj-name` interface to the
+Jacobian, of the function corresponding to *Algo* ,
+times a set of directions
+(we use *jvp_obj* for a corresponding object).
+
+setup
+=====
+The object *jvp_obj* is initialized using its ``setup`` member function
+(which in turn initializes *algo* using its ``setup`` member function).
+The ``setup`` functions should do calculations that do not depend on
+*x* or *V* .
+
+vector_type
+***********
+The type of the vectors *xv* and *Y* is
+
+| |tab| ``typedef cmpad::vector<double>`` *Jvp* :: ``vector_type``
+
+scalar_type
+***********
+The type of the elements of *xv* and *Y* is
+
+| |tab| ``typedef double`` *Jvp* :: ``scalar_type``
+
+n, m
+****
+We use *n* ( *m* ) to denote the dimension of the domain (range) space
+for *algo* .
+
+p
+*
+We use *p* for :ref:`option_t@n_direction` in the *option*
+argument to the most recent ``setup`` .
+It is the number of directions.
+
+domain
+******
+This returns the dimension of the
+:ref:`cpp_fun_obj@domain` space dimension for *jvp_obj*
+which is *n* * ( 1 + *p* ) .
+
+range
+*****
+This returns the dimension of the
+:ref:`cpp_fun_obj@range` space dimension for *jvp_obj*
+which is *m* * *p* .
+
+xv
+**
+This vector has size *n* * ( 1 + *p* ) .
+The first *n* elements are the point *x* at which the Jacobian is evaluated.
+The last *n* * *p* elements are the directions *V* in row major order; i.e.,
+for *j* less than *n* and *ell* less than *p* ,
+*xv* [ *n* + *j* * *p* + *ell* ] is component *j* of direction *ell* .
+Putting *x* and *V* in one vector makes *jvp_obj* a :ref:`cpp_fun_obj-name`
+and hence its speed can be measured using :ref:`cpp_fun_speed-name` .
+
+Y
+*
+This result has size *m* * *p* and is in row major order; i.e.,
+for *i* less than *m* and *ell* less than *p* ,
+
+   *Y* [ *i* * *p* + *ell* ] = sum_j J( *x* )[ *i* , *j* ] * *V* [ *j* , *ell* ]
+
+where J( *x* ) is the Jacobian of *algo* and
+*V* [ *j* , *ell* ] is *xv* [ *n* + *j* * *p* + *ell* ] .
+
+Example and Derived Classes
+***************************
+{xrst_comment BEGIN_SORT_THIS_LINE_PLUS_3}
+{xrst_toc_table
+   cpp/xam/jvp/jvp.xrst
+   cpp/include/cmpad/adept/jvp.hpp
+   cpp/include/cmpad/adolc/jvp.hpp
+   cpp/include/cmpad/autodiff/jvp.hpp
+   cpp/include/cmpad/codi/jvp.hpp
+   cpp/include/cmpad/cppad/jvp.hpp
+   cpp/include/cmpad/cppad_jit/jvp.hpp
+   cpp/include/cmpad/sacado/jvp.hpp
+}
+{xrst_comment END_SORT_THIS_LINE_MINUS_2}
+
+{xrst_end cpp_jvp}
+-------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad {
+   // jvp
+   class jvp : public fun_obj< cmpad::vector<double> > {
+   public:
+      // scalar_type
+      typedef double scalar_type;
+      // setup
+      virtual void setup(const option_t& option) override = 0;
+      // option
+      virtual const option_t& option(void) const override = 0;
+      // domain
+      virtual size_t domain(void) const override  = 0;
+      // range
+      virtual size_t range(void) const override  = 0;
+      // operator
+      virtual const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& xv
+      ) override = 0;
+   };
+
+}
+// END C++
+# endif
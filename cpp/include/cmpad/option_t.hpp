@@ -7,9 +7,11 @@
 
 # include <cstddef>
 # include <limits>
+# include <string>
 /*
 {xrst_begin option_t}
 {xrst_spell
+   dll
    max
    std
    struct
@@ -30,10 +32,30 @@ namespace cmpad {
       size_t n_arg;
       size_t n_other;
       bool   time_setup;
+      size_t seed;
+      size_t n_checkpoint;
+      size_t n_batch;
+      size_t n_thread;
+      size_t n_direction;
+      std::string jit_load;
+      size_t n_split;
+      std::string jit_flags;
+      std::string tape_load;
+      std::string data_mode;
       option_t(void)
-      {  n_arg      = std::numeric_limits<size_t>::max();
-         n_other    = std::numeric_limits<size_t>::max();
-         time_setup = false;
+      {  n_arg        = std::numeric_limits<size_t>::max();
+         n_other      = std::numeric_limits<size_t>::max();
+         time_setup   = false;
+         seed         = 0;
+         n_checkpoint = std::numeric_limits<size_t>::max();
+         n_batch      = 1;
+         n_thread     = 1;
+         n_direction  = 1;
+         jit_load     = "file";
+         n_split      = 1;
+         jit_flags    = "";
+         tape_load    = "record";
+         data_mode    = "constant";
       }
    };
 }
@@ -56,6 +78,89 @@ time_setup
 if true (false) the setup time is included (is not included) in the execution
 speed timing.
 
+seed
+****
+is the seed for the :ref:`uniform_01-name` generator that
+:ref:`cpp_fun_speed-name` uses to choose the argument values.
+
+n_checkpoint
+************
+is the number of checkpoints used by :ref:`cpp_checkpoint_gradient-name` .
+The default value ``std::numeric_limits<size_t>::max()`` means that
+checkpointing is not used; zero means checkpointing with every step
+recomputed starting at the initial value.
+It is not used by the other gradients or the algorithms.
+
+n_batch
+*******
+is the number of argument points in each call to a
+:ref:`cpp_batch_gradient-name` .
+It is not used by the other derivatives or the algorithms.
+
+n_thread
+********
+is the number of threads used by :ref:`cpp_batch_thread-name` .
+It is not used by the other derivatives or the algorithms.
+
+n_direction
+***********
+is the number of domain space directions used by a :ref:`cpp_jvp-name`
+and the number of range space weight vectors used by a :ref:`cpp_vjp-name` .
+It is not used by the other derivatives or the algorithms.
+
+jit_load
+********
+is ``file`` , ``cache`` , or ``memory`` and is the way
+:ref:`cppad_jit_function.hpp-name` compiles and loads its dll;
+see :ref:`cppad_jit_function.hpp@jit_load` .
+It is not used by the other packages or the algorithms.
+
+n_split
+*******
+is the number of parts that the source code generated by the
+cppad_jit and cppadcg packages is split into;
+see :ref:`cppad_jit_function.hpp@n_split` and
+:ref:`cppadcg_gradient.hpp@n_split` .
+It is not used by the other packages or the algorithms.
+
+jit_flags
+*********
+is the flags that the cppad_jit and cppadcg packages pass to the
+C compiler when they compile the source code they generate;
+e.g., ``-O3 -march=native -ffast-math`` .
+If it is empty, the package default flags are used;
+see :ref:`cppad_jit_function.hpp@jit_flags` and
+:ref:`cppadcg_compile_flags.hpp-name` .
+It is not used by the other packages or the algorithms.
+
+tape_load
+*********
+is ``record`` or ``file`` and is the way the cppad and cppad_jit
+gradients get the function they differentiate.
+If it is ``record`` , the algorithm is recorded during every setup.
+If it is ``file`` , the function is loaded from a file when possible;
+see :ref:`cppad_tape_file.hpp-name` .
+It is not used by the other packages, derivatives, or the algorithms.
+
+data_mode
+*********
+is ``constant`` , ``retape`` , or ``dynamic`` and is the way the
+:ref:`cpp_fun_obj@Data` for an algorithm is handled:
+
+.. csv-table::
+   :widths: auto
+   :header-rows: 1
+
+   data_mode, meaning
+   ``constant`` , the data does not change after setup
+   ``retape`` , the data changes and a derivative records its function again
+   ``dynamic`` , the data changes and a derivative only updates its value
+
+If it is not ``constant`` , :ref:`cpp_fun_speed-name` and
+:ref:`cpp_grad_check-name` change the data before each evaluation.
+The cppad gradient uses CppAD dynamic parameters for ``dynamic`` data,
+and the cppad_jit gradient uses extra arguments to its compiled function.
+
 {xrst_end option_t}
 */
 
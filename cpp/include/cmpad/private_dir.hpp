@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_PRIVATE_DIR_HPP
+# define CMPAD_PRIVATE_DIR_HPP
+/*
+{xrst_begin cpp_private_dir}
+{xrst_spell
+   dir
+}
+
+C++ Private Temporary Directory
+###############################
+
+Syntax
+******
+| |tab| ``# include <cmpad/private_dir.hpp>``
+| |tab| ``cmpad::private_dir`` *dir* ( *prefix* )
+| |tab| *dir_path* = *dir* . ``path`` ()
+
+Purpose
+*******
+The packages that compile the code they generate use this directory
+for their source, object, and library files.
+Each *dir* object has its own directory, and all the file names
+used with it are absolute, so the current working directory
+is not changed and two objects never use the same file.
+This makes it possible to setup many compiled functions at the same time;
+e.g., in different threads or in different processes that share the
+C++ temporary directory.
+
+prefix
+******
+This ``std::string`` is the first part of the name of the directory.
+The rest of the name is chosen so that the directory did not exist
+before *dir* was constructed.
+
+dir_path
+********
+This ``std::filesystem::path`` is the absolute path of the directory.
+It is in the C++ temporary directory.
+
+Destructor
+**********
+The destructor removes the directory and all the files in it.
+A dynamic library that was loaded from this directory
+remains loaded on Unix systems.
+On Windows systems the library files cannot be removed while they are loaded
+and they are left in the directory.
+
+{xrst_toc_hidden
+   cpp/xam/private_dir.cpp
+}
+:ref:`xam_private_dir.cpp-name` contains an example and test of this class.
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end cpp_private_dir}
+*/
+// BEGIN C++
+# include <atomic>
+# include <filesystem>
+# include <random>
+# include <sstream>
+# include <string>
+
+namespace cmpad {
+
+// cmpad::private_dir
+class private_dir {
+private:
+   //
+   // path_
+   std::filesystem::path path_;
+//
+public:
+   // ctor
+   private_dir(const std::string& prefix)
+   {  //
+      // counter
+      // distinguishes directories created by this process
+      static std::atomic<size_t> counter(0);
+      //
+      // temp_path
+      std::filesystem::path temp_path =
+         std::filesystem::absolute( std::filesystem::temp_directory_path() );
+      //
+      // path_
+      // random_device distinguishes directories created by other processes
+      std::random_device rd;
+      bool created = false;
+      while( ! created )
+      {  std::stringstream ss;
+         ss << prefix << "_" << std::hex << rd() << rd() << "_" << counter++;
+         path_   = temp_path / ss.str();
+         created = std::filesystem::create_directory(path_);
+      }
+   }
+   // dtor
+   ~private_dir(void)
+   {  std::error_code ec;
+      std::filesystem::remove_all(path_, ec);
+   }
+   // a private_dir cannot be copied
+   private_dir(const private_dir&)            = delete;
+   private_dir& operator=(const private_dir&) = delete;
+   //
+   // path
+   const std::filesystem::path& path(void) const
+   {  return path_; }
+};
+
+} // END cmpad namespace
+// END C++
+
+# endif
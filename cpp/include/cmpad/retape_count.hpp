@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_RETAPE_COUNT_HPP
+# define CMPAD_RETAPE_COUNT_HPP
+/*
+{xrst_begin cpp_retape_count}
+
+Count Comparison Changes and Retapes
+####################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/retape_count.hpp>``
+| |tab| ``cmpad::retape_count::check`` ( *n_change* )
+| |tab| *n_check* = ``cmpad::retape_count::n_check`` ()
+| |tab| *n_retape* = ``cmpad::retape_count::n_retape`` ()
+| |tab| *n_compare_change* = ``cmpad::retape_count::n_compare_change`` ()
+
+Purpose
+*******
+If an algorithm's :ref:`cpp_fun_obj@x_branch` is true,
+a derivative that evaluates a recording at a new argument value
+must check if the result of any of the recorded comparisons has changed.
+If so, it records the function again at the new argument value.
+These counters report how often this happens.
+
+check
+*****
+A derivative calls ``check`` once for each evaluation that it checks.
+The ``size_t`` value *n_change* is the number of comparisons that changed
+(zero if the recording was valid).
+If the package only reports that a comparison has changed,
+*n_change* is one when a comparison has changed.
+If *n_change* is not zero, the derivative records the function again.
+
+n_check
+*******
+This ``size_t`` value is the number of calls to ``check``
+(by all the derivatives in this process).
+
+n_retape
+********
+This ``size_t`` value is the number of calls to ``check``
+with a non-zero *n_change* ; i.e., the number of times
+the function was recorded again.
+
+n_compare_change
+****************
+This ``size_t`` value is the sum of *n_change* for all the calls to
+``check`` .
+
+Threads
+*******
+The counters are atomic, so derivatives in different threads can
+call ``check`` at the same time.
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end cpp_retape_count}
+*/
+// BEGIN C++
+# include <atomic>
+# include <cstddef>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// cmpad::retape_count
+class retape_count {
+private:
+   //
+   // check_total, retape_total, change_total
+   static std::atomic<size_t>& check_total(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   static std::atomic<size_t>& retape_total(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+   static std::atomic<size_t>& change_total(void)
+   {  static std::atomic<size_t> count(0);
+      return count;
+   }
+//
+public:
+   // check
+   static void check(size_t n_change)
+   {  ++check_total();
+      if( n_change > 0 )
+      {  ++retape_total();
+         change_total() += n_change;
+      }
+   }
+   //
+   // n_check, n_retape, n_compare_change
+   static size_t n_check(void)
+   {  return check_total(); }
+   static size_t n_retape(void)
+   {  return retape_total(); }
+   static size_t n_compare_change(void)
+   {  return change_total(); }
+};
+
+} // END cmpad namespace
+// END C++
+# endif
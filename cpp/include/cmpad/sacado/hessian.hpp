@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SACADO_HESSIAN_HPP
+# define CMPAD_SACADO_HESSIAN_HPP
+/*
+{xrst_begin sacado_hessian.hpp}
+{xrst_spell
+   fad
+   rad
+}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian.xrst
+   @Package@       , Sacado
+   @#######@       , ######
+   @package@       , sacado
+}
+
+Method
+******
+The Hessian is computed using forward-over-reverse; i.e.,
+the Sacado ``Rad`` reverse mode type with ``Fad::DFad<double>`` as its
+base type.
+The forward mode direction for *x* [ *i* ] is the *i*-th unit vector,
+so the *i*-th forward derivative of the adjoint for *x* [ *j* ]
+is the corresponding element of the Hessian.
+
+{xrst_end sacado_hessian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_SACADO
+
+# include <Sacado.hpp>
+# include <cmpad/hessian.hpp>
+
+namespace cmpad { namespace sacado { // BEGIN cmpad::sacado namespace
+
+
+// hessian
+template < template<class ADVector> class Algo> class hessian
+: public
+cmpad::hessian {
+private:
+   //
+   // Scalar, ADScalar, ADVector
+   typedef Sacado::Fad::DFad<double>   Scalar;
+   typedef Sacado::Rad::ADvar<Scalar>  ADScalar;
+   typedef cmpad::vector<ADScalar>     ADVector;
+   //
+   // option_
+   option_t                option_;
+   //
+   // algo_
+   Algo<ADVector>          algo_;
+   //
+   // ax_
+   ADVector                ax_;
+   //
+   // ay_
+   ADVector                ay_;
+   //
+   // h_
+   cmpad::vector<double>   h_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      //
+      // ax_
+      ax_.resize(n);
+      //
+      // ay_
+      ay_.resize(m);
+      //
+      // h_
+      h_.resize(n * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  // n
+      int n = int( domain() );
+      //
+      // ax_
+      // forward mode direction for x[j] is the j-th unit vector
+      for(int j = 0; j < n; ++j)
+         ax_[j] = Scalar(n, j, x[j]);
+      //
+      // ay_
+      ay_ = algo_(ax_);
+      //
+      // az
+      size_t   m  = algo_.range();
+      ADScalar az = ay_[m-1] + Scalar(0.0);
+      //
+      // reverse mode computation of gradient for last computed value
+      ADScalar::Gradcomp();
+      //
+      // h_
+      for(int i = 0; i < n; ++i)
+      {  for(int j = 0; j < n; ++j)
+            h_[i * n + j] = ax_[i].adj().dx(j);
+      }
+      //
+      return h_;
+   }
+};
+
+} } // END cmpad::sacado namespace
+
+# endif // CMPAD_HAS_SACADO
+// END C++
+# endif
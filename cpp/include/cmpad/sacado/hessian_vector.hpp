@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SACADO_HESSIAN_VECTOR_HPP
+# define CMPAD_SACADO_HESSIAN_VECTOR_HPP
+/*
+{xrst_begin sacado_hessian_vector.hpp}
+{xrst_spell
+   fad
+   rad
+}
+
+{xrst_template ,
+   cpp/include/cmpad/hessian_vector.xrst
+   @Package@       , Sacado
+   @#######@       , ######
+   @package@       , sacado
+}
+
+Method
+******
+The Hessian times a vector is computed using forward-over-reverse; i.e.,
+the Sacado ``Rad`` reverse mode type with ``Fad::SFad<double, 1>``
+as its base type.
+The forward mode direction is *v* ,
+so the forward derivative of the adjoint for *x* [ *j* ]
+is the *j*-th component of the Hessian times *v* .
+
+{xrst_end sacado_hessian_vector.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_SACADO
+
+# include <Sacado.hpp>
+# include <cmpad/hessian_vector.hpp>
+
+namespace cmpad { namespace sacado { // BEGIN cmpad::sacado namespace
+
+
+// hessian_vector
+template < template<class ADVector> class Algo> class hessian_vector
+: public
+cmpad::hessian_vector {
+private:
+   //
+   // Scalar, ADScalar, ADVector
+   typedef Sacado::Fad::SFad<double, 1> Scalar;
+   typedef Sacado::Rad::ADvar<Scalar>   ADScalar;
+   typedef cmpad::vector<ADScalar>      ADVector;
+   //
+   // option_
+   option_t                option_;
+   //
+   // algo_
+   Algo<ADVector>          algo_;
+   //
+   // ax_
+   ADVector                ax_;
+   //
+   // ay_
+   ADVector                ay_;
+   //
+   // hv_
+   cmpad::vector<double>   hv_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      //
+      // ax_
+      ax_.resize(n);
+      //
+      // ay_
+      ay_.resize(m);
+      //
+      // hv_
+      hv_.resize(n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return 2 * algo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  // n
+      size_t n = algo_.domain();
+      assert( xv.size() == 2 * n );
+      //
+      // ax_
+      // forward mode direction is v
+      for(size_t j = 0; j < n; ++j)
+      {  Scalar xj(1, xv[j]);
+         xj.fastAccessDx(0) = xv[n + j];
+         ax_[j] = xj;
+      }
+      //
+      // ay_
+      ay_ = algo_(ax_);
+      //
+      // az
+      size_t   m  = algo_.range();
+      ADScalar az = ay_[m-1] + Scalar(0.0);
+      //
+      // reverse mode computation of gradient for last computed value
+      ADScalar::Gradcomp();
+      //
+      // hv_
+      for(size_t j = 0; j < n; ++j)
+         hv_[j] = ax_[j].adj().dx(0);
+      //
+      return hv_;
+   }
+};
+
+} } // END cmpad::sacado namespace
+
+# endif // CMPAD_HAS_SACADO
+// END C++
+# endif
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SACADO_JACOBIAN_HPP
+# define CMPAD_SACADO_JACOBIAN_HPP
+/*
+{xrst_begin sacado_jacobian.hpp}
+{xrst_spell
+   fad
+   rad
+}
+
+{xrst_template ,
+   cpp/include/cmpad/jacobian.xrst
+   @Package@       , Sacado
+   @#######@       , ######
+   @package@       , sacado
+}
+
+Method
+******
+
+forward
+=======
+The Sacado ``Fad::DFad<double>`` type is used with *n* directions.
+The forward mode direction for *x* [ *j* ] is the *j*-th unit vector,
+so all the columns of the Jacobian are computed during one evaluation
+of the algorithm.
+
+reverse
+=======
+The Sacado ``Rad::ADvar<double>`` type is used.
+The Sacado ``Gradcomp`` function frees the tape,
+so the algorithm is evaluated once for each row of the Jacobian.
+
+{xrst_end sacado_jacobian.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_SACADO
+
+# include <Sacado.hpp>
+# include <cmpad/jacobian.hpp>
+
+namespace cmpad { namespace sacado { // BEGIN cmpad::sacado namespace
+
+
+// jacobian
+template < template<class ADVector> class Algo> class jacobian
+: public
+cmpad::jacobian {
+private:
+   //
+   // FScalar, FVector
+   typedef Sacado::Fad::DFad<double>   FScalar;
+   typedef cmpad::vector<FScalar>      FVector;
+   //
+   // RScalar, RVector
+   typedef Sacado::Rad::ADvar<double>  RScalar;
+   typedef cmpad::vector<RScalar>      RVector;
+   //
+   // option_
+   option_t                option_;
+   //
+   // forward_
+   bool                    forward_;
+   //
+   // falgo_, fx_, fy_
+   Algo<FVector>           falgo_;
+   FVector                 fx_;
+   FVector                 fy_;
+   //
+   // ralgo_, rx_, ry_
+   Algo<RVector>           ralgo_;
+   RVector                 rx_;
+   RVector                 ry_;
+   //
+   // J_
+   cmpad::vector<double>   J_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // falgo_, ralgo_
+      falgo_.setup(option);
+      ralgo_.setup(option);
+      //
+      // n, m
+      size_t n = falgo_.domain();
+      size_t m = falgo_.range();
+      //
+      // forward_
+      choose_mode(m, n);
+      forward_ = mode() == "forward";
+      //
+      // fx_, fy_, rx_, ry_
+      fx_.resize(n);
+      fy_.resize(m);
+      rx_.resize(n);
+      ry_.resize(m);
+      //
+      // J_
+      J_.resize(m * n);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return falgo_.domain(); };
+   //
+   // range
+   size_t range(void) const override
+   {  return falgo_.range() * falgo_.domain(); };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& x
+   ) override
+   {  // n, m
+      int n = int( falgo_.domain() );
+      int m = int( falgo_.range() );
+      //
+      if( forward_ )
+      {  //
+         // fx_
+         // forward mode direction for x[j] is the j-th unit vector
+         for(int j = 0; j < n; ++j)
+            fx_[j] = FScalar(n, j, x[j]);
+         //
+         // fy_
+         fy_ = falgo_(fx_);
+         //
+         // J_
+         for(int i = 0; i < m; ++i)
+         {  for(int j = 0; j < n; ++j)
+               J_[i * n + j] = fy_[i].dx(j);
+         }
+      }
+      else
+      {  for(int i = 0; i < m; ++i)
+         {  //
+            // rx_
+            for(int j = 0; j < n; ++j)
+               rx_[j] = x[j];
+            //
+            // ry_
+            ry_ = ralgo_(rx_);
+            //
+            // rz
+            RScalar rz = ry_[i] + 0.0;
+            //
+            // reverse mode computation of gradient for last computed value
+            RScalar::Gradcomp();
+            //
+            // J_
+            for(int j = 0; j < n; ++j)
+               J_[i * n + j] = rx_[j].adj();
+         }
+      }
+      //
+      return J_;
+   }
+};
+
+} } // END cmpad::sacado namespace
+
+# endif // CMPAD_HAS_SACADO
+// END C++
+# endif
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SACADO_JVP_HPP
+# define CMPAD_SACADO_JVP_HPP
+/*
+{xrst_begin sacado_jvp.hpp}
+{xrst_spell
+   fad
+}
+
+{xrst_template ,
+   cpp/include/cmpad/jvp.xrst
+   @Package@       , Sacado
+   @#######@       , ######
+   @package@       , sacado
+}
+
+Method
+******
+The Sacado ``Fad::DFad<double>`` type is used with *p* directions.
+The derivative components of *x* [ *j* ] are row *j* of *V* ,
+so all the directions are computed during one evaluation of the algorithm.
+
+{xrst_end sacado_jvp.hpp}
+*/
+// BEGIN C++
+# if CMPAD_HAS_SACADO
+
+# include <Sacado.hpp>
+# include <cmpad/jvp.hpp>
+
+namespace cmpad { namespace sacado { // BEGIN cmpad::sacado namespace
+
+// jvp
+template < template<class ADVector> class Algo> class jvp
+: public
+cmpad::jvp {
+private:
+   //
+   // FScalar, FVector
+   typedef Sacado::Fad::DFad<double>   FScalar;
+   typedef cmpad::vector<FScalar>      FVector;
+   //
+   // option_
+   option_t                option_;
+   //
+   // algo_, ax_, ay_
+   Algo<FVector>           algo_;
+   FVector                 ax_;
+   FVector                 ay_;
+   //
+   // Y_
+   cmpad::vector<double>   Y_;
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // option_
+      option_ = option;
+      //
+      // algo_
+      algo_.setup(option);
+      //
+      // n, m, p
+      size_t n = algo_.domain();
+      size_t m = algo_.range();
+      size_t p = option.n_direction;
+      //
+      // ax_, ay_
+      ax_.resize(n);
+      ay_.resize(m);
+      //
+      // Y_
+      Y_.resize(m * p);
+   }
+   // domain
+   size_t domain(void) const override
+   {  return algo_.domain() * (1 + option_.n_direction); };
+   //
+   // range
+   size_t range(void) const override
+   {  return algo_.range() * option_.n_direction; };
+   //
+   // operator
+   const cmpad::vector<double>& operator()(
+      const cmpad::vector<double>& xv
+   ) override
+   {  // n, m, p
+      int n = int( algo_.domain() );
+      int m = int( algo_.range() );
+      int p = int( option_.n_direction );
+      assert( xv.size() == size_t( n * (1 + p) ) );
+      //
+      // ax_
+      // the p derivative components for x[j] are row j of V
+      for(int j = 0; j < n; ++j)
+      {  ax_[j] = FScalar(p, xv[j]);
+         for(int ell = 0; ell < p; ++ell)
+            ax_[j].fastAccessDx(ell) = xv[n + j * p + ell];
+      }
+      //
+      // ay_
+      ay_ = algo_(ax_);
+      //
+      // Y_
+      for(int i = 0; i < m; ++i)
+      {  for(int ell = 0; ell < p; ++ell)
+            Y_[i * p + ell] = ay_[i].dx(ell);
+      }
+      //
+      return Y_;
+   }
+};
+
+} } // END cmpad::sacado namespace
+
+# endif // CMPAD_HAS_SACADO
+// END C++
+# endif
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SPARSE_HESSIAN_HPP
+# define CMPAD_SPARSE_HESSIAN_HPP
+/*
+{xrst_begin cpp_sparse_hessian}
+{xrst_spell
+   nnz
+   typedef
+}
+
+C++ Abstract Class For Calculating Sparse Hessian
+#################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/sparse_hessian.hpp>``
+| |tab| ``template< template<class`` *ADVector* ``> class`` *Algo* ``> class``
+| |tab| *SparseHes* ``: public cmpad::sparse_hessian`` {
+| |tab| |tab| *...*
+| |tab| };
+| |tab| *row* = *hes* . ``row`` ()
+| |tab| *col* = *hes* . ``col`` ()
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+ADVector
+********
+see :ref:`cpp_gradient@ADVector` .
+
+Algo
+****
+see :ref:`cpp_gradient@Algo` .
+The Hessian is for the last component of the range space of the algorithm.
+
+SparseHes
+*********
+This is a :ref:`cpp_fun_obj-name` interface to the
+possibly non-zero entries in the upper triangle of the Hessian
+of the function corresponding to *Algo*
+(we use *hes* for a corresponding object).
+
+setup
+=====
+The object *hes* is initialized using its ``setup`` member function
+(which in turn initializes *algo* using its ``setup`` member function).
+The ``setup`` function computes the sparsity pattern for the Hessian
+and the symmetric coloring used to compress the Hessian calculation.
+These do not depend on *x* and are not repeated for each evaluation
+of the Hessian.
+Hence, the cost of the sparsity pattern and coloring is included
+(is not included) in a :ref:`cpp_fun_speed-name` rate when
+:ref:`option_t@time_setup` is true (false).
+
+vector_type
+***********
+The type of the vectors *x* and *H* is
+
+| |tab| ``typedef cmpad::vector<double>`` *SparseHes* :: ``vector_type``
+
+scalar_type
+***********
+The type of the elements of *x* and *H* is
+
+| |tab| ``typedef double`` *SparseHes* :: ``scalar_type``
+
+domain
+******
+This returns the dimension of the
+:ref:`cpp_fun_obj@domain` space dimension for the function and Hessian.
+We use *n* to denote this dimension.
+
+range
+*****
+This returns the dimension of the
+:ref:`cpp_fun_obj@range` space dimension for the sparse Hessian
+which is the number of possibly non-zero entries in the upper triangle
+of the Hessian.
+We use *nnz* to denote this dimension.
+
+row, col
+********
+These ``cmpad::vector<size_t>`` objects have size *nnz* and are
+the row and column indices for the possibly non-zero entries
+in the upper triangle of the Hessian; i.e., *row* [ *k* ] <= *col* [ *k* ] .
+They are in row major order; i.e., for *k* + 1 < *nnz* ,
+*row* [ *k* ] <= *row* [ *k* + 1 ] and if
+*row* [ *k* ] == *row* [ *k* + 1 ] then *col* [ *k* ] < *col* [ *k* + 1 ] .
+They are determined by the most recent ``setup`` .
+
+x
+*
+This vector has size *n* .
+It is the point at which the Hessian,
+of the function represented by *algo* , is evaluated.
+
+H
+*
+This result has size *nnz* .
+For *k* less than *nnz* ,
+*H* [ *k* ] is the second partial derivative of
+the last component of the range of *algo*
+with respect to *x* [ *row* [ *k* ] ] and *x* [ *col* [ *k* ] ] .
+The lower triangle is not computed because the Hessian is symmetric.
+
+Example and Derived Classes
+***************************
+{xrst_comment BEGIN_SORT_THIS_LINE_PLUS_3}
+{xrst_toc_table
+   cpp/xam/sparse_hessian/sparse_hessian.xrst
+   cpp/include/cmpad/adolc/sparse_hessian.hpp
+   cpp/include/cmpad/cppad/sparse_hessian.hpp
+   cpp/include/cmpad/cppadcg/sparse_hessian.hpp
+}
+{xrst_comment END_SORT_THIS_LINE_MINUS_2}
+
+{xrst_end cpp_sparse_hessian}
+-------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad {
+   // sparse_hessian
+   class sparse_hessian : public fun_obj< cmpad::vector<double> > {
+   public:
+      // scalar_type
+      typedef double scalar_type;
+      // setup
+      virtual void setup(const option_t& option) override = 0;
+      // option
+      virtual const option_t& option(void) const override = 0;
+      // domain
+      virtual size_t domain(void) const override  = 0;
+      // range
+      size_t range(void) const override
+      {  return row().size(); }
+      // row
+      virtual const cmpad::vector<size_t>& row(void) const = 0;
+      // col
+      virtual const cmpad::vector<size_t>& col(void) const = 0;
+      // operator
+      virtual const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override = 0;
+   };
+
+}
+// END C++
+# endif
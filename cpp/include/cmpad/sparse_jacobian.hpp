@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SPARSE_JACOBIAN_HPP
+# define CMPAD_SPARSE_JACOBIAN_HPP
+/*
+{xrst_begin cpp_sparse_jacobian}
+{xrst_spell
+   nan
+   nnz
+   typedef
+}
+
+C++ Abstract Class For Calculating Sparse Jacobian
+##################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/sparse_jacobian.hpp>``
+| |tab| ``template< template<class`` *ADVector* ``> class`` *Algo* ``> class``
+| |tab| *SparseJac* ``: public cmpad::sparse_jacobian`` {
+| |tab| |tab| *...*
+| |tab| };
+| |tab| *row* = *jac* . ``row`` ()
+| |tab| *col* = *jac* . ``col`` ()
+| |tab| *sparsity_time* = *jac* . ``sparsity_time`` ()
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+ADVector
+********
+see :ref:`cpp_gradient@ADVector` .
+
+Algo
+****
+see :ref:`cpp_gradient@Algo` .
+The Jacobian is for all the components of the range space of the algorithm.
+
+SparseJac
+*********
+This is a :ref:`cpp_fun_obj-name` interface to the
+possibly non-zero entries in the Jacobian of the function
+corresponding to *Algo*
+(we use *jac* for a corresponding object).
+
+setup
+=====
+The object *jac* is initialized using its ``setup`` member function
+(which in turn initializes *algo* using its ``setup`` member function).
+The ``setup`` function computes the sparsity pattern for the Jacobian
+and the coloring used to compress the Jacobian calculation.
+These do not depend on *x* and are not repeated for each evaluation
+of the Jacobian.
+Hence, the cost of the sparsity pattern and coloring is included
+(is not included) in a :ref:`cpp_fun_speed-name` rate when
+:ref:`option_t@time_setup` is true (false).
+
+vector_type
+***********
+The type of the vectors *x* and *J* is
+
+| |tab| ``typedef cmpad::vector<double>`` *SparseJac* :: ``vector_type``
+
+scalar_type
+***********
+The type of the elements of *x* and *J* is
+
+| |tab| ``typedef double`` *SparseJac* :: ``scalar_type``
+
+domain
+******
+This returns the dimension of the
+:ref:`cpp_fun_obj@domain` space dimension for the function and Jacobian.
+We use *n* to denote this dimension.
+
+range
+*****
+This returns the dimension of the
+:ref:`cpp_fun_obj@range` space dimension for the sparse Jacobian
+which is the number of possibly non-zero entries in the Jacobian.
+We use *nnz* to denote this dimension.
+
+row, col
+********
+These ``cmpad::vector<size_t>`` objects have size *nnz* and are
+the row and column indices for the possibly non-zero entries
+in the Jacobian.
+They are in row major order; i.e., for *k* + 1 < *nnz* ,
+*row* [ *k* ] <= *row* [ *k* + 1 ] and if
+*row* [ *k* ] == *row* [ *k* + 1 ] then *col* [ *k* ] < *col* [ *k* + 1 ] .
+They are determined by the most recent ``setup`` .
+
+sparsity_time
+*************
+This ``double`` is the time in seconds that the most recent ``setup``
+spent computing the sparsity pattern and coloring
+(it does not include recording the algorithm).
+Depending on the package, it may also include one evaluation of the
+Jacobian that is used to compute the coloring.
+If a package does not compute the sparsity pattern and coloring
+separately from other setup work, *sparsity_time* is nan.
+A derived class sets this value by calling the protected member function
+``set_sparsity_time`` ( *sparsity_time* ) during ``setup`` .
+
+x
+*
+This vector has size *n* .
+It is the point at which the Jacobian,
+of the function represented by *algo* , is evaluated.
+
+J
+*
+This result has size *nnz* .
+For *k* less than *nnz* ,
+*J* [ *k* ] is the partial derivative of
+component *row* [ *k* ] of the range of *algo*
+with respect to *x* [ *col* [ *k* ] ] .
+
+Example and Derived Classes
+***************************
+{xrst_comment BEGIN_SORT_THIS_LINE_PLUS_3}
+{xrst_toc_table
+   cpp/xam/sparse_jacobian/sparse_jacobian.xrst
+   cpp/include/cmpad/adolc/sparse_jacobian.hpp
+   cpp/include/cmpad/cppad/sparse_jacobian.hpp
+   cpp/include/cmpad/cppadcg/sparse_jacobian.hpp
+}
+{xrst_comment END_SORT_THIS_LINE_MINUS_2}
+
+{xrst_end cpp_sparse_jacobian}
+-------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <limits>
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad {
+   // sparse_jacobian
+   class sparse_jacobian : public fun_obj< cmpad::vector<double> > {
+   private:
+      // sparsity_time_
+      double sparsity_time_;
+   protected:
+      // set_sparsity_time
+      void set_sparsity_time(double sparsity_time)
+      {  sparsity_time_ = sparsity_time; }
+   public:
+      // scalar_type
+      typedef double scalar_type;
+      //
+      // ctor
+      sparse_jacobian(void)
+      : sparsity_time_( std::numeric_limits<double>::quiet_NaN() )
+      { }
+      // sparsity_time
+      double sparsity_time(void) const
+      {  return sparsity_time_; }
+      // setup
+      virtual void setup(const option_t& option) override = 0;
+      // option
+      virtual const option_t& option(void) const override = 0;
+      // domain
+      virtual size_t domain(void) const override  = 0;
+      // range
+      size_t range(void) const override
+      {  return row().size(); }
+      // row
+      virtual const cmpad::vector<size_t>& row(void) const = 0;
+      // col
+      virtual const cmpad::vector<size_t>& col(void) const = 0;
+      // operator
+      virtual const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override = 0;
+   };
+
+}
+// END C++
+# endif
@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_TIERED_GRADIENT_HPP
+# define CMPAD_TIERED_GRADIENT_HPP
+/*
+{xrst_begin_parent cpp_tiered_gradient}
+
+Tiered Gradient: Interpret While Compiling
+##########################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/tiered_gradient.hpp>``
+| |tab| ``cmpad::tiered_gradient`` <
+| |tab| |tab| *Interpreted* , *Compiled* , *Algo*
+| |tab| > *grad*
+| |tab| *grad* ``.setup`` ( *option* )
+| |tab| *g* = *grad* ( *x* )
+| |tab| *flag* = *grad* ``.compiled`` ()
+| |tab| *n_call* = *grad* ``.n_interpreted`` ()
+| |tab| *grad* ``.wait`` ()
+
+Purpose
+*******
+The setup for a package that compiles the code it generates
+does not return until the compiler is done,
+which can take seconds for large algorithms.
+This :ref:`cpp_gradient-name` returns from setup as soon as the
+*Interpreted* gradient is setup.
+The *Compiled* gradient is setup by a background thread and
+the evaluations switch to the *Compiled* gradient when it is ready.
+This lowers the time to the first gradient; i.e., the cold start latency.
+
+Interpreted
+***********
+This is a :ref:`cpp_gradient-name` class template that is fast to setup;
+e.g., ``cmpad::cppad::gradient`` .
+Its setup and evaluations are done by the thread that uses *grad* .
+
+Compiled
+********
+This is a :ref:`cpp_gradient-name` class template that is slow to setup
+and fast to evaluate; e.g.,
+``cmpad::cppad_jit::gradient`` or ``cmpad::cppadcg::gradient`` .
+Its object is constructed and setup by the background thread.
+The *Compiled* setup is done at the same time as the
+*Interpreted* evaluations, so the two packages must not share
+tape state between threads; e.g., CppAD requires
+:ref:`cppad_parallel_setup.hpp-name` with *n_thread* equal to one.
+
+Algo
+****
+This is the algorithm that the gradients are computed for;
+see :ref:`cpp_gradient@Algo` .
+
+setup
+*****
+If the background thread for a previous setup is still running,
+this waits for it to finish.
+It then sets up the *Interpreted* gradient and starts a
+new background thread that sets up the *Compiled* gradient.
+Hence, when :ref:`option_t@time_setup` is true,
+:ref:`cpp_fun_speed-name` includes the time for the *Compiled* setup.
+
+Background Thread
+=================
+While the background thread is running,
+:ref:`cpp_batch_thread@in_parallel` is true and
+its :ref:`cpp_batch_thread@thread_num` is one.
+This is unique if there are no *batch* objects with worker threads,
+and at most one *grad* object is running a background thread, at a time.
+
+x, g
+****
+see :ref:`cpp_gradient@x` and :ref:`cpp_gradient@g` .
+If *flag* is false, *g* is computed using the *Interpreted* gradient.
+Otherwise it is computed using the *Compiled* gradient.
+
+compiled
+********
+The ``bool`` value *flag* is true if the *Compiled* setup,
+for the previous *grad* setup, is done.
+The switch from false to true is atomic.
+
+n_interpreted
+*************
+The ``size_t`` value *n_call* is the number of gradients that were
+computed using the *Interpreted* gradient since the previous *grad* setup.
+
+wait
+****
+This waits for the background thread to finish.
+Upon return, *flag* is true.
+
+{xrst_toc_hidden after
+   cpp/xam/tiered_gradient.cpp
+}
+Example
+*******
+:ref:`xam_tiered_gradient.cpp-name` is an example and test of this class.
+
+Source Code
+***********
+:ref:`tiered_gradient.hpp-name` displays the source code for this class.
+
+{xrst_end cpp_tiered_gradient}
+------------------------------------------------------------------------------
+{xrst_begin tiered_gradient.hpp}
+
+tiered_gradient: Source Code
+############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end tiered_gradient.hpp}
+*/
+// BEGIN C++
+# include <atomic>
+# include <memory>
+# include <thread>
+# include <cmpad/gradient.hpp>
+# include <cmpad/batch_thread.hpp>
+
+namespace cmpad { // BEGIN cmpad namespace
+
+// tiered_gradient
+template <
+   template< template<class ADVector> class Algo > class Interpreted ,
+   template< template<class ADVector> class Algo > class Compiled    ,
+   template<class ADVector> class Algo
+>
+class tiered_gradient : public gradient {
+private:
+   //
+   // option_
+   option_t                                 option_;
+   //
+   // interpreted_
+   Interpreted<Algo>                        interpreted_;
+   //
+   // compiled_
+   // only used by the background thread until ready_ is true
+   std::unique_ptr< Compiled<Algo> >        compiled_;
+   //
+   // ready_
+   // true when the compiled_ setup is done
+   std::atomic<bool>                        ready_;
+   //
+   // n_interpreted_
+   size_t                                   n_interpreted_;
+   //
+   // background_
+   std::thread                              background_;
+   //
+   // compile
+   // the function executed by the background thread
+   void compile(void)
+   {  thread_num_reference() = 1;
+      compiled_.reset( new Compiled<Algo> );
+      compiled_->setup(option_);
+      --n_worker_reference();
+      ready_.store(true, std::memory_order_release);
+   }
+//
+public:
+   // scalar_type
+   typedef double scalar_type;
+   //
+   // vector_type
+   typedef cmpad::vector<double> vector_type;
+   //
+   // ctor
+   tiered_gradient(void) : ready_(false), n_interpreted_(0)
+   { }
+   //
+   // dtor
+   ~tiered_gradient(void)
+   {  wait(); }
+   //
+   // a tiered_gradient cannot be copied
+   tiered_gradient(const tiered_gradient&)            = delete;
+   tiered_gradient& operator=(const tiered_gradient&) = delete;
+   //
+   // option
+   const option_t& option(void) const override
+   {  return option_; }
+   //
+   // domain
+   size_t domain(void) const override
+   {  return interpreted_.domain(); }
+   //
+   // compiled
+   bool compiled(void) const
+   {  return ready_.load(std::memory_order_acquire); }
+   //
+   // n_interpreted
+   size_t n_interpreted(void) const
+   {  return n_interpreted_; }
+   //
+   // wait
+   void wait(void)
+   {  if( background_.joinable() )
+         background_.join();
+   }
+   //
+   // setup
+   void setup(const option_t& option) override
+   {  //
+      // background_
+      wait();
+      //
+      // option_, ready_, n_interpreted_
+      option_        = option;
+      ready_         = false;
+      n_interpreted_ = 0;
+      //
+      // interpreted_
+      interpreted_.setup(option);
+      //
+      // compiled_
+      // the previous compiled_ is destroyed by this thread
+      compiled_.reset();
+      //
+      // background_
+      ++n_worker_reference();
+      background_ = std::thread( &tiered_gradient::compile, this );
+   }
+   //
+   // operator
+   const vector_type& operator()(const vector_type& x) override
+   {  if( compiled() )
+         return (*compiled_)(x);
+      ++n_interpreted_;
+      return interpreted_(x);
+   }
+};
+
+} // END cmpad namespace
+// END C++
+# endif
@@ -1,14 +1,45 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2023 Bradley M. Bell
+// SPDX-FileContributor: 2023-24 Bradley M. Bell
 // ---------------------------------------------------------------------------
 # ifndef CMPAD_UNIFORM_01_HPP
 # define CMPAD_UNIFORM_01_HPP
 
-# include <cstdlib>
+# include <cstdint>
 # include <cmpad/vec_vec_str.hpp>
+// BEGIN PROTOTYPE
 namespace cmpad {
+   // uniform_01_t
+   class uniform_01_t {
+   private:
+      // key_
+      // Philox key determined by the seed.
+      uint32_t key_[2];
+      //
+      // stream_
+      // upper half of the Philox counter.
+      uint32_t stream_[2];
+      //
+      // index_
+      // index of the next double in this stream.
+      uint64_t index_;
+   public:
+      // ctor
+      uniform_01_t(uint64_t seed = 0, uint64_t stream = 0);
+      //
+      // seed
+      void seed(uint64_t seed, uint64_t stream = 0);
+      //
+      // operator()
+      void operator()(cmpad::vector<double>& x);
+   };
+   //
+   // uniform_01_seed
+   void uniform_01_seed(uint64_t seed, uint64_t stream = 0);
+   //
+   // uniform_01
    void uniform_01(cmpad::vector<double>& x);
 }
+// END PROTOTYPE
 
 # endif
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_VJP_HPP
+# define CMPAD_VJP_HPP
+/*
+{xrst_begin cpp_vjp}
+{xrst_spell
+   typedef
+   vjp
+   xw
+}
+
+C++ Abstract Class For Calculating Weights Times Jacobian
+#########################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/vjp.hpp>``
+| |tab| ``template< template<class`` *ADVector* ``> class`` *Algo* ``> class``
+| |tab| *Vjp* ``: public cmpad::vjp`` {
+| |tab| |tab| *...*
+| |tab| };
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+Purpose
+*******
+A few weight vectors times a Jacobian is what multi-objective
+optimization, and computing a Jacobian a block of rows at a time, need.
+When the number of weight vectors is small, compared to the
+dimension of the domain space, reverse mode computes this efficiently.
+Packages that support it carry all the weight vectors in one reverse sweep
+and hence only traverse the tape once.
+
+ADVector
+********
+see :ref:`cpp_gradient@ADVector` .
+
+Algo
+****
+see :ref:`cpp_gradient@Algo` .
+The Jacobian is for all the components of the range space of the algorithm.
+
+Vjp
+***
+This is a :ref:`cpp_fun_obj-name` interface to a set of weight vectors
+times the Jacobian of the function corresponding to *Algo*
+(we use *vjp_obj* for a corresponding object).
+
+setup
+=====
+The object *vjp_obj* is initialized using its ``setup`` member function
+(which in turn initializes *algo* using its ``setup`` member function).
+The ``setup`` functions should do calculations that do not depend on
+*x* or *W* .
+
+vector_type
+***********
+The type of the vectors *xw* and *Z* is
+
+| |tab| ``typedef cmpad::vector<double>`` *Vjp* :: ``vector_type``
+
+scalar_type
+***********
+The type of the elements of *xw* and *Z* is
+
+| |tab| ``typedef double`` *Vjp* :: ``scalar_type``
+
+n, m
+****
+We use *n* ( *m* ) to denote the dimension of the domain (range) space
+for *algo* .
+
+q
+*
+We use *q* for :ref:`option_t@n_direction` in the *option*
+argument to the most recent ``setup`` .
+It is the number of weight vectors.
+
+domain
+******
+This returns the dimension of the
+:ref:`cpp_fun_obj@domain` space dimension for *vjp_obj*
+which is *n* + *q* * *m* .
+
+range
+*****
+This returns the dimension of the
+:ref:`cpp_fun_obj@range` space dimension for *vjp_obj*
+which is *q* * *n* .
+
+xw
+**
+This vector has size *n* + *q* * *m* .
+The first *n* elements are the point *x* at which the Jacobian is evaluated.
+The last *q* * *m* elements are the weight vectors *W* in row major order;
+i.e., for *k* less than *q* and *i* less than *m* ,
+*xw* [ *n* + *k* * *m* + *i* ] is component *i* of weight vector *k* .
+Putting *x* and *W* in one vector makes *vjp_obj* a :ref:`cpp_fun_obj-name`
+and hence its speed can be measured using :ref:`cpp_fun_speed-name` .
+
+Z
+*
+This result has size *q* * *n* and is in row major order; i.e.,
+for *k* less than *q* and *j* less than *n* ,
+
+   *Z* [ *k* * *n* + *j* ] = sum_i *W* [ *k* , *i* ] * J( *x* )[ *i* , *j* ]
+
+where J( *x* ) is the Jacobian of *algo* and
+*W* [ *k* , *i* ] is *xw* [ *n* + *k* * *m* + *i* ] .
+
+Example and Derived Classes
+***************************
+{xrst_comment BEGIN_SORT_THIS_LINE_PLUS_3}
+{xrst_toc_table
+   cpp/xam/vjp/vjp.xrst
+   cpp/include/cmpad/adept/vjp.hpp
+   cpp/include/cmpad/adolc/vjp.hpp
+   cpp/include/cmpad/codi/vjp.hpp
+   cpp/include/cmpad/cppad/vjp.hpp
+   cpp/include/cmpad/cppad_jit/vjp.hpp
+}
+{xrst_comment END_SORT_THIS_LINE_MINUS_2}
+
+{xrst_end cpp_vjp}
+-------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+
+namespace cmpad {
+   // vjp
+   class vjp : public fun_obj< cmpad::vector<double> > {
+   public:
+      // scalar_type
+      typedef double scalar_type;
+      // setup
+      virtual void setup(const option_t& option) override = 0;
+      // option
+      virtual const option_t& option(void) const override = 0;
+      // domain
+      virtual size_t domain(void) const override  = 0;
+      // range
+      virtual size_t range(void) const override  = 0;
+      // operator
+      virtual const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& xw
+      ) override = 0;
+   };
+
+}
+// END C++
+# endif
@@ -29,6 +29,11 @@ This file uses the :ref:`csv_column-name` format.
       END HEADER_LINE
    }
 
+#. If the file is not empty on input, its first line must be the header
+   above. Otherwise, it was created by a different version of cmpad
+   and an error message is printed and the program exits
+   (so that rows with different columns are not mixed in one file).
+
 #. A line is added to this file corresponding to
    this call to csv_speed.
 
@@ -48,6 +53,10 @@ algorithm
 *********
 see :ref:`csv_column@algorithm`
 
+derivative
+**********
+see :ref:`csv_column@derivative`
+
 special
 *******
 see :ref:`csv_column@special`
@@ -67,6 +76,43 @@ time_setup
 ==========
 see :ref:`csv_column@time_setup`
 
+n_batch
+=======
+see :ref:`csv_column@n_batch`
+
+n_thread
+========
+see :ref:`csv_column@n_thread`
+
+n_direction
+===========
+see :ref:`csv_column@n_direction`
+
+jit_load
+========
+see :ref:`csv_column@jit_load`
+
+n_split
+=======
+see :ref:`csv_column@n_split`
+
+jit_flags
+=========
+see :ref:`csv_column@jit_flags`
+
+tape_load
+=========
+see :ref:`csv_column@tape_load`
+
+data_mode
+=========
+see :ref:`csv_column@data_mode`
+
+rel_error
+*********
+see :ref:`csv_column@rel_error` .
+If *rel_error* is nan, the corresponding csv column is empty.
+
 {xrst_toc_hidden
    cpp/xam/csv_speed.cpp
 }
@@ -76,10 +122,12 @@ Example
 
 {xrst_end cpp_csv_speed}
 */
+# include <cmath>
 # include <ctime>
 # include <filesystem>
 # include <sstream>
 # include <iostream>
+# include <limits>
 # include <cmpad/csv_speed.hpp>
 # include <cmpad/csv_read.hpp>
 # include <cmpad/csv_write.hpp>
@@ -149,13 +197,15 @@ namespace cmpad { // BEGIN_CMPAD_NAMESPACE
 
 // BEGIN PROTOTYPE
 void csv_speed(
-   const std::string& file_name ,
-   double             rate      ,
-   double             min_time  ,
-   const std::string& package   ,
-   const std::string& algorithm ,
-   bool               special   ,
-   const option_t&    option    )
+   const std::string& file_name  ,
+   double             rate       ,
+   double             min_time   ,
+   const std::string& package    ,
+   const std::string& algorithm  ,
+   const std::string& derivative ,
+   bool               special    ,
+   const option_t&    option     ,
+   double             rel_error  )
 // END PROTOTYPE
 {  //
    // file_system
@@ -164,27 +214,50 @@ void csv_speed(
    // csv_table
    vec_vec_str csv_table;
    //
+   // header
+   cmpad::vector<std::string> header = {
+      "rate",
+      "min_time",
+      "package",
+      "algorithm",
+      "n_arg",
+      "n_other",
+      "time_setup",
+      "date",
+      "compiler",
+      "debug",
+      "language",
+      "special",
+      "rel_error",
+      "n_checkpoint",
+      "derivative",
+      "n_batch",
+      "n_thread",
+      "n_direction",
+      "jit_load",
+      "n_split",
+      "jit_flags",
+      "tape_load",
+      "data_mode"
+   };
+   //
    // csv_table
-   filesystem::path path(file_name);
    if( filesystem::exists( filesystem::path(file_name) ) )
       csv_table = csv_read(file_name);
-   else
-   {  cmpad::vector<std::string> row = {
-         "rate",
-         "min_time",
-         "package",
-         "algorithm",
-         "n_arg",
-         "n_other",
-         "time_setup",
-         "date",
-         "compiler",
-         "debug",
-         "language",
-         "special"
-      };
-      csv_table.push_back(row);
+   if( csv_table.size() == 0 )
+      csv_table.push_back(header);
+   //
+   // same_header
+   bool same_header = csv_table[0].size() == header.size();
+   for(size_t j = 0; same_header && j < header.size(); ++j)
+      same_header = csv_table[0][j] == header[j];
+   if( ! same_header )
+   {  std::cerr << "csv_speed: the header in " << file_name << "\n"
+                << "does not match the columns for this version of cmpad.\n"
+                << "Remove the file or use a different file name.\n";
+      std::exit(1);
    }
+   //
    // ss
    std::stringstream ss;
    //
@@ -193,6 +266,12 @@ void csv_speed(
    ss << std::setprecision(1) << std::scientific << rate;
    std::string rate_str = ss.str();
    //
+   // rel_error_str
+   ss.str("");
+   if( ! std::isnan(rel_error) )
+      ss << std::setprecision(1) << std::scientific << rel_error;
+   std::string rel_error_str = ss.str();
+   //
    // time_min_str
    ss.str("");
    ss << std::setprecision(3) << std::fixed << min_time;
@@ -229,6 +308,24 @@ void csv_speed(
    // n_other
    std::string n_other = std::to_string(option.n_other);
    //
+   // n_checkpoint
+   // empty when checkpointing is not used
+   std::string n_checkpoint = "";
+   if( option.n_checkpoint != std::numeric_limits<size_t>::max() )
+      n_checkpoint = std::to_string(option.n_checkpoint);
+   //
+   // n_batch
+   std::string n_batch = std::to_string(option.n_batch);
+   //
+   // n_thread
+   std::string n_thread = std::to_string(option.n_thread);
+   //
+   // n_direction
+   std::string n_direction = std::to_string(option.n_direction);
+   //
+   // n_split
+   std::string n_split = std::to_string(option.n_split);
+   //
    // time_setup
    std::string time_setup;
    if( option.time_setup )
@@ -249,7 +346,18 @@ void csv_speed(
       compiler,
       debug,
       language,
-      bool2string(special)
+      bool2string(special),
+      rel_error_str,
+      n_checkpoint,
+      derivative,
+      n_batch,
+      n_thread,
+      n_direction,
+      option.jit_load,
+      n_split,
+      option.jit_flags,
+      option.tape_load,
+      option.data_mode
    };
    csv_table.push_back(row);
    //
@@ -1,10 +1,12 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2023 Bradley M. Bell
+// SPDX-FileContributor: 2023-24 Bradley M. Bell
 // ---------------------------------------------------------------------------
 /*
 {xrst_begin uniform_01}
 {xrst_spell
+   philox
+   rng
    srand
    std
 }
@@ -14,13 +16,17 @@ Simulate a [0,1] Uniform Random Variate
 
 Syntax
 ******
-| |tab| ``# include <cmpad/speed/uniform_01.hpp>``
-| |tab| ``std::srand`` ( *seed* )
+| |tab| ``# include <cmpad/uniform_01.hpp>``
+| |tab| ``cmpad::uniform_01_t`` *rng* ( *seed* , *stream* )
+| |tab| *rng* . ``seed`` ( *seed* , *stream* )
+| |tab| *rng* ( *x* )
+| |tab| ``cmpad::uniform_01_seed`` ( *seed* , *stream* )
 | |tab| ``cmpad::uniform_01`` ( *x* )
 
 Prototype
 *********
 {xrst_literal
+   cpp/include/cmpad/uniform_01.hpp
    // BEGIN PROTOTYPE
    // END PROTOTYPE
 }
@@ -28,17 +34,44 @@ Prototype
 Purpose
 *******
 This routine is used to create random values for speed testing.
+It uses the Philox4x32-10 counter based generator; i.e.,
+the *k*-th value in a stream is a function of
+*seed*, *stream* and *k* only.
+Hence the values do not depend on the C library version,
+and independent streams can be used by different threads.
+
+rng
+***
+is a random number generator object.
+Each *rng* has its own state, so different threads
+can use different *rng* objects at the same time.
 
 seed
 ****
 The argument *seed* specifies a seed
 for the uniform random number generator.
+The default value for *seed* is zero.
+
+stream
+******
+The argument *stream* specifies which of the :math:`2^{64}`
+independent streams, for this *seed*, is used.
+The default value for *stream* is zero.
 
 x
 *
 The input value of the elements of *x* does not matter.
 Upon return, the elements of *x* are set to values
 uniformly sampled over the interval [0,1].
+The elements of *x* are the next *x*\ ``.size()`` values in the stream.
+The values are computed for a block of counters at a time
+(so that the compiler can vectorize the computation).
+
+uniform_01_seed
+***************
+Each thread has a default generator that is used by ``uniform_01`` .
+This routine restarts the default generator for the current thread
+(similar to ``std::srand`` ).
 
 {xrst_toc_hidden
    cpp/xam/uniform_01.cpp
@@ -51,17 +84,102 @@ Example
 ------------------------------------------------------------------------------
 */
 // BEGIN C++
-# include <cstdlib>
 # include <cmpad/uniform_01.hpp>
 
-namespace cmpad {
-   // BEGIN PROTOTYPE
-   void uniform_01(cmpad::vector<double>& x)
-   // END PROTOTYPE
-   {  double factor = 1. / double(RAND_MAX);
-      size_t n      = x.size();
-      while(n--)
-         x[n] = std::rand() * factor;
+namespace { // BEGIN_EMPTY_NAMESPACE
+   //
+   // philox_m0, philox_m1, philox_w0, philox_w1
+   // multipliers and key increments for Philox4x32
+   const uint32_t philox_m0 = 0xD2511F53;
+   const uint32_t philox_m1 = 0xCD9E8D57;
+   const uint32_t philox_w0 = 0x9E3779B9;
+   const uint32_t philox_w1 = 0xBB67AE85;
+   //
+   // n_lane
+   // number of counters that are processed together
+   const size_t n_lane = 8;
+   //
+   // philox_lanes
+   // On input, c[i][lane] is the i-th component of the counter for lane.
+   // On output, it is the corresponding component of the random bits.
+   void philox_lanes(uint32_t c[4][n_lane], const uint32_t key[2])
+   {  uint32_t k0 = key[0];
+      uint32_t k1 = key[1];
+      for(size_t round = 0; round < 10; ++round)
+      {  for(size_t lane = 0; lane < n_lane; ++lane)
+         {  uint64_t p0  = uint64_t(philox_m0) * uint64_t( c[0][lane] );
+            uint64_t p1  = uint64_t(philox_m1) * uint64_t( c[2][lane] );
+            c[0][lane]   = uint32_t(p1 >> 32) ^ c[1][lane] ^ k0;
+            c[1][lane]   = uint32_t(p1);
+            c[2][lane]   = uint32_t(p0 >> 32) ^ c[3][lane] ^ k1;
+            c[3][lane]   = uint32_t(p0);
+         }
+         k0 += philox_w0;
+         k1 += philox_w1;
+      }
+   }
+   //
+   // default_rng
+   thread_local cmpad::uniform_01_t default_rng;
+} // END_EMPTY_NAMESPACE
+
+namespace cmpad { // BEGIN_CMPAD_NAMESPACE
+
+uniform_01_t::uniform_01_t(uint64_t seed, uint64_t stream)
+{  this->seed(seed, stream); }
+
+void uniform_01_t::seed(uint64_t seed, uint64_t stream)
+{  key_[0]    = uint32_t(seed);
+   key_[1]    = uint32_t(seed >> 32);
+   stream_[0] = uint32_t(stream);
+   stream_[1] = uint32_t(stream >> 32);
+   index_     = 0;
+}
+
+void uniform_01_t::operator()(cmpad::vector<double>& x)
+{  //
+   // factor
+   // 2^{-53}; i.e., one over the number of 53 bit values
+   const double factor = 1.0 / double( uint64_t(1) << 53 );
+   //
+   // c
+   uint32_t c[4][n_lane];
+   //
+   // i, x
+   size_t n = x.size();
+   size_t i = 0;
+   while( i < n )
+   {  //
+      // block, skip
+      // each counter value (block) determines two doubles
+      uint64_t block = index_ / 2;
+      size_t   skip  = size_t( index_ % 2 );
+      //
+      // c
+      for(size_t lane = 0; lane < n_lane; ++lane)
+      {  c[0][lane] = uint32_t( block + lane );
+         c[1][lane] = uint32_t( (block + lane) >> 32 );
+         c[2][lane] = stream_[0];
+         c[3][lane] = stream_[1];
+      }
+      philox_lanes(c, key_);
+      //
+      // i, x, index_
+      for(size_t k = skip; k < 2 * n_lane && i < n; ++k)
+      {  size_t   lane = k / 2;
+         size_t   j    = 2 * (k % 2);
+         uint64_t bits = ( uint64_t( c[j][lane] ) << 32 ) | c[j+1][lane];
+         x[i++]        = double(bits >> 11) * factor;
+         ++index_;
+      }
    }
 }
+
+void uniform_01_seed(uint64_t seed, uint64_t stream)
+{  default_rng.seed(seed, stream); }
+
+void uniform_01(cmpad::vector<double>& x)
+{  default_rng(x); }
+
+} // END_CMPAD_NAMESPACE
 // END C++
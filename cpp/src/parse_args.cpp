@@ -35,11 +35,24 @@ arguments_t
    n_arg,       see :ref:`run_cmpad@n_arg`
    n_other,     see :ref:`run_cmpad@n_other`
    time_setup,  see :ref:`run_cmpad@time_setup`
+   seed,        see :ref:`run_cmpad@seed`
+   n_checkpoint, see :ref:`run_cmpad@n_checkpoint`
+   derivative,   see :ref:`run_cmpad@derivative`
+   n_batch,      see :ref:`run_cmpad@n_batch`
+   n_thread,     see :ref:`run_cmpad@n_thread`
+   thread_sweep, see :ref:`run_cmpad@thread_sweep`
+   n_direction,  see :ref:`run_cmpad@n_direction`
+   jit_load,     see :ref:`run_cmpad@jit_load`
+   n_split,      see :ref:`run_cmpad@n_split`
+   jit_flags,    see :ref:`run_cmpad@jit_flags`
+   tape_load,    see :ref:`run_cmpad@tape_load`
+   data_mode,    see :ref:`run_cmpad@data_mode`
 
 {xrst_end parse_args}
 */
 // see http://www.crasseux.com/books/ctutorial/argp-example.html
 # include <iostream>
+# include <limits>
 # include <stdlib.h>
 # include <getopt.h>
 # include <cmpad/configure.hpp>
@@ -51,34 +64,58 @@ arguments_t parse_args(int argc, char* argv[])
 {
    arguments_t arguments;
    // BEGIN DEFAULT ARGUMENTS
-   arguments.algorithm  = "det_by_minor";
-   arguments.file_name  = "cmpad.csv";
-   arguments.min_time   = 0.5;
-   arguments.n_arg      = 9;
-   arguments.n_other    = 0;
-   arguments.package    = "none";
-   arguments.time_setup = false;
+   arguments.algorithm    = "det_by_minor";
+   arguments.file_name    = "cmpad.csv";
+   arguments.min_time     = 0.5;
+   arguments.n_arg        = 9;
+   arguments.n_other      = 0;
+   arguments.package      = "none";
+   arguments.time_setup   = false;
+   arguments.seed         = 0;
+   arguments.n_checkpoint = std::numeric_limits<size_t>::max();
+   arguments.derivative   = "gradient";
+   arguments.n_batch      = 1;
+   arguments.n_thread     = 1;
+   arguments.thread_sweep = false;
+   arguments.n_direction  = 1;
+   arguments.jit_load     = "file";
+   arguments.n_split      = 1;
+   arguments.jit_flags    = "";
+   arguments.tape_load    = "record";
+   arguments.data_mode    = "constant";
    // END DEFAULT ARGUMENTS
    //
    // long_options
    struct option long_options[] =
    {  // name,         has_arg,            *flag,            val
       { "algorithm",   required_argument,  0,                'a' },
+      { "batch",       required_argument,  0,                'b' },
+      { "n_checkpoint",required_argument,  0,                'c' },
+      { "derivative",  required_argument,  0,                'd' },
+      { "tape_load",   required_argument,  0,                'e' },
       { "file_name",   required_argument,  0,                'f' },
+      { "jit_flags",   required_argument,  0,                'g' },
+      { "n_thread",    required_argument,  0,                'j' },
+      { "n_split",     required_argument,  0,                'k' },
+      { "jit_load",    required_argument,  0,                'l' },
       { "min_time",    required_argument,  0,                'm' },
       { "n_arg",       required_argument,  0,                'n' },
       { "n_other",     required_argument,  0,                'o' },
       { "package",     required_argument,  0,                'p' },
+      { "n_direction", required_argument,  0,                'r' },
+      { "seed",        required_argument,  0,                's' },
+      { "data_mode",   required_argument,  0,                'u' },
       // flags
       { "version",     no_argument,        0,                'v' },
       { "help",        no_argument,        0,                'h' },
       { "time_setup",  no_argument,        0,                't' },
+      { "thread_sweep",no_argument,        0,                'w' },
       {0,              0,                  0,                 0  }
    };
    //
    // shortopts
    // one : means argument requires after the option
-   const char* shortopts = "a:f:m:n:o:p:" "vht";
+   const char* shortopts = "a:b:c:d:e:f:g:j:k:l:m:n:o:p:r:s:u:" "vhtw";
    //
    // error_msg
    std::string error_msg = "";
@@ -114,11 +151,51 @@ arguments_t parse_args(int argc, char* argv[])
          arguments.algorithm = optarg;
          break;
          //
+         // n_batch
+         case 'b':
+         arguments.n_batch = size_t( std::atol( optarg ) );
+         break;
+         //
+         // n_checkpoint
+         case 'c':
+         arguments.n_checkpoint = size_t( std::atol( optarg ) );
+         break;
+         //
+         // derivative
+         case 'd':
+         arguments.derivative = optarg;
+         break;
+         //
+         // tape_load
+         case 'e':
+         arguments.tape_load = optarg;
+         break;
+         //
          // file_name
          case 'f':
          arguments.file_name = optarg;
          break;
          //
+         // jit_flags
+         case 'g':
+         arguments.jit_flags = optarg;
+         break;
+         //
+         // n_thread
+         case 'j':
+         arguments.n_thread = size_t( std::atol( optarg ) );
+         break;
+         //
+         // n_split
+         case 'k':
+         arguments.n_split = size_t( std::atol( optarg ) );
+         break;
+         //
+         // jit_load
+         case 'l':
+         arguments.jit_load = optarg;
+         break;
+         //
          // min_time
          case 'm':
          arguments.min_time = std::atof( optarg );
@@ -139,6 +216,21 @@ arguments_t parse_args(int argc, char* argv[])
          arguments.package = optarg;
          break;
          //
+         // n_direction
+         case 'r':
+         arguments.n_direction = size_t( std::atol( optarg ) );
+         break;
+         //
+         // seed
+         case 's':
+         arguments.seed = size_t( std::atol( optarg ) );
+         break;
+         //
+         // data_mode
+         case 'u':
+         arguments.data_mode = optarg;
+         break;
+         //
          // version
          case 'v':
          version = true;
@@ -154,6 +246,11 @@ arguments_t parse_args(int argc, char* argv[])
          arguments.time_setup = true;
          break;
          //
+         // thread_sweep
+         case 'w':
+         arguments.thread_sweep = true;
+         break;
+         //
          // ?
          case '?':
          error_msg  = "cmpad: exiting due to option error";
@@ -172,9 +269,31 @@ arguments_t parse_args(int argc, char* argv[])
    {  const char* usage =
          "cmpad: Compare C++ AD packages\n\n"
          "-a: --algorithm:  string: "
-            "is det_by_minor, an_ode or llsq_obj [det_by_minor]\n"
+            "is det_by_minor, det_by_lu, det_by_memo, an_ode, an_ode_adaptive\n"
+            "                          pde_residual, llsq_obj, rosen_obj, "
+            "or huber_obj [det_by_minor]\n"
+         "-b: --batch:      size_t: "
+            "number of argument points in each gradient call [1]\n"
+         "-c: --n_checkpoint: size_t: "
+            "number of checkpoints for an_ode gradients [none]\n"
+         "-d: --derivative: string: "
+            "is gradient, hessian, hessian_vector, jacobian,\n"
+            "                          jacobian_forward, jacobian_reverse, "
+            "sparse_jacobian,\n"
+            "                          sparse_hessian, jvp, vjp, "
+            "or tiered_gradient [gradient]\n"
+         "-e: --tape_load:  string: "
+            "is record or file, how cppad gradients get their tape [record]\n"
          "-f: --file_name:  string: "
             "csv file that line is added to [cmpad.csv]\n"
+         "-g: --jit_flags:  string: "
+            "C compiler flags for cppad_jit and cppadcg sources []\n"
+         "-j: --n_thread:   size_t: "
+            "number of threads that evaluate each batch [1]\n"
+         "-k: --n_split:    size_t: "
+            "number of parts for cppad_jit and cppadcg sources [1]\n"
+         "-l: --jit_load:   string: "
+            "is file, cache, or memory, how cppad_jit loads its dll [file]\n"
          "-m: --min_time:   double: "
             "minimum time in seconds to average computation rate [0.5]\n"
          "-n: --n_arg:      size_t: "
@@ -183,8 +302,16 @@ arguments_t parse_args(int argc, char* argv[])
             "The meaning opf this integer is algorithm specific [0]\n"
          "-p: --package:    string: "
             "none or an AD packae name [none]\n"
+         "-r: --n_direction: size_t: "
+            "number of directions for jvp and vjp derivatives [1]\n"
+         "-s: --seed:       size_t: "
+            "seed used to generate the argument values [0]\n"
+         "-u: --data_mode:  string: "
+            "is constant, retape, or dynamic [constant]\n"
          "-t: --time_setup:       : "
             "if present, include setup time in speed [false]\n"
+         "-w: --thread_sweep:     : "
+            "if present, time 1, 2, 4, ... , n_thread threads [false]\n"
          "-v: --version:          : "
             "if present, print the cmpad version number and halt [false]\n"
          "-h: --help:             : "
@@ -17,6 +17,18 @@ struct arguments_t
    std::string  package;
    size_t       n_arg;
    bool         time_setup;
+   size_t       seed;
+   size_t       n_checkpoint;
+   std::string  derivative;
+   size_t       n_batch;
+   size_t       n_thread;
+   bool         thread_sweep;
+   size_t       n_direction;
+   std::string  jit_load;
+   size_t       n_split;
+   std::string  jit_flags;
+   std::string  tape_load;
+   std::string  data_mode;
 };
 // END ARGUMENTS_T
 
@@ -35,8 +35,14 @@ Source Code
 // BEGIN C++
 
 // std namespace
+# include <chrono>
+# include <cmath>
+# include <iomanip>
+# include <type_traits>
+# include <limits>
 # include <algorithm>
 # include <string>
+# include <map>
 # include <iostream>
 
 // cmpad utilities
@@ -44,11 +50,28 @@ Source Code
 # include <cmpad/option_t.hpp>
 # include <cmpad/fun_speed.hpp>
 # include <cmpad/csv_speed.hpp>
+# include <cmpad/grad_check.hpp>
+# include <cmpad/der_check.hpp>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/checkpoint_gradient.hpp>
+# include <cmpad/batch_loop.hpp>
+# include <cmpad/batch_thread.hpp>
+# include <cmpad/tiered_gradient.hpp>
+# include <cmpad/retape_count.hpp>
+# include <cmpad/cppad/parallel_setup.hpp>
+# include <cmpad/cppad/tape_file.hpp>
 //
 // cmpad algorithms
 #
 # include <cmpad/algo/det_by_minor.hpp>
+# include <cmpad/algo/det_by_lu.hpp>
+# include <cmpad/algo/det_by_memo.hpp>
 # include <cmpad/algo/an_ode.hpp>
+# include <cmpad/algo/an_ode_adaptive.hpp>
+# include <cmpad/algo/pde_residual.hpp>
+# include <cmpad/algo/rosen_obj.hpp>
+# include <cmpad/algo/huber_obj.hpp>
 # include <cmpad/algo/llsq_obj.hpp>
 //
 // cmpad gradients
@@ -61,36 +84,773 @@ Source Code
 # include <cmpad/cppadcg/gradient.hpp>
 # include <cmpad/sacado/gradient.hpp>
 //
+// cmpad hessians
+# include <cmpad/adolc/hessian.hpp>
+# include <cmpad/autodiff/hessian.hpp>
+# include <cmpad/codi/hessian.hpp>
+# include <cmpad/cppad/hessian.hpp>
+# include <cmpad/cppad_jit/hessian.hpp>
+# include <cmpad/cppadcg/hessian.hpp>
+# include <cmpad/sacado/hessian.hpp>
+//
+// cmpad hessian_vectors
+# include <cmpad/adolc/hessian_vector.hpp>
+# include <cmpad/codi/hessian_vector.hpp>
+# include <cmpad/cppad/hessian_vector.hpp>
+# include <cmpad/cppad_jit/hessian_vector.hpp>
+# include <cmpad/cppadcg/hessian_vector.hpp>
+# include <cmpad/sacado/hessian_vector.hpp>
+//
+// cmpad jacobians
+# include <cmpad/adept/jacobian.hpp>
+# include <cmpad/adolc/jacobian.hpp>
+# include <cmpad/autodiff/jacobian.hpp>
+# include <cmpad/codi/jacobian.hpp>
+# include <cmpad/cppad/jacobian.hpp>
+# include <cmpad/cppad_jit/jacobian.hpp>
+# include <cmpad/sacado/jacobian.hpp>
+//
+// cmpad jvps
+# include <cmpad/adept/jvp.hpp>
+# include <cmpad/adolc/jvp.hpp>
+# include <cmpad/autodiff/jvp.hpp>
+# include <cmpad/codi/jvp.hpp>
+# include <cmpad/cppad/jvp.hpp>
+# include <cmpad/cppad_jit/jvp.hpp>
+# include <cmpad/sacado/jvp.hpp>
+//
+// cmpad vjps
+# include <cmpad/adept/vjp.hpp>
+# include <cmpad/adolc/vjp.hpp>
+# include <cmpad/codi/vjp.hpp>
+# include <cmpad/cppad/vjp.hpp>
+# include <cmpad/cppad_jit/vjp.hpp>
+//
+// cmpad sparse_jacobians
+# include <cmpad/adolc/sparse_jacobian.hpp>
+# include <cmpad/cppad/sparse_jacobian.hpp>
+# include <cmpad/cppadcg/sparse_jacobian.hpp>
+//
+// cmpad sparse_hessians
+# include <cmpad/adolc/sparse_hessian.hpp>
+# include <cmpad/cppad/sparse_hessian.hpp>
+# include <cmpad/cppadcg/sparse_hessian.hpp>
+//
 // local
 # include "parse_args.hpp"
 
-// CMPAD_PACKAGE_TEST
-# define CMPAD_PACKAGE_TEST(package) \
-   if( algorithm == "det_by_minor" ) \
-   {  cmpad::package::gradient<cmpad::det_by_minor> grad_det; \
-      double rate = cmpad::fun_speed(grad_det, option, min_time); \
-      cmpad::csv_speed( \
-         file_name, rate, min_time, #package , algorithm, special, option \
-      ); \
-      case_found = true; \
-   } \
-   else if( algorithm == "an_ode" ) \
-   {  cmpad::package::gradient<cmpad::an_ode> grad_ode; \
-      double rate = cmpad::fun_speed(grad_ode, option, min_time); \
-      cmpad::csv_speed( \
-         file_name, rate, min_time, #package , algorithm, special, option \
-      ); \
-      case_found = true; \
-   } \
-   else if( algorithm == "llsq_obj" ) \
-   {  cmpad::package::gradient<cmpad::llsq_obj> grad_llsq; \
-      double rate = cmpad::fun_speed(grad_llsq, option, min_time); \
-      cmpad::csv_speed( \
-         file_name, rate, min_time, #package , algorithm, special, option \
-      ); \
-      case_found = true; \
+// run_t
+// the arguments that are the same for all the speed tests in one execution
+struct run_t {
+   std::string      file_name;
+   double           min_time;
+   std::string      package;
+   std::string      algorithm;
+   std::string      derivative;
+   std::string      jacobian_mode;
+   bool             thread_sweep;
+   cmpad::option_t  option;
+};
+
+// grad_speed
+// Check a gradient, and if it passes, determine its speed.
+// The result is recorded in run.file_name and the return value is true (false)
+// if the gradient passed (failed) the check.
+template < template<class Vector> class Algo, class Gradient >
+bool grad_speed(Gradient& grad, const run_t& run, bool special)
+{  //
+   // rel_tol
+   double rel_tol = 1e-6;
+   //
+   // ok, rel_error
+   double rel_error;
+   bool ok = cmpad::grad_check<Algo>(grad, run.option, rel_tol, rel_error);
+   //
+   // rate
+   double rate = std::numeric_limits<double>::quiet_NaN();
+   if( ok )
+      rate = cmpad::fun_speed(grad, run.option, run.min_time);
+   else
+   {  std::cerr << "run_cmpad Error: package = " << run.package
+                << ", algorithm = " << run.algorithm
+                << ": gradient check failed, rel_error = "
+                << rel_error << "\n";
+   }
+   //
+   // run.file_name
+   cmpad::csv_speed( run.file_name, rate, run.min_time,
+      run.package, run.algorithm, "gradient", special, run.option, rel_error
+   );
+   return ok;
+}
+
+// batch_check_speed
+// Check a gradient, and a batch of gradients that uses the same package,
+// and if they pass, determine the speed of the batch.
+// The rate recorded in run.file_name, and returned in rate, is the number of
+// gradients per second and the return value is true (false) if the check
+// passed (failed).
+template < template<class Vector> class Algo, class Gradient, class Batch >
+bool batch_check_speed(
+   Gradient& grad, Batch& batch, const run_t& run, double& rate
+)
+{  //
+   // rel_tol
+   double rel_tol = 1e-6;
+   //
+   // ok, rel_error
+   double rel_error;
+   bool ok = cmpad::grad_check<Algo>(grad, run.option, rel_tol, rel_error);
+   //
+   // n, n_batch
+   size_t n       = grad.domain();
+   size_t n_batch = run.option.n_batch;
+   //
+   // x
+   cmpad::vector<double> x(n_batch * n);
+   cmpad::uniform_01_t rng(run.option.seed);
+   rng(x);
+   //
+   // g
+   batch.setup(run.option);
+   cmpad::vector<double> g = batch(x);
+   //
+   // ok, rel_error
+   // the batch must agree with the gradient at each point
+   cmpad::vector<double> x_k(n);
+   for(size_t k = 0; k < n_batch; ++k)
+   {  for(size_t j = 0; j < n; ++j)
+         x_k[j] = x[k * n + j];
+      const cmpad::vector<double>& g_k = grad(x_k);
+      for(size_t j = 0; j < n; ++j)
+      {  ok &= cmpad::near_equal(g[k * n + j], g_k[j], rel_tol);
+         double s   = std::max( 1.0, std::fabs( g_k[j] ) );
+         double err = std::fabs( g[k * n + j] - g_k[j] ) / s;
+         if( ! (err <= rel_error) )
+            rel_error = err;
+      }
+   }
+   //
+   // rate
+   rate = std::numeric_limits<double>::quiet_NaN();
+   if( ok )
+   {  rate  = cmpad::fun_speed(batch, run.option, run.min_time);
+      rate *= double(n_batch);
+   }
+   else
+   {  std::cerr << "run_cmpad Error: package = " << run.package
+                << ", algorithm = " << run.algorithm
+                << ": batch gradient check failed, rel_error = "
+                << rel_error << "\n";
+   }
+   //
+   // run.file_name
+   bool special = false;
+   cmpad::csv_speed( run.file_name, rate, run.min_time,
+      run.package, run.algorithm, "gradient", special, run.option, rel_error
+   );
+   return ok;
+}
+
+// batch_speed
+// Use batch_thread if option.n_thread > 1 and batch_loop otherwise.
+template <
+   template< template<class ADVector> class Algo > class Gradient ,
+   template<class ADVector> class Algo
+>
+bool batch_speed(const run_t& run, double& rate)
+{  //
+   // grad
+   Gradient<Algo> grad;
+   //
+   // batch_check_speed
+   if( run.option.n_thread > 1 )
+   {  cmpad::batch_thread<Gradient, Algo> batch;
+      return batch_check_speed<Algo>(grad, batch, run, rate);
    }
+   cmpad::batch_loop<Gradient, Algo> batch;
+   return batch_check_speed<Algo>(grad, batch, run, rate);
+}
 
+// thread_sweep
+// Use batch_speed with n_thread equal to 1, 2, 4, ... , and option.n_thread.
+// Each rate is recorded in run.file_name and its speedup, relative to
+// one thread, is printed on standard output.
+template <
+   template< template<class ADVector> class Algo > class Gradient ,
+   template<class ADVector> class Algo
+>
+bool thread_sweep(const run_t& run)
+{  //
+   // n_thread, run_sweep
+   size_t n_thread  = run.option.n_thread;
+   run_t  run_sweep = run;
+   //
+   // ok, rate_one
+   bool   ok       = true;
+   double rate_one = std::numeric_limits<double>::quiet_NaN();
+   //
+   // t
+   size_t t = 1;
+   while( t <= n_thread )
+   {  //
+      // ok, rate
+      double rate;
+      run_sweep.option.n_thread = t;
+      ok &= batch_speed<Gradient, Algo>(run_sweep, rate);
+      if( t == 1 )
+         rate_one = rate;
+      //
+      std::cout << "run_cmpad: thread_sweep: n_thread = " << t
+         << ", rate = " << std::setprecision(1) << std::scientific << rate
+         << ", speedup = " << std::setprecision(2) << std::fixed
+         << rate / rate_one << "\n";
+      //
+      // t
+      if( t == n_thread )
+         break;
+      t = std::min(2 * t, n_thread);
+   }
+   return ok;
+}
+
+// gradient_speed
+// Use thread_sweep (batch_speed) if option.n_batch > 1 and run.thread_sweep
+// is true (false), checkpoint_gradient if option.n_checkpoint is present
+// (only for an_ode), and grad_speed otherwise.
+// When checkpoint_gradient is used, its recompute cost is printed.
+template <
+   template< template<class ADVector> class Algo > class Gradient ,
+   template<class ADVector> class Algo
+>
+bool gradient_speed(const run_t& run)
+{  bool special = false;
+   if( run.option.n_batch > 1 )
+   {  if( run.thread_sweep )
+         return thread_sweep<Gradient, Algo>(run);
+      double rate;
+      return batch_speed<Gradient, Algo>(run, rate);
+   }
+   if( run.option.n_checkpoint != std::numeric_limits<size_t>::max() )
+   {  cmpad::checkpoint_gradient<Gradient> grad;
+      bool ok = grad_speed<Algo>(grad, run, special);
+      std::cout << "run_cmpad: checkpoint: n_checkpoint = "
+         << grad.option().n_checkpoint << ", n_forward_step = "
+         << grad.n_forward_step() << "\n";
+      return ok;
+   }
+   Gradient<Algo> grad;
+   return grad_speed<Algo>(grad, run, special);
+}
+
+# if CMPAD_HAS_CPPAD
+// tiered_speed
+// Check a tiered_gradient that uses cmpad::cppad::gradient for its
+// interpreted gradient and Compiled for its compiled gradient.
+// If it passes, print its time to first gradient and determine its speed.
+// The result is recorded in run.file_name and the return value is true (false)
+// if the check passed (failed). If it passes, the cold start times are also
+// recorded using the tiered_first, tiered_compiled, tiered_n_eval, and
+// compiled_n_eval derivative rows.
+template <
+   template< template<class ADVector> class Algo > class Compiled ,
+   template<class ADVector> class Algo
+>
+bool tiered_speed(const run_t& run)
+{  //
+   // steady_clock, duration
+   using std::chrono::steady_clock;
+   typedef std::chrono::duration<double> duration;
+   //
+   // option
+   const cmpad::option_t& option = run.option;
+   //
+   // rel_tol
+   double rel_tol = 1e-6;
+   //
+   // grad
+   cmpad::tiered_gradient<cmpad::cppad::gradient, Compiled, Algo> grad;
+   //
+   // ok, rel_error
+   // grad_check starts a background thread that must finish before
+   // the cold start below starts its background thread
+   double rel_error;
+   bool ok = cmpad::grad_check<Algo>(grad, option, rel_tol, rel_error);
+   grad.wait();
+   //
+   // n_eval
+   // number of gradients for the fixed work cold start times
+   const size_t n_eval = 1000;
+   //
+   // cold, t_first, t_compiled, t_n_eval
+   // cold start: time to first gradient, time until compiled,
+   // and time for setup plus n_eval gradients
+   cmpad::tiered_gradient<cmpad::cppad::gradient, Compiled, Algo> cold;
+   cmpad::uniform_01_t rng(option.seed);
+   auto   t_start = steady_clock::now();
+   cold.setup(option);
+   cmpad::vector<double> x( cold.domain() );
+   rng(x);
+   cold(x);
+   double t_first    = duration(steady_clock::now() - t_start).count();
+   double t_compiled = std::numeric_limits<double>::quiet_NaN();
+   double t_n_eval   = std::numeric_limits<double>::quiet_NaN();
+   size_t count      = 1;
+   while( std::isnan(t_compiled) || count < n_eval )
+   {  rng(x);
+      cold(x);
+      ++count;
+      double t = duration(steady_clock::now() - t_start).count();
+      if( std::isnan(t_compiled) && cold.compiled() )
+         t_compiled = t;
+      if( count == n_eval )
+         t_n_eval = t;
+   }
+   //
+   // compiled, t_n_compiled
+   // cold start: time for setup plus n_eval gradients without tiering
+   Compiled<Algo> compiled;
+   t_start = steady_clock::now();
+   compiled.setup(option);
+   for(size_t k = 0; k < n_eval; ++k)
+   {  rng(x);
+      compiled(x);
+   }
+   double t_n_compiled = duration(steady_clock::now() - t_start).count();
+   std::cout << std::setprecision(1) << std::scientific
+      << "run_cmpad: tiered_gradient: first = " << t_first
+      << " sec, compiled = " << t_compiled
+      << " sec, interpreted = " << cold.n_interpreted() << "\n"
+      << "run_cmpad: tiered_gradient: n_eval = " << n_eval
+      << ", tiered = " << t_n_eval
+      << " sec, compiled = " << t_n_compiled << " sec\n";
+   //
+   // ok, rel_error
+   // check the compiled gradient
+   cmpad::cppad::gradient<Algo> check;
+   check.setup(option);
+   rng(x);
+   const cmpad::vector<double>& g = cold(x);
+   const cmpad::vector<double>& c = check(x);
+   for(size_t j = 0; j < x.size(); ++j)
+   {  ok &= cmpad::near_equal(g[j], c[j], rel_tol);
+      double s   = std::max( 1.0, std::fabs( c[j] ) );
+      double err = std::fabs( g[j] - c[j] ) / s;
+      if( ! (err <= rel_error) )
+         rel_error = err;
+   }
+   //
+   // rate
+   double rate = std::numeric_limits<double>::quiet_NaN();
+   if( ok )
+      rate = cmpad::fun_speed(grad, option, run.min_time);
+   else
+   {  std::cerr << "run_cmpad Error: package = " << run.package
+                << ", algorithm = " << run.algorithm
+                << ": tiered gradient check failed, rel_error = "
+                << rel_error << "\n";
+   }
+   //
+   // run.file_name
+   bool special = false;
+   cmpad::csv_speed( run.file_name, rate, run.min_time,
+      run.package, run.algorithm, "tiered_gradient", special, option, rel_error
+   );
+   if( ! ok )
+      return ok;
+   //
+   // run.file_name
+   // cold start rows, the rate is the number of cold starts per second
+   // except for the n_eval rows which have the gradients per second
+   std::string derivative[] = {
+      "tiered_first", "tiered_compiled", "tiered_n_eval", "compiled_n_eval"
+   };
+   double cold_rate[] = {
+      1.0 / t_first,
+      1.0 / t_compiled,
+      double(n_eval) / t_n_eval,
+      double(n_eval) / t_n_compiled
+   };
+   rel_error = std::numeric_limits<double>::quiet_NaN();
+   for(size_t k = 0; k < 4; ++k)
+   {  cmpad::csv_speed( run.file_name, cold_rate[k], run.min_time,
+         run.package, run.algorithm, derivative[k], special, option, rel_error
+      );
+   }
+   return ok;
+}
+# endif
+
+// der_record
+// If ok is true, determine the speed of a derivative that has been checked.
+// Otherwise, report the failure and use nan for the rate.
+// The result is recorded in run.file_name and the return value is ok.
+template <class Derivative>
+bool der_record(
+   Derivative&        der        ,
+   const std::string& derivative ,
+   const run_t&       run        ,
+   bool               ok         ,
+   double             rel_error  )
+{  //
+   // rate
+   double rate = std::numeric_limits<double>::quiet_NaN();
+   if( ok )
+      rate = cmpad::fun_speed(der, run.option, run.min_time);
+   else
+   {  std::cerr << "run_cmpad Error: package = " << run.package
+                << ", algorithm = " << run.algorithm
+                << ": " << derivative << " check failed, rel_error = "
+                << rel_error << "\n";
+   }
+   //
+   // run.file_name
+   bool special = false;
+   cmpad::csv_speed( run.file_name, rate, run.min_time,
+      run.package, run.algorithm, derivative, special, run.option, rel_error
+   );
+   return ok;
+}
+
+// der_speed
+// Check a jvp, vjp, or sparse_jacobian using central differences of
+// the algorithm; see der_record.
+// For a sparse_jacobian that passes the check, a sparse_jacobian_sparsity
+// row is also recorded with rate equal to one over its sparsity_time.
+template <
+   template< template<class ADVector> class Algo > class Derivative ,
+   template<class ADVector> class Algo
+>
+bool der_speed(const run_t& run)
+{  //
+   // der
+   Derivative<Algo> der;
+   //
+   // ok, rel_error
+   double rel_tol = 1e-6;
+   double rel_error;
+   bool ok = cmpad::der_check<Algo>(der, run.option, rel_tol, rel_error);
+   //
+   // ok
+   ok = der_record(der, run.derivative, run, ok, rel_error);
+   //
+   // is_sparse_jacobian
+   constexpr bool is_sparse_jacobian =
+      std::is_base_of< cmpad::sparse_jacobian, Derivative<Algo> >::value;
+   //
+   // run.file_name
+   // sparsity_time is from the most recent setup
+   if constexpr( is_sparse_jacobian )
+   {  double sparsity_time = der.sparsity_time();
+      if( ok && ! std::isnan(sparsity_time) )
+      {  std::cout << std::setprecision(1) << std::scientific
+            << "run_cmpad: sparse_jacobian: sparsity_time = "
+            << sparsity_time << " sec\n";
+         bool   special = false;
+         double rate    = 1.0 / sparsity_time;
+         rel_error      = std::numeric_limits<double>::quiet_NaN();
+         cmpad::csv_speed( run.file_name, rate, run.min_time,
+            run.package, run.algorithm, "sparse_jacobian_sparsity",
+            special, run.option, rel_error
+         );
+      }
+   }
+   return ok;
+}
+
+// hes_speed
+// Check a second order derivative using central differences of the
+// gradient for the same package (which is checked first); see der_record.
+template <
+   template< template<class ADVector> class Algo > class Derivative ,
+   template< template<class ADVector> class Algo > class Gradient   ,
+   template<class ADVector> class Algo
+>
+bool hes_speed(const run_t& run)
+{  //
+   // der, grad
+   Derivative<Algo> der;
+   Gradient<Algo>   grad;
+   //
+   // ok, rel_error
+   double rel_tol = 1e-6;
+   double rel_error;
+   bool ok = cmpad::der_check<Algo>(der, grad, run.option, rel_tol, rel_error);
+   //
+   return der_record(der, run.derivative, run, ok, rel_error);
+}
+
+// jac_speed
+// Check a Jacobian using central differences of the algorithm;
+// see der_record. The derivative column is jacobian_forward or
+// jacobian_reverse depending on the mode that the Jacobian used.
+template <
+   template< template<class ADVector> class Algo > class Jacobian ,
+   template<class ADVector> class Algo
+>
+bool jac_speed(const run_t& run)
+{  //
+   // jac
+   Jacobian<Algo> jac;
+   //
+   // ok, rel_error
+   // der_check calls jac.setup which determines jac.mode()
+   jac.set_mode(run.jacobian_mode);
+   double rel_tol = 1e-6;
+   double rel_error;
+   bool ok = cmpad::der_check<Algo>(jac, run.option, rel_tol, rel_error);
+   //
+   std::string derivative = "jacobian_" + jac.mode();
+   return der_record(jac, derivative, run, ok, rel_error);
+}
+
+// none_speed
+// Determine the speed of the algorithm using double (no derivative)
+// and record it in run.file_name.
+template < template<class Vector> class Algo >
+bool none_speed(const run_t& run)
+{  //
+   // algo
+   Algo< cmpad::vector<double> > algo;
+   //
+   // rate
+   double rate = cmpad::fun_speed(algo, run.option, run.min_time);
+   //
+   // rel_error
+   // there is no derivative to check
+   double rel_error = std::numeric_limits<double>::quiet_NaN();
+   //
+   // run.file_name
+   bool special = false;
+   cmpad::csv_speed( run.file_name, rate, run.min_time,
+      "none", run.algorithm, run.derivative, special, run.option, rel_error
+   );
+   return true;
+}
+
+// package_speed
+// Run the speed test for one algorithm with the package and derivative
+// in run. The return value is false if a derivative check failed.
+// The package and derivative combinations have already been checked by main.
+template < template<class Vector> class Algo >
+bool package_speed(const run_t& run)
+{  //
+   // package, derivative
+   const std::string& package    = run.package;
+   const std::string& derivative = run.derivative;
+   //
+   if( package == "none" )
+      return none_speed<Algo>(run);
+   //
+# if CMPAD_HAS_ADEPT
+   if( package == "adept" )
+   {  if( derivative == "jacobian" )
+         return jac_speed<cmpad::adept::jacobian, Algo>(run);
+      if( derivative == "jvp" )
+         return der_speed<cmpad::adept::jvp, Algo>(run);
+      if( derivative == "vjp" )
+         return der_speed<cmpad::adept::vjp, Algo>(run);
+      return gradient_speed<cmpad::adept::gradient, Algo>(run);
+   }
+# endif
+# if CMPAD_HAS_ADOLC
+   if( package == "adolc" )
+   {  if( derivative == "sparse_jacobian" )
+         return der_speed<cmpad::adolc::sparse_jacobian, Algo>(run);
+      if( derivative == "sparse_hessian" )
+         return hes_speed<
+            cmpad::adolc::sparse_hessian, cmpad::adolc::gradient, Algo
+         >(run);
+      if( derivative == "hessian" )
+         return hes_speed<
+            cmpad::adolc::hessian, cmpad::adolc::gradient, Algo
+         >(run);
+      if( derivative == "hessian_vector" )
+         return hes_speed<
+            cmpad::adolc::hessian_vector, cmpad::adolc::gradient, Algo
+         >(run);
+      if( derivative == "jacobian" )
+         return jac_speed<cmpad::adolc::jacobian, Algo>(run);
+      if( derivative == "jvp" )
+         return der_speed<cmpad::adolc::jvp, Algo>(run);
+      if( derivative == "vjp" )
+         return der_speed<cmpad::adolc::vjp, Algo>(run);
+      return gradient_speed<cmpad::adolc::gradient, Algo>(run);
+   }
+# endif
+# if CMPAD_HAS_AUTODIFF
+   if( package == "autodiff" )
+   {  if( derivative == "hessian" )
+         return hes_speed<
+            cmpad::autodiff::hessian, cmpad::autodiff::gradient, Algo
+         >(run);
+      if( derivative == "jacobian" )
+         return jac_speed<cmpad::autodiff::jacobian, Algo>(run);
+      if( derivative == "jvp" )
+         return der_speed<cmpad::autodiff::jvp, Algo>(run);
+      return gradient_speed<cmpad::autodiff::gradient, Algo>(run);
+   }
+# endif
+# if CMPAD_HAS_CODI
+   if( package == "codi" )
+   {  if( derivative == "hessian" )
+         return hes_speed<
+            cmpad::codi::hessian, cmpad::codi::gradient, Algo
+         >(run);
+      if( derivative == "hessian_vector" )
+         return hes_speed<
+            cmpad::codi::hessian_vector, cmpad::codi::gradient, Algo
+         >(run);
+      if( derivative == "jacobian" )
+         return jac_speed<cmpad::codi::jacobian, Algo>(run);
+      if( derivative == "jvp" )
+         return der_speed<cmpad::codi::jvp, Algo>(run);
+      if( derivative == "vjp" )
+         return der_speed<cmpad::codi::vjp, Algo>(run);
+      return gradient_speed<cmpad::codi::gradient, Algo>(run);
+   }
+# endif
+# if CMPAD_HAS_CPPAD
+   if( package == "cppad" )
+   {  if( derivative == "sparse_jacobian" )
+         return der_speed<cmpad::cppad::sparse_jacobian, Algo>(run);
+      if( derivative == "sparse_hessian" )
+         return hes_speed<
+            cmpad::cppad::sparse_hessian, cmpad::cppad::gradient, Algo
+         >(run);
+      if( derivative == "hessian" )
+         return hes_speed<
+            cmpad::cppad::hessian, cmpad::cppad::gradient, Algo
+         >(run);
+      if( derivative == "hessian_vector" )
+         return hes_speed<
+            cmpad::cppad::hessian_vector, cmpad::cppad::gradient, Algo
+         >(run);
+      if( derivative == "jacobian" )
+         return jac_speed<cmpad::cppad::jacobian, Algo>(run);
+      if( derivative == "jvp" )
+         return der_speed<cmpad::cppad::jvp, Algo>(run);
+      if( derivative == "vjp" )
+         return der_speed<cmpad::cppad::vjp, Algo>(run);
+      return gradient_speed<cmpad::cppad::gradient, Algo>(run);
+   }
+# endif
+# if CMPAD_HAS_CPPAD_JIT
+   if( package == "cppad_jit" )
+   {  if( derivative == "tiered_gradient" )
+         return tiered_speed<cmpad::cppad_jit::gradient, Algo>(run);
+      if( derivative == "hessian" )
+         return hes_speed<
+            cmpad::cppad_jit::hessian, cmpad::cppad_jit::gradient, Algo
+         >(run);
+      if( derivative == "hessian_vector" )
+         return hes_speed<
+            cmpad::cppad_jit::hessian_vector, cmpad::cppad_jit::gradient, Algo
+         >(run);
+      if( derivative == "jacobian" )
+         return jac_speed<cmpad::cppad_jit::jacobian, Algo>(run);
+      if( derivative == "jvp" )
+         return der_speed<cmpad::cppad_jit::jvp, Algo>(run);
+      if( derivative == "vjp" )
+         return der_speed<cmpad::cppad_jit::vjp, Algo>(run);
+      return gradient_speed<cmpad::cppad_jit::gradient, Algo>(run);
+   }
+# endif
+# if CMPAD_HAS_CPPADCG
+   if( package == "cppadcg" )
+   {  if( derivative == "sparse_jacobian" )
+         return der_speed<cmpad::cppadcg::sparse_jacobian, Algo>(run);
+      if( derivative == "sparse_hessian" )
+         return hes_speed<
+            cmpad::cppadcg::sparse_hessian, cmpad::cppadcg::gradient, Algo
+         >(run);
+      if( derivative == "tiered_gradient" )
+         return tiered_speed<cmpad::cppadcg::gradient, Algo>(run);
+      if( derivative == "hessian" )
+         return hes_speed<
+            cmpad::cppadcg::hessian, cmpad::cppadcg::gradient, Algo
+         >(run);
+      if( derivative == "hessian_vector" )
+         return hes_speed<
+            cmpad::cppadcg::hessian_vector, cmpad::cppadcg::gradient, Algo
+         >(run);
+      return gradient_speed<cmpad::cppadcg::gradient, Algo>(run);
+   }
+# endif
+# if CMPAD_HAS_SACADO
+   if( package == "sacado" )
+   {  if( derivative == "hessian" )
+         return hes_speed<
+            cmpad::sacado::hessian, cmpad::sacado::gradient, Algo
+         >(run);
+      if( derivative == "hessian_vector" )
+         return hes_speed<
+            cmpad::sacado::hessian_vector, cmpad::sacado::gradient, Algo
+         >(run);
+      if( derivative == "jacobian" )
+         return jac_speed<cmpad::sacado::jacobian, Algo>(run);
+      if( derivative == "jvp" )
+         return der_speed<cmpad::sacado::jvp, Algo>(run);
+      return gradient_speed<cmpad::sacado::gradient, Algo>(run);
+   }
+# endif
+   //
+   std::cerr << "cmpad: BUG: package = " << package
+             << ", derivative = " << derivative << "\n";
+   return false;
+}
+
+// x_branch
+// is the algorithm's x_branch true for this package and option
+template < template<class Vector> class Algo >
+bool x_branch(
+   [[maybe_unused]] const std::string& package ,
+   const cmpad::option_t&              option  )
+{
+# if CMPAD_HAS_CODI
+   // the codi onetape gradient records using this scalar type
+   if( package == "codi" )
+   {  Algo< cmpad::vector< ::codi::RealReversePrimal > > algo;
+      algo.setup(option);
+      return algo.x_branch();
+   }
+# endif
+   Algo< cmpad::vector<double> > algo;
+   algo.setup(option);
+   return algo.x_branch();
+}
+
+// algorithm_t
+// the functions in run_cmpad that depend on the algorithm
+typedef bool (*speed_test_t)(const run_t& run);
+typedef bool (*x_branch_t)(
+   const std::string& package, const cmpad::option_t& option
+);
+struct algorithm_t {
+   speed_test_t speed_test;
+   x_branch_t   x_branch;
+};
+template < template<class Vector> class Algo >
+algorithm_t algorithm_entry(void)
+{  return { package_speed<Algo>, x_branch<Algo> };
+}
+
+// algorithm_table
+// maps each algorithm name to the functions for that algorithm
+const std::map<std::string, algorithm_t>& algorithm_table(void)
+{  static const std::map<std::string, algorithm_t> table = {
+      { "det_by_minor",    algorithm_entry<cmpad::det_by_minor>()    } ,
+      { "det_by_lu",       algorithm_entry<cmpad::det_by_lu>()       } ,
+      { "det_by_memo",     algorithm_entry<cmpad::det_by_memo>()     } ,
+      { "an_ode",          algorithm_entry<cmpad::an_ode>()          } ,
+      { "an_ode_adaptive", algorithm_entry<cmpad::an_ode_adaptive>() } ,
+      { "pde_residual",    algorithm_entry<cmpad::pde_residual>()    } ,
+      { "llsq_obj",        algorithm_entry<cmpad::llsq_obj>()        } ,
+      { "rosen_obj",       algorithm_entry<cmpad::rosen_obj>()       } ,
+      { "huber_obj",       algorithm_entry<cmpad::huber_obj>()       }
+   };
+   return table;
+}
 
 // get_package_available
 cmpad::vector<std::string> get_package_available(void)
@@ -131,12 +891,6 @@ int main(int argc, char* argv[])
    // package_vec
    cmpad::vector<std::string> package_vec = get_package_available();
    //
-   // algorithm_vec
-   cmpad::vector<std::string> algorithm_vec;
-   algorithm_vec.push_back("det_by_minor");
-   algorithm_vec.push_back("an_ode");
-   algorithm_vec.push_back("llsq_obj");
-   //
    // itr
    cmpad::vector<std::string>::iterator itr;
    //
@@ -155,18 +909,21 @@ int main(int argc, char* argv[])
       return 1;
    }
    //
-   // algorithm
+   // algorithm, algo_fun
    std::string algorithm = arguments.algorithm;
-   itr = std::find(algorithm_vec.begin(), algorithm_vec.end(), algorithm);
-   if( itr == algorithm_vec.end() )
+   auto entry = algorithm_table().find(algorithm);
+   if( entry == algorithm_table().end() )
    {  std::cerr << "run_cmpad Error: ";
       std::cerr << "algorithm = " << algorithm << " is not available" << "\n";
       return 1;
    }
+   const algorithm_t& algo_fun = entry->second;
    //
    // n_arg
    size_t n_arg = arguments.n_arg;
-   if( algorithm == "det_by_minor" )
+   bool is_det = algorithm == "det_by_minor" || algorithm == "det_by_lu";
+   is_det     |= algorithm == "det_by_memo";
+   if( is_det || algorithm == "pde_residual" )
    {  size_t ell = size_t( std::sqrt( double(n_arg) ) );
       if( ell * ell != n_arg )
          ++ell;
@@ -175,23 +932,321 @@ int main(int argc, char* argv[])
                    << ": n_arg = " << n_arg << " is not a square.\n";
          return 1;
       }
-      if( n_other > 0 )
+   }
+   bool n_other_zero = algorithm == "det_by_minor";
+   n_other_zero     |= algorithm == "det_by_memo";
+   n_other_zero     |= algorithm == "pde_residual";
+   n_other_zero     |= algorithm == "rosen_obj";
+   if( n_other_zero )
+   {  if( n_other > 0 )
       {  std::cerr << "run_cmpad Error: algorithm = " << algorithm
                    << ": n_other = " << n_other << " is not zero.\n";
          return 1;
       }
    }
-   if( algorithm == "an_ode" )
+   if( algorithm == "rosen_obj" && n_arg < 2 )
+   {  std::cerr << "run_cmpad Error: algorithm = " << algorithm
+                << ": n_arg = " << n_arg << " is less than two.\n";
+      return 1;
+   }
+   if( algorithm == "det_by_lu" || algorithm == "huber_obj" )
+   {  if( n_other > 1 )
+      {  std::cerr << "run_cmpad Error: algorithm = " << algorithm
+                   << ": n_other = " << n_other << " is not zero or one.\n";
+         return 1;
+      }
+   }
+   if( algorithm == "an_ode" || algorithm == "an_ode_adaptive" )
    {  if( n_other <= 0 )
       {  std::cerr << "run_cmpad Error: algorithm = " << algorithm
                    << ": n_other = " << n_other << " is <= zero.\n";
          return 1;
       }
    }
+   // the tolerance 10^(-n_other) must be above roundoff
+   if( algorithm == "an_ode_adaptive" && n_other > 14 )
+   {  std::cerr << "run_cmpad Error: algorithm = " << algorithm
+                << ": n_other = " << n_other << " is greater than 14.\n";
+      return 1;
+   }
+   //
+   // n_checkpoint, checkpoint
+   // there is no gradient, and no checkpointing, for package none.
+   // The maximum size_t value means checkpointing is not used
+   // and zero means every step is recomputed from the start.
+   size_t n_checkpoint = arguments.n_checkpoint;
+   if( package == "none" )
+      n_checkpoint = std::numeric_limits<size_t>::max();
+   bool checkpoint = n_checkpoint != std::numeric_limits<size_t>::max();
+   if( checkpoint && algorithm != "an_ode" )
+   {  std::cerr << "run_cmpad Error: algorithm = " << algorithm
+                << ": n_checkpoint = " << n_checkpoint << " is present.\n";
+      return 1;
+   }
+   //
+   // n_batch
+   // there is no gradient, and no batch, for package none
+   size_t n_batch = arguments.n_batch;
+   if( package == "none" )
+      n_batch = 1;
+   if( n_batch == 0 )
+   {  std::cerr << "run_cmpad Error: n_batch is zero.\n";
+      return 1;
+   }
+   if( n_batch > 1 && checkpoint )
+   {  std::cerr << "run_cmpad Error: n_batch = " << n_batch
+                << ": n_checkpoint = " << n_checkpoint << " is present.\n";
+      return 1;
+   }
+   //
+   // n_thread
+   // each thread evaluates its own copy of the gradient, so the package must
+   // not share its tape between threads (adolc and codi keep global tape
+   // state and their thread safe configurations require OpenMP threads)
+   size_t n_thread = arguments.n_thread;
+   if( package == "none" )
+      n_thread = 1;
+   if( n_thread == 0 )
+   {  std::cerr << "run_cmpad Error: n_thread is zero.\n";
+      return 1;
+   }
+   if( n_thread > 1 && n_batch == 1 )
+   {  std::cerr << "run_cmpad Error: n_thread = " << n_thread
+                << ": n_batch is one.\n";
+      return 1;
+   }
+   if( n_thread > 1 )
+   {  bool cppad_based = package == "cppad" || package == "cppad_jit";
+      cppad_based     |= package == "cppadcg";
+      bool thread_safe = package == "adept" || package == "autodiff";
+      thread_safe     |= cppad_based;
+      if( ! thread_safe )
+      {  std::cerr << "run_cmpad Error: n_thread = " << n_thread
+                   << ": package = " << package << " is not thread safe.\n";
+         return 1;
+      }
+      if( cppad_based )
+         cmpad::cppad::parallel_setup(n_thread);
+   }
+   //
+   // thread_sweep
+   bool thread_sweep = arguments.thread_sweep;
+   if( package == "none" )
+      thread_sweep = false;
+   if( thread_sweep && n_thread == 1 )
+   {  std::cerr << "run_cmpad Error: thread_sweep: n_thread is one.\n";
+      return 1;
+   }
+   //
+   // derivative
+   // there is no derivative for package none
+   std::string derivative = arguments.derivative;
+   bool derivative_ok = derivative == "gradient";
+   derivative_ok     |= derivative == "hessian";
+   derivative_ok     |= derivative == "hessian_vector";
+   derivative_ok     |= derivative == "jacobian";
+   derivative_ok     |= derivative == "jacobian_forward";
+   derivative_ok     |= derivative == "jacobian_reverse";
+   derivative_ok     |= derivative == "sparse_jacobian";
+   derivative_ok     |= derivative == "sparse_hessian";
+   derivative_ok     |= derivative == "jvp";
+   derivative_ok     |= derivative == "vjp";
+   derivative_ok     |= derivative == "tiered_gradient";
+   if( ! derivative_ok )
+   {  std::cerr << "run_cmpad Error: ";
+      std::cerr << "derivative = " << derivative << " is not available\n";
+      return 1;
+   }
+   if( package == "none" )
+      derivative = "";
+   //
+   // jacobian_mode, derivative
+   // mode requested for the Jacobian; see cmpad::jacobian set_mode
+   std::string jacobian_mode = "auto";
+   if( derivative == "jacobian_forward" )
+   {  jacobian_mode = "forward";
+      derivative    = "jacobian";
+   }
+   if( derivative == "jacobian_reverse" )
+   {  jacobian_mode = "reverse";
+      derivative    = "jacobian";
+   }
+   if( derivative != "" && derivative != "gradient" )
+   {  //
+      // no_derivative
+      // packages that do not implement this derivative
+      cmpad::vector<std::string> no_derivative;
+      if( derivative == "hessian" || derivative == "hessian_vector" )
+         no_derivative.push_back("adept");
+      if( derivative == "hessian_vector" )
+         no_derivative.push_back("autodiff");
+      if( derivative == "jacobian" || derivative == "jvp" )
+         no_derivative.push_back("cppadcg");
+      if( derivative == "vjp" )
+      {  no_derivative.push_back("autodiff");
+         no_derivative.push_back("cppadcg");
+         no_derivative.push_back("sacado");
+      }
+      if( derivative == "tiered_gradient" )
+      {  // interpreted by cppad and compiled by cppad_jit or cppadcg
+         no_derivative = {
+            "adept", "adolc", "autodiff", "codi", "cppad", "sacado", "xad"
+         };
+      }
+      if( derivative == "sparse_jacobian" || derivative == "sparse_hessian" )
+      {  no_derivative.push_back("adept");
+         no_derivative.push_back("autodiff");
+         no_derivative.push_back("codi");
+         no_derivative.push_back("cppad_jit");
+         no_derivative.push_back("sacado");
+      }
+      if( checkpoint )
+      {  std::cerr << "run_cmpad Error: derivative = " << derivative
+                   << ": n_checkpoint = " << n_checkpoint << " is present.\n";
+         return 1;
+      }
+      if( n_batch > 1 )
+      {  std::cerr << "run_cmpad Error: derivative = " << derivative
+                   << ": n_batch = " << n_batch << " is not one.\n";
+         return 1;
+      }
+      itr = std::find(no_derivative.begin(), no_derivative.end(), package);
+      if( itr != no_derivative.end() )
+      {  std::cerr << "run_cmpad Error: derivative = " << derivative
+                   << ": package = " << package << " does not have it.\n";
+         return 1;
+      }
+      //
+      // parallel_setup
+      // the compiled gradient is recorded in a background thread
+      if( derivative == "tiered_gradient" )
+         cmpad::cppad::parallel_setup(1);
+   }
+   //
+   // n_direction
+   // there is no derivative, and no directions, for package none
+   size_t n_direction = arguments.n_direction;
+   if( package == "none" )
+      n_direction = 1;
+   if( n_direction == 0 )
+   {  std::cerr << "run_cmpad Error: n_direction is zero.\n";
+      return 1;
+   }
+   if( n_direction > 1 && derivative != "jvp" && derivative != "vjp" )
+   {  std::cerr << "run_cmpad Error: derivative = " << derivative
+                << ": n_direction = " << n_direction << " is not one.\n";
+      return 1;
+   }
+   //
+   // jit_load
+   std::string jit_load = arguments.jit_load;
+   if( jit_load != "file" && jit_load != "cache" && jit_load != "memory" )
+   {  std::cerr << "run_cmpad Error: jit_load = " << jit_load
+                << " is not file, cache, or memory.\n";
+      return 1;
+   }
+   if( jit_load != "file" && package != "cppad_jit" )
+   {  std::cerr << "run_cmpad Error: jit_load = " << jit_load
+                << ": package = " << package << " is not cppad_jit.\n";
+      return 1;
+   }
+# ifndef __linux__
+   if( jit_load == "memory" )
+   {  std::cerr << "run_cmpad Error: jit_load = memory: "
+                << "this is only available on Linux.\n";
+      return 1;
+   }
+# endif
+   //
+   // n_split
+   size_t n_split = arguments.n_split;
+   if( n_split == 0 )
+   {  std::cerr << "run_cmpad Error: n_split is zero.\n";
+      return 1;
+   }
+   if( n_split > 1 )
+   {  bool split_ok = package == "cppad_jit";
+      if( package == "cppadcg" )
+      {  split_ok  = derivative == "gradient";
+         split_ok |= derivative == "tiered_gradient";
+      }
+      if( ! split_ok )
+      {  std::cerr << "run_cmpad Error: n_split = " << n_split
+                   << ": package = " << package
+                   << ", derivative = " << derivative
+                   << " does not split its source.\n";
+         return 1;
+      }
+   }
+   //
+   // jit_flags
+   std::string jit_flags = arguments.jit_flags;
+   if( jit_flags != "" && package != "cppad_jit" && package != "cppadcg" )
+   {  std::cerr << "run_cmpad Error: jit_flags = " << jit_flags
+                << ": package = " << package
+                << " is not cppad_jit or cppadcg.\n";
+      return 1;
+   }
+   if( jit_flags.find(',') != std::string::npos )
+   {  std::cerr << "run_cmpad Error: jit_flags = " << jit_flags
+                << " contains a comma.\n";
+      return 1;
+   }
+   //
+   // tape_load
+   std::string tape_load = arguments.tape_load;
+   if( tape_load != "record" && tape_load != "file" )
+   {  std::cerr << "run_cmpad Error: tape_load = " << tape_load
+                << " is not record or file.\n";
+      return 1;
+   }
+   if( tape_load == "file" )
+   {  bool load_ok = package == "cppad" || package == "cppad_jit";
+      load_ok     &= ! checkpoint;
+      load_ok     &=
+         derivative == "gradient" || derivative == "tiered_gradient";
+      if( ! load_ok )
+      {  std::cerr << "run_cmpad Error: tape_load = file"
+                   << ": package = " << package
+                   << ", derivative = " << derivative
+                   << ", checkpoint = " << checkpoint
+                   << " does not load its tape.\n";
+         return 1;
+      }
+   }
+   //
+   // data_mode
+   std::string data_mode = arguments.data_mode;
+   if( data_mode != "constant" && data_mode != "retape" &&
+       data_mode != "dynamic" )
+   {  std::cerr << "run_cmpad Error: data_mode = " << data_mode
+                << " is not constant, retape, or dynamic.\n";
+      return 1;
+   }
+   if( data_mode != "constant" )
+   {  bool data_ok = algorithm == "llsq_obj" || algorithm == "an_ode";
+      data_ok     &= package == "none" ||
+         package == "cppad" || package == "cppad_jit";
+      data_ok     &= derivative == "" || derivative == "gradient";
+      data_ok     &= n_batch == 1 && ! checkpoint;
+      if( ! data_ok )
+      {  std::cerr << "run_cmpad Error: data_mode = " << data_mode
+                   << ": algorithm = " << algorithm
+                   << ", package = " << package
+                   << ", derivative = " << derivative
+                   << ", n_batch = " << n_batch
+                   << ", checkpoint = " << checkpoint
+                   << " does not change its data.\n";
+         return 1;
+      }
+   }
    //
    // time_setup
    bool time_setup = arguments.time_setup;
    //
+   // seed
+   size_t seed = arguments.seed;
+   //
    // min_time
    double min_time = arguments.min_time;
    if( min_time <= 0.0 || 1.0 < min_time )
@@ -201,108 +1256,112 @@ int main(int argc, char* argv[])
       return 1;
    }
    //
-   // special
-   // The only special case (so far) is for package = cppad and algo = llsq_obj.
-   bool special = false;
-   //
    // option
    cmpad::option_t option;
    option.n_arg       = n_arg;
    option.n_other     = n_other;
    option.time_setup = time_setup;
+   option.seed       = seed;
+   option.n_checkpoint = n_checkpoint;
+   option.n_batch      = n_batch;
+   option.n_thread     = n_thread;
+   option.n_direction  = n_direction;
+   option.jit_load     = jit_load;
+   option.n_split      = n_split;
+   option.jit_flags    = jit_flags;
+   option.tape_load    = tape_load;
+   option.data_mode    = data_mode;
    //
-   // case_found
-   bool case_found = false;
-   //
-   // file_name, case_found
-   if( package == "none" )
-   {  if( algorithm == "det_by_minor" )
-      {  cmpad::det_by_minor< cmpad::vector<double> > det;
-         double rate = cmpad::fun_speed(det, option, min_time);
-         cmpad::csv_speed(
-            file_name, rate, min_time, "none", algorithm, special, option
-         );
-         case_found = true;
-      }
-      else if( algorithm == "an_ode" )
-      {  cmpad::an_ode< cmpad::vector<double> > det;
-         double rate = cmpad::fun_speed(det, option, min_time);
-         cmpad::csv_speed(
-            file_name, rate, min_time, "none", algorithm, special, option
-         );
-         case_found = true;
-      }
-      else if( algorithm == "llsq_obj" )
-      {  cmpad::llsq_obj< cmpad::vector<double> > llsq;
-         double rate = cmpad::fun_speed(llsq, option, min_time);
-         cmpad::csv_speed(
-            file_name, rate, min_time, "none", algorithm, special, option
-         );
-         case_found = true;
+   // x_branch
+   // If x_branch is true, the algorithm uses native branches that depend on x.
+   // cppad and adolc gradients detect a change and retape, the codi
+   // gradient retapes when time_setup is true, cppad_jit and cppadcg
+   // cannot retape, and the other packages record for every x.
+   if( package != "none" && algo_fun.x_branch(package, option) )
+   {  bool is_gradient = derivative == "gradient";
+      bool branch_ok   = package != "cppad_jit" && package != "cppadcg";
+      if( package == "cppad" || package == "adolc" )
+         branch_ok &= is_gradient;
+      if( package == "codi" && is_gradient )
+         branch_ok &= time_setup;
+      if( ! branch_ok )
+      {  std::cerr << "run_cmpad Error: algorithm = " << algorithm
+                   << ", n_other = " << n_other
+                   << ": package = " << package
+                   << ", derivative = " << derivative
+                   << ", time_setup = " << time_setup
+                   << " does not detect a change in the branches.\n";
+         return 1;
       }
    }
    //
-   // file_name, case_found
-# if CMPAD_HAS_ADEPT
-   else if( package == "adept" )
-   {  CMPAD_PACKAGE_TEST(adept) }
-# endif
-# if CMPAD_HAS_ADOLC
-   else if( package == "adolc" )
-   {  CMPAD_PACKAGE_TEST(adolc) }
-# endif
+   // run
+   run_t run;
+   run.file_name     = file_name;
+   run.min_time      = min_time;
+   run.package       = package;
+   run.algorithm     = algorithm;
+   run.derivative    = derivative;
+   run.jacobian_mode = jacobian_mode;
+   run.thread_sweep  = thread_sweep;
+   run.option        = option;
    //
-   // file_name, case_found
-# if CMPAD_HAS_AUTODIFF
-   else if( package == "autodiff" )
-   {  CMPAD_PACKAGE_TEST(autodiff) }
-# endif
+   // grad_ok, file_name
+   bool grad_ok = algo_fun.speed_test(run);
    //
-   // file_name, case_found
-# if CMPAD_HAS_CODI
-   else if( package == "codi" )
-   {  CMPAD_PACKAGE_TEST(codi) }
-# endif
-   //
-   // file_name, case_found
+   // grad_ok, file_name
 # if CMPAD_HAS_CPPAD
-   else if( package == "cppad" )
-   {  CMPAD_PACKAGE_TEST(cppad)
-      //
-      if( algorithm == "llsq_obj" )
-      {  cmpad::cppad::special::gradient<cmpad::llsq_obj> special_grad_llsq;
-         double rate = cmpad::fun_speed(special_grad_llsq, option, min_time);
-         special = true;
-         cmpad::csv_speed(
-            file_name, rate, min_time, "cppad" , algorithm, special, option
-         );
-         special = false;
-      }
+   // The only special case (so far) is for package = cppad and algo = llsq_obj.
+   // The special gradient always records its tape with constant data.
+   bool special_case = package == "cppad" && algorithm == "llsq_obj";
+   special_case     &= derivative == "gradient" && n_batch == 1;
+   special_case     &= tape_load == "record" && data_mode == "constant";
+   if( special_case )
+   {  cmpad::cppad::special::gradient<cmpad::llsq_obj> special_grad_llsq;
+      bool special = true;
+      grad_ok &= grad_speed<cmpad::llsq_obj>(special_grad_llsq, run, special);
    }
 # endif
    //
-   // file_name, case_found
 # if CMPAD_HAS_CPPAD_JIT
-   else if( package == "cppad_jit" )
-   {  CMPAD_PACKAGE_TEST(cppad_jit) }
-# endif
-   //
-   // file_name, case_found
-# if CMPAD_HAS_CPPADCG
-   else if( package == "cppadcg" )
-   {  CMPAD_PACKAGE_TEST(cppadcg) }
+   if( package == "cppad_jit" )
+   {  //
+      // report the compiled function cache hits and misses
+      if( jit_load == "cache" )
+         std::cout << "run_cmpad: cppad_jit cache: hit = "
+            << cmpad::cppad_jit::jit_function::cache_hit() << ", miss = "
+            << cmpad::cppad_jit::jit_function::cache_miss() << "\n";
+      //
+      // report the size and time for the compiles
+      std::cout << "run_cmpad: cppad_jit compile: n_byte = "
+         << cmpad::cppad_jit::jit_function::compile_byte() << ", second = "
+         << std::setprecision(1) << std::scientific
+         << cmpad::cppad_jit::jit_function::compile_second() << "\n";
+   }
 # endif
    //
-   // file_name, case_found
-# if CMPAD_HAS_SACADO
-   else if( package == "sacado" )
-   {  CMPAD_PACKAGE_TEST(sacado) }
+   // report the tape loads and records
+# if CMPAD_HAS_CPPAD
+   if( tape_load == "file" )
+   {  std::cout << "run_cmpad: cppad tape: load = "
+         << cmpad::cppad::tape_file::n_load() << ", record = "
+         << cmpad::cppad::tape_file::n_record() << ", load_second = "
+         << std::setprecision(1) << std::scientific
+         << cmpad::cppad::tape_file::load_second() << ", record_second = "
+         << cmpad::cppad::tape_file::record_second() << "\n";
+   }
 # endif
    //
-   if( case_found )
-      return  0;
+   // report the comparison changes and retapes
+   if( cmpad::retape_count::n_check() > 0 )
+   {  std::cout << "run_cmpad: retape: n_check = "
+         << cmpad::retape_count::n_check() << ", n_retape = "
+         << cmpad::retape_count::n_retape() << ", n_compare_change = "
+         << cmpad::retape_count::n_compare_change() << "\n";
+   }
    //
-   std::cerr << "cmpad: BUG\n";
+   if( grad_ok )
+      return 0;
    return 1;
 }
 // END C++
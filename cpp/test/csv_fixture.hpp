@@ -17,6 +17,9 @@ public:
    // min_time_
    const double min_time_;
    //
+   // rel_tol_
+   const double rel_tol_;
+   //
    // debug_
    const std::string debug_;
    //
@@ -36,9 +39,10 @@ public:
    std::string csv_file_path_;
    //
    // ctor
-   // min_time_, debug_
+   // min_time_, rel_tol_, debug_
    csv_fixture(void)
    : min_time_(0.1)
+   , rel_tol_(1e-6)
 # ifdef NDEBUG
    , debug_("false")
 # else
@@ -100,7 +104,18 @@ public:
          "compiler",
          "debug",
          "language",
-         "special"
+         "special",
+         "rel_error",
+         "n_checkpoint",
+         "derivative",
+         "n_batch",
+         "n_thread",
+         "n_direction",
+         "jit_load",
+         "n_split",
+         "jit_flags",
+         "tape_load",
+         "data_mode"
       };
       //
       // language
@@ -126,6 +141,24 @@ public:
       BOOST_CHECK( csv_table[n_row-2][6] == "true"   );
       BOOST_CHECK( csv_table[n_row-1][6] == "false"  );
       //
+      // check column 12
+      // none does not have a gradient to check
+      for(size_t i = n_row-2; i < n_row; ++i)
+      {  if( package_ == "none" )
+            BOOST_CHECK( csv_table[i][12] == "" );
+         else
+            BOOST_CHECK( csv_table[i][12] != "" );
+      }
+      //
+      // check column 14
+      // none does not have a derivative
+      for(size_t i = n_row-2; i < n_row; ++i)
+      {  if( package_ == "none" )
+            BOOST_CHECK( csv_table[i][14] == "" );
+         else
+            BOOST_CHECK( csv_table[i][14] == "gradient" );
+      }
+      //
       // check column 3-5, 8-10
       for(size_t i = n_row-1; i < n_row; ++i)
       {  BOOST_CHECK( csv_table[i][3] == algorithm_ );
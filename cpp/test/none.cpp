@@ -2,6 +2,7 @@
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
 // SPDX-FileContributor: 2023-24 Bradley M. Bell
 // ---------------------------------------------------------------------------
+# include <limits>
 # include <boost/test/unit_test.hpp>
 # include <cmpad/fun_speed.hpp>
 # include <cmpad/csv_speed.hpp>
@@ -10,8 +11,14 @@
 # include "csv_fixture.hpp"
 //
 # include <cmpad/algo/det_by_minor.hpp>
+# include <cmpad/algo/det_by_lu.hpp>
+# include <cmpad/algo/det_by_memo.hpp>
 # include <cmpad/algo/an_ode.hpp>
+# include <cmpad/algo/an_ode_adaptive.hpp>
+# include <cmpad/algo/pde_residual.hpp>
 # include <cmpad/algo/llsq_obj.hpp>
+# include <cmpad/algo/rosen_obj.hpp>
+# include <cmpad/algo/huber_obj.hpp>
 //
 // CMPAD_TEST_ONE_ALGORITHM
 # define CMPAD_TEST_ONE_ALGORITHM(algorithm_value, n_arg_value, n_other_value) \
@@ -31,10 +38,12 @@
       /* \
       csv_file_path_ */ \
       cmpad::algorithm_value< cmpad::vector<double> > fun; \
-      double rate    = cmpad::fun_speed(fun, option, min_time_); \
-      bool   special = false; \
+      double rate      = cmpad::fun_speed(fun, option, min_time_); \
+      bool   special   = false; \
+      double rel_error = std::numeric_limits<double>::quiet_NaN(); \
       cmpad::csv_speed( csv_file_path_,  \
-         rate, min_time_, package_, algorithm_, special, option \
+         rate, min_time_, package_, algorithm_, "", special, option, \
+         rel_error \
       ); \
    } \
    check();
@@ -50,7 +59,13 @@ BOOST_FIXTURE_TEST_SUITE(csv_speed, csv_fixture)
 BOOST_AUTO_TEST_CASE(Double)
 {  //
    CMPAD_TEST_ONE_ALGORITHM(det_by_minor, 16, 0)
+   CMPAD_TEST_ONE_ALGORITHM(det_by_lu, 16, 1)
+   CMPAD_TEST_ONE_ALGORITHM(det_by_memo, 16, 0)
    CMPAD_TEST_ONE_ALGORITHM(an_ode, 5, 4)
+   CMPAD_TEST_ONE_ALGORITHM(an_ode_adaptive, 8, 10)
+   CMPAD_TEST_ONE_ALGORITHM(pde_residual, 16, 0)
    CMPAD_TEST_ONE_ALGORITHM(llsq_obj, 3, 10)
+   CMPAD_TEST_ONE_ALGORITHM(rosen_obj, 8, 0)
+   CMPAD_TEST_ONE_ALGORITHM(huber_obj, 8, 0)
 }
 BOOST_AUTO_TEST_SUITE_END()
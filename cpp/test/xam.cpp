@@ -18,43 +18,96 @@
 
 // BEGIN_SORT_THIS_LINE_PLUS_1
 CMPAD_TEST_EXAMPLE(an_ode)
+CMPAD_TEST_EXAMPLE(an_ode_adaptive)
+CMPAD_TEST_EXAMPLE(batch_loop)
+CMPAD_TEST_EXAMPLE(batch_thread)
+CMPAD_TEST_EXAMPLE(checkpoint_gradient)
 CMPAD_TEST_EXAMPLE(csv_read)
 CMPAD_TEST_EXAMPLE(csv_speed)
 CMPAD_TEST_EXAMPLE(csv_write)
+CMPAD_TEST_EXAMPLE(der_check)
+CMPAD_TEST_EXAMPLE(det_by_lu)
+CMPAD_TEST_EXAMPLE(det_by_memo)
 CMPAD_TEST_EXAMPLE(det_by_minor)
 CMPAD_TEST_EXAMPLE(det_of_minor)
+CMPAD_TEST_EXAMPLE(dormand_prince)
 CMPAD_TEST_EXAMPLE(fun_obj)
 CMPAD_TEST_EXAMPLE(fun_speed)
+CMPAD_TEST_EXAMPLE(grad_check)
+CMPAD_TEST_EXAMPLE(huber_obj)
 CMPAD_TEST_EXAMPLE(llsq_obj)
 CMPAD_TEST_EXAMPLE(near_equal)
+CMPAD_TEST_EXAMPLE(pde_residual)
+CMPAD_TEST_EXAMPLE(private_dir)
+CMPAD_TEST_EXAMPLE(rosen_obj)
 CMPAD_TEST_EXAMPLE(runge_kutta)
+CMPAD_TEST_EXAMPLE(tiered_gradient)
 CMPAD_TEST_EXAMPLE(uniform_01)
 // END_SORT_THIS_LINE_MINUS_1
 //
 # if CMPAD_HAS_ADEPT
 CMPAD_TEST_EXAMPLE(gradient_adept)
+CMPAD_TEST_EXAMPLE(jacobian_adept)
+CMPAD_TEST_EXAMPLE(jvp_adept)
+CMPAD_TEST_EXAMPLE(vjp_adept)
 # endif
 # if CMPAD_HAS_ADOLC
 CMPAD_TEST_EXAMPLE(gradient_adolc)
+CMPAD_TEST_EXAMPLE(hessian_adolc)
+CMPAD_TEST_EXAMPLE(hessian_vector_adolc)
+CMPAD_TEST_EXAMPLE(jacobian_adolc)
+CMPAD_TEST_EXAMPLE(jvp_adolc)
+CMPAD_TEST_EXAMPLE(sparse_hessian_adolc)
+CMPAD_TEST_EXAMPLE(sparse_jacobian_adolc)
+CMPAD_TEST_EXAMPLE(vjp_adolc)
 # endif
 # if CMPAD_HAS_AUTODIFF
 CMPAD_TEST_EXAMPLE(gradient_autodiff)
+CMPAD_TEST_EXAMPLE(hessian_autodiff)
+CMPAD_TEST_EXAMPLE(jacobian_autodiff)
+CMPAD_TEST_EXAMPLE(jvp_autodiff)
 # endif
 # if CMPAD_HAS_CODI
 CMPAD_TEST_EXAMPLE(gradient_codi)
+CMPAD_TEST_EXAMPLE(hessian_codi)
+CMPAD_TEST_EXAMPLE(hessian_vector_codi)
+CMPAD_TEST_EXAMPLE(jacobian_codi)
+CMPAD_TEST_EXAMPLE(jvp_codi)
+CMPAD_TEST_EXAMPLE(vjp_codi)
 # endif
 # if CMPAD_HAS_CPPAD
 CMPAD_TEST_EXAMPLE(cppad_llsq_obj)
+CMPAD_TEST_EXAMPLE(cppad_tape_file)
 CMPAD_TEST_EXAMPLE(gradient_cppad)
+CMPAD_TEST_EXAMPLE(hessian_cppad)
+CMPAD_TEST_EXAMPLE(hessian_vector_cppad)
+CMPAD_TEST_EXAMPLE(jacobian_cppad)
+CMPAD_TEST_EXAMPLE(jvp_cppad)
+CMPAD_TEST_EXAMPLE(sparse_hessian_cppad)
+CMPAD_TEST_EXAMPLE(sparse_jacobian_cppad)
+CMPAD_TEST_EXAMPLE(vjp_cppad)
 # endif
 # if CMPAD_HAS_CPPAD_JIT
 CMPAD_TEST_EXAMPLE(gradient_cppad_jit)
+CMPAD_TEST_EXAMPLE(hessian_cppad_jit)
+CMPAD_TEST_EXAMPLE(hessian_vector_cppad_jit)
+CMPAD_TEST_EXAMPLE(jacobian_cppad_jit)
+CMPAD_TEST_EXAMPLE(jvp_cppad_jit)
+CMPAD_TEST_EXAMPLE(vjp_cppad_jit)
 # endif
 # if CMPAD_HAS_CPPADCG
 CMPAD_TEST_EXAMPLE(gradient_cppadcg)
+CMPAD_TEST_EXAMPLE(hessian_cppadcg)
+CMPAD_TEST_EXAMPLE(hessian_vector_cppadcg)
+CMPAD_TEST_EXAMPLE(sparse_hessian_cppadcg)
+CMPAD_TEST_EXAMPLE(sparse_jacobian_cppadcg)
 # endif
 # if CMPAD_HAS_SACADO
 CMPAD_TEST_EXAMPLE(gradient_sacado)
+CMPAD_TEST_EXAMPLE(hessian_sacado)
+CMPAD_TEST_EXAMPLE(hessian_vector_sacado)
+CMPAD_TEST_EXAMPLE(jacobian_sacado)
+CMPAD_TEST_EXAMPLE(jvp_sacado)
 # endif
 # if CMPAD_HAS_XAD
 // 2DO: Get this test to pass
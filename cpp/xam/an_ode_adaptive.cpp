@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_an_ode_adaptive.cpp}
+
+Example and Test of an_ode_adaptive
+###################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_an_ode_adaptive.cpp}
+*/
+// BEGIN C++
+# include <cmpad/algo/an_ode_adaptive.hpp>
+# include <cmpad/near_equal.hpp>
+
+bool xam_an_ode_adaptive(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // n
+   // for n > 4 the Dormand-Prince method has truncation error
+   size_t n = 8;
+   //
+   // ode
+   typedef cmpad::vector<double>  Vector;
+   cmpad::an_ode_adaptive<Vector> ode;
+   //
+   // ode.setup
+   // the error tolerance is 10^{-n_other}
+   cmpad::option_t option;
+   option.n_arg   = n;
+   option.n_other = 10;
+   ode.setup(option);
+   //
+   // ok
+   // the steps depend on x
+   ok &= ode.x_branch();
+   //
+   // x
+   Vector x(n);
+   for(size_t i = 0; i < n; ++i)
+      x[i] = 1.0 + double(i) / double(n);
+   //
+   // yf
+   Vector yf = ode(x);
+   //
+   // rel_error
+   double rel_error = 1e-8;
+   //
+   // ok
+   double tf  = 2.0;
+   double yi  = x[0] * tf;
+   ok &= cmpad::near_equal( yf[0], yi, rel_error );
+   for(size_t i = 1; i < n; ++i)
+   {  yi = x[i] * yi * tf / double(i+1);
+      ok &= cmpad::near_equal( yf[i], yi, rel_error );
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_batch_loop.cpp}
+
+Example and Test of batch_loop
+##############################
+This example does not require an AD package.
+It uses a simple forward mode (dual number) gradient for each point.
+
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_batch_loop.cpp}
+*/
+// BEGIN C++
+# include <limits>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/batch_loop.hpp>
+# include <cmpad/gradient.hpp>
+# include <cmpad/algo/rosen_obj.hpp>
+
+namespace {
+   //
+   // dual
+   // value and derivative in one direction
+   struct dual {
+      double v, d;
+      dual(double value = 0.0) : v(value), d(0.0)
+      { }
+   };
+   dual operator+(const dual& a, const dual& b)
+   {  dual c; c.v = a.v + b.v; c.d = a.d + b.d; return c; }
+   dual operator-(const dual& a, const dual& b)
+   {  dual c; c.v = a.v - b.v; c.d = a.d - b.d; return c; }
+   dual operator*(const dual& a, const dual& b)
+   {  dual c; c.v = a.v * b.v; c.d = a.d * b.v + a.v * b.d; return c; }
+   dual& operator+=(dual& a, const dual& b)
+   {  a = a + b; return a; }
+   //
+   // dual_gradient
+   // a gradient that uses one forward pass for each argument component
+   template < template<class ADVector> class Algo> class dual_gradient
+   : public cmpad::gradient
+   {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // algo_
+      Algo< cmpad::vector<dual> > algo_;
+      //
+      // ax_, g_
+      cmpad::vector<dual>   ax_;
+      cmpad::vector<double> g_;
+   public:
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      //
+      // domain
+      size_t domain(void) const override
+      {  return algo_.domain(); }
+      //
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         algo_.setup(option);
+         ax_.resize( algo_.domain() );
+         g_.resize( algo_.domain() );
+      }
+      //
+      // operator
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  size_t n = algo_.domain();
+         size_t m = algo_.range();
+         for(size_t j = 0; j < n; ++j)
+            ax_[j] = dual( x[j] );
+         for(size_t j = 0; j < n; ++j)
+         {  ax_[j].d = 1.0;
+            g_[j]    = algo_(ax_)[m-1].d;
+            ax_[j].d = 0.0;
+         }
+         return g_;
+      }
+   };
+}
+
+bool xam_batch_loop(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 100. * std::numeric_limits<double>::epsilon();
+   //
+   // n_arg, n_batch
+   size_t n_arg   = 5;
+   size_t n_batch = 7;
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg   = n_arg;
+   option.n_other = 0;
+   option.n_batch = n_batch;
+   //
+   // batch
+   cmpad::batch_loop<dual_gradient, cmpad::rosen_obj> batch;
+   batch.setup(option);
+   ok &= batch.domain() == n_batch * n_arg;
+   ok &= batch.range()  == n_batch * n_arg;
+   //
+   // x
+   // row major order, one row for each argument point
+   cmpad::vector<double> x(n_batch * n_arg);
+   cmpad::uniform_01(x);
+   //
+   // g
+   const cmpad::vector<double>& g = batch(x);
+   //
+   // k
+   for(size_t k = 0; k < n_batch; ++k)
+   {  //
+      // x_k
+      const double* x_k = x.data() + k * n_arg;
+      //
+      // j
+      for(size_t j = 0; j < n_arg; ++j)
+      {  //
+         // check
+         // partial of the rosen_obj objective w.r.t. x_k[j]
+         double check = 0.0;
+         if( j > 0 )
+            check += 200.0 * ( x_k[j] - x_k[j-1] * x_k[j-1] );
+         if( j + 1 < n_arg )
+         {  check -= 400.0 * x_k[j] * ( x_k[j+1] - x_k[j] * x_k[j] );
+            check -= 2.0 * ( 1.0 - x_k[j] );
+         }
+         //
+         // ok
+         ok &= cmpad::near_equal( g[k * n_arg + j], check, rel_error );
+      }
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_batch_thread.cpp}
+
+Example and Test of batch_thread
+##############################
+This example does not require an AD package.
+It uses a simple forward mode (dual number) gradient for each point.
+
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_batch_thread.cpp}
+*/
+// BEGIN C++
+# include <cstddef>
+# include <limits>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/batch_thread.hpp>
+# include <cmpad/gradient.hpp>
+# include <cmpad/algo/rosen_obj.hpp>
+
+namespace {
+   //
+   // dual
+   // value and derivative in one direction
+   struct dual {
+      double v, d;
+      dual(double value = 0.0) : v(value), d(0.0)
+      { }
+   };
+   dual operator+(const dual& a, const dual& b)
+   {  dual c; c.v = a.v + b.v; c.d = a.d + b.d; return c; }
+   dual operator-(const dual& a, const dual& b)
+   {  dual c; c.v = a.v - b.v; c.d = a.d - b.d; return c; }
+   dual operator*(const dual& a, const dual& b)
+   {  dual c; c.v = a.v * b.v; c.d = a.d * b.v + a.v * b.d; return c; }
+   dual& operator+=(dual& a, const dual& b)
+   {  a = a + b; return a; }
+   //
+   // dual_gradient
+   // a gradient that uses one forward pass for each argument component
+   template < template<class ADVector> class Algo> class dual_gradient
+   : public cmpad::gradient
+   {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // algo_
+      Algo< cmpad::vector<dual> > algo_;
+      //
+      // ax_, g_
+      cmpad::vector<dual>   ax_;
+      cmpad::vector<double> g_;
+   public:
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      //
+      // domain
+      size_t domain(void) const override
+      {  return algo_.domain(); }
+      //
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         algo_.setup(option);
+         ax_.resize( algo_.domain() );
+         g_.resize( algo_.domain() );
+      }
+      //
+      // operator
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  size_t n = algo_.domain();
+         size_t m = algo_.range();
+         for(size_t j = 0; j < n; ++j)
+            ax_[j] = dual( x[j] );
+         for(size_t j = 0; j < n; ++j)
+         {  ax_[j].d = 1.0;
+            g_[j]    = algo_(ax_)[m-1].d;
+            ax_[j].d = 0.0;
+         }
+         return g_;
+      }
+   };
+   //
+   // copy_gradient
+   // a dual_gradient that batch_thread only sets up once for each batch setup
+   template < template<class ADVector> class Algo> class copy_gradient
+   : public dual_gradient<Algo>
+   {
+   public:
+      //
+      // n_setup
+      // number of calls to setup by all the copy_gradient objects
+      static size_t& n_setup(void)
+      {  static size_t n = 0;
+         return n;
+      }
+      //
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  ++n_setup();
+         dual_gradient<Algo>::setup(option);
+      }
+      //
+      // setup_copy
+      void setup_copy(const copy_gradient& grad)
+      {  dual_gradient<Algo>::operator=(grad); }
+   };
+}
+
+bool xam_batch_thread(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 100. * std::numeric_limits<double>::epsilon();
+   //
+   // n_arg, n_batch
+   size_t n_arg   = 5;
+   size_t n_batch = 37;
+   //
+   // batch
+   cmpad::batch_thread<dual_gradient, cmpad::rosen_obj> batch;
+   //
+   // n_thread
+   // the second setup restarts the thread pool
+   for(size_t n_thread : { 4, 3 } )
+   {  //
+      // option
+      cmpad::option_t option;
+      option.n_arg    = n_arg;
+      option.n_other  = 0;
+      option.n_batch  = n_batch;
+      option.n_thread = n_thread;
+      //
+      // batch
+      batch.setup(option);
+      ok &= batch.domain() == n_batch * n_arg;
+      ok &= batch.range()  == n_batch * n_arg;
+      //
+      // x
+      // row major order, one row for each argument point
+      cmpad::vector<double> x(n_batch * n_arg);
+      cmpad::uniform_01(x);
+      //
+      // g
+      const cmpad::vector<double>& g = batch(x);
+      //
+      // grad
+      // evaluates the gradient one point at a time in this thread
+      dual_gradient<cmpad::rosen_obj> grad;
+      grad.setup(option);
+      //
+      // k
+      cmpad::vector<double> x_k(n_arg);
+      for(size_t k = 0; k < n_batch; ++k)
+      {  //
+         // x_k
+         for(size_t j = 0; j < n_arg; ++j)
+            x_k[j] = x[k * n_arg + j];
+         //
+         // ok
+         const cmpad::vector<double>& g_k = grad(x_k);
+         for(size_t j = 0; j < n_arg; ++j)
+            ok &= cmpad::near_equal( g[k * n_arg + j], g_k[j], rel_error );
+      }
+      //
+      // ok
+      // every point is evaluated by exactly one thread
+      size_t sum = 0;
+      for(size_t t = 0; t < n_thread; ++t)
+         sum += batch.n_point(t);
+      ok &= sum == n_batch;
+      //
+      // copy_batch
+      cmpad::batch_thread<copy_gradient, cmpad::rosen_obj> copy_batch;
+      //
+      // ok
+      // the gradient is only setup once and the copies have the same values
+      size_t n_setup = copy_gradient<cmpad::rosen_obj>::n_setup();
+      copy_batch.setup(option);
+      ok &= copy_gradient<cmpad::rosen_obj>::n_setup() == n_setup + 1;
+      const cmpad::vector<double>& g_copy = copy_batch(x);
+      for(size_t i = 0; i < n_batch * n_arg; ++i)
+         ok &= g_copy[i] == g[i];
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_checkpoint_gradient.cpp}
+
+Example and Test of checkpoint_gradient
+#######################################
+This example does not require an AD package.
+It uses a simple forward mode (dual number) gradient for the steps.
+
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_checkpoint_gradient.cpp}
+*/
+// BEGIN C++
+# include <limits>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/checkpoint_gradient.hpp>
+# include <cmpad/algo/an_ode.hpp>
+
+namespace {
+   //
+   // dual
+   // value and derivative in one direction
+   struct dual {
+      double v, d;
+      dual(double value = 0.0) : v(value), d(0.0)
+      { }
+   };
+   dual operator+(const dual& a, const dual& b)
+   {  dual c; c.v = a.v + b.v; c.d = a.d + b.d; return c; }
+   dual operator*(const dual& a, const dual& b)
+   {  dual c; c.v = a.v * b.v; c.d = a.d * b.v + a.v * b.d; return c; }
+   dual operator/(const dual& a, const dual& b)
+   {  dual c; c.v = a.v / b.v; c.d = (a.d - c.v * b.d) / b.v; return c; }
+   //
+   // dual_gradient
+   // a gradient that uses one forward pass for each argument component
+   template < template<class ADVector> class Algo> class dual_gradient
+   : public cmpad::gradient
+   {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // algo_
+      Algo< cmpad::vector<dual> > algo_;
+      //
+      // ax_, g_
+      cmpad::vector<dual>   ax_;
+      cmpad::vector<double> g_;
+   public:
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      //
+      // domain
+      size_t domain(void) const override
+      {  return algo_.domain(); }
+      //
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         algo_.setup(option);
+         ax_.resize( algo_.domain() );
+         g_.resize( algo_.domain() );
+      }
+      //
+      // operator
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  size_t n = algo_.domain();
+         size_t m = algo_.range();
+         for(size_t j = 0; j < n; ++j)
+            ax_[j] = dual( x[j] );
+         for(size_t j = 0; j < n; ++j)
+         {  ax_[j].d = 1.0;
+            g_[j]    = algo_(ax_)[m-1].d;
+            ax_[j].d = 0.0;
+         }
+         return g_;
+      }
+   };
+   //
+   // growth_step
+   // y_i = (1 + h) y_i + h x_i x_{i+1} with h = 1 / n_other
+   // and the index i + 1 is modulo n
+   template <class Vector> class growth_step : public cmpad::fun_obj<Vector>
+   {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // z_
+      Vector z_;
+   public:
+      // scalar_type
+      typedef typename Vector::value_type scalar_type;
+      //
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      //
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg; }
+      //
+      // range
+      size_t range(void) const override
+      {  return option_.n_arg / 3 + 1; }
+      //
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         z_.resize(option.n_arg / 3 + 1);
+      }
+      //
+      // operator
+      const Vector& operator()(const Vector& yxu) override
+      {  size_t n = option_.n_arg / 3;
+         double h = 1.0 / double( option_.n_other );
+         scalar_type sum = scalar_type(0.0);
+         for(size_t i = 0; i < n; ++i)
+         {  z_[i]  = scalar_type(1.0 + h) * yxu[i]
+                   + scalar_type(h) * yxu[n + i] * yxu[n + (i + 1) % n];
+            sum    = sum + yxu[2 * n + i] * z_[i];
+         }
+         z_[n] = sum;
+         return z_;
+      }
+   };
+}
+
+bool xam_checkpoint_gradient(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // n_arg, n_step
+   size_t n_arg  = 4;
+   size_t n_step = 40;
+   //
+   // x
+   // note that x[i] != 0.0 so can divide by it
+   cmpad::vector<double> x(n_arg);
+   cmpad::uniform_01(x);
+   for(size_t i = 0; i < n_arg; ++i)
+      x[i] += 1.0;
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg   = n_arg;
+   option.n_other = n_step;
+   //
+   // y_r
+   // there is no truncation error in the Runge-Kutta method for y_r
+   size_t r   = n_arg - 1;
+   double tf  = 2.0;
+   double y_r = x[0] * tf;
+   for(size_t j = 1; j <= r; ++j)
+      y_r = y_r * x[j] * tf / double(j+1);
+   //
+   // n_forward_step
+   cmpad::vector<size_t> n_forward_step;
+   //
+   // n_checkpoint
+   for(size_t n_checkpoint : {0, 1, 2, 5, 39, 100} )
+   {  //
+      // grad
+      option.n_checkpoint = n_checkpoint;
+      cmpad::checkpoint_gradient<dual_gradient> grad;
+      grad.setup(option);
+      //
+      // ok
+      const cmpad::vector<double>& g = grad(x);
+      for(size_t j = 0; j < n_arg; ++j)
+         ok &= cmpad::near_equal( g[j], y_r / x[j], rel_error );
+      //
+      // n_forward_step
+      n_forward_step.push_back( grad.n_forward_step() );
+   }
+   //
+   // ok
+   // no checkpoints: step k is recomputed from the initial value
+   ok &= n_forward_step[0] == n_step * (n_step - 1) / 2;
+   //
+   // ok
+   // more checkpoints, fewer recomputed steps
+   for(size_t i = 1; i < n_forward_step.size(); ++i)
+      ok &= n_forward_step[i] <= n_forward_step[i-1];
+   //
+   // ok
+   // two checkpoints plus the initial value: beta(3, 5) = 56 >= 40
+   // so each step is recomputed at most 5 times
+   ok &= n_forward_step[2] <= 5 * n_step;
+   //
+   // ok
+   // with n_step - 1 checkpoints each step is evaluated once
+   ok &= n_forward_step[4] == n_step - 1;
+   ok &= n_forward_step[5] == n_step - 1;
+   //
+   // ok
+   // a different step algorithm: the last state component is
+   // c x_{n-1} x_0 where c = (1 + h)^n_step - 1
+   double h = 1.0 / double(n_step);
+   double c = 1.0;
+   for(size_t k = 0; k < n_step; ++k)
+      c *= 1.0 + h;
+   c -= 1.0;
+   for(size_t n_checkpoint : {0, 3, 100} )
+   {  option.n_checkpoint = n_checkpoint;
+      cmpad::checkpoint_gradient<dual_gradient, growth_step> grad;
+      grad.setup(option);
+      const cmpad::vector<double>& g = grad(x);
+      ok &= cmpad::near_equal( g[0], c * x[n_arg-1], rel_error );
+      ok &= cmpad::near_equal( g[n_arg-1], c * x[0], rel_error );
+      for(size_t j = 1; j < n_arg - 1; ++j)
+         ok &= g[j] == 0.0;
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin xam_cppad_tape_file.cpp}
+
+Example and Test of the CppAD Tape Cache
+########################################
+
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_cppad_tape_file.cpp}
+*/
+// BEGIN C++
+# include <filesystem>
+# include <cmpad/vector.hpp>
+# include <cmpad/cppad/tape_file.hpp>
+
+bool xam_cppad_tape_file(void)
+{  // ok
+   bool ok = true;
+   //
+   // tape_file
+   typedef cmpad::cppad::tape_file tape_file;
+   //
+   // tape_name
+   std::string tape_name = "xam_tape_file";
+   //
+   // remove_tapes
+   // remove the tape files for this example from the cache
+   auto remove_tapes = [&](void)
+   {  std::error_code ec;
+      std::filesystem::directory_iterator itr(tape_file::cache_path(), ec);
+      for(const auto& entry : itr)
+      {  std::string file_name = entry.path().filename().string();
+         if( file_name.compare(0, tape_name.size() + 1, tape_name + "_") == 0 )
+            std::filesystem::remove(entry.path(), ec);
+      }
+   };
+   remove_tapes();
+   //
+   // n_record, record
+   // record y = 2 * x and count the number of recordings
+   size_t n_record = 0;
+   auto record = [&n_record](CppAD::ADFun<double>& tape)
+   {  ++n_record;
+      cmpad::vector< CppAD::AD<double> > ax(1), ay(1);
+      ax[0] = 0.0;
+      CppAD::Independent(ax);
+      ay[0] = 2.0 * ax[0];
+      tape.Dependent(ax, ay);
+   };
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg     = 1;
+   option.n_other   = 0;
+   option.tape_load = "file";
+   //
+   // tape
+   CppAD::ADFun<double> tape;
+   //
+   // ok
+   // the first setup records and saves the tape, the second loads it
+   tape_file::setup(tape, tape_name, "algo_a", 1, option, record);
+   ok &= n_record == 1;
+   tape_file::setup(tape, tape_name, "algo_a", 1, option, record);
+   ok &= n_record == 1;
+   //
+   // ok
+   // the loaded tape computes y = 2 * x
+   cmpad::vector<double> x(1), y;
+   x[0] = 3.0;
+   y    = tape.Forward(0, x);
+   ok  &= y[0] == 6.0;
+   //
+   // ok
+   // a different n_other misses the cache
+   option.n_other = 1;
+   tape_file::setup(tape, tape_name, "algo_a", 1, option, record);
+   ok &= n_record == 2;
+   //
+   // ok
+   // a different algorithm misses the cache
+   tape_file::setup(tape, tape_name, "algo_b", 1, option, record);
+   ok &= n_record == 3;
+   //
+   // ok
+   // a different algorithm version misses the cache
+   tape_file::setup(tape, tape_name, "algo_b", 2, option, record);
+   ok &= n_record == 4;
+   //
+   // ok
+   // all of the keys above are still in the cache
+   tape_file::setup(tape, tape_name, "algo_a", 1, option, record);
+   tape_file::setup(tape, tape_name, "algo_b", 1, option, record);
+   tape_file::setup(tape, tape_name, "algo_b", 2, option, record);
+   ok &= n_record == 4;
+   //
+   // ok
+   // tape_load record does not use the cache
+   option.tape_load = "record";
+   tape_file::setup(tape, tape_name, "algo_a", 1, option, record);
+   ok &= n_record == 5;
+   //
+   remove_tapes();
+   return ok;
+}
+// END C++
@@ -19,6 +19,7 @@ Source Code
 */
 
 // BEGIN C++
+# include <limits>
 # include <filesystem>
 # include <cmpad/configure.hpp>
 # include <cmpad/algo/det_by_minor.hpp>
@@ -75,9 +76,19 @@ bool xam_csv_speed(void)
    // rate
    double rate = cmpad::fun_speed(det_double, option, min_time);
    //
+   // rel_error
+   // there is no gradient to check for the none package
+   double rel_error = std::numeric_limits<double>::quiet_NaN();
+   //
+   // csv_speed
+   // derivative
+   // there is no derivative for the none package
+   std::string derivative = "";
+   //
    // csv_speed
    cmpad::csv_speed(
-      file_name, rate, min_time, package, algorithm, special, option
+      file_name, rate, min_time, package, algorithm, derivative, special,
+      option, rel_error
    );
    //
    // csv_table
@@ -106,7 +117,18 @@ bool xam_csv_speed(void)
       "compiler",
       "debug",
       "language",
-      "special"
+      "special",
+      "rel_error",
+      "n_checkpoint",
+      "derivative",
+      "n_batch",
+      "n_thread",
+      "n_direction",
+      "jit_load",
+      "n_split",
+      "jit_flags",
+      "tape_load",
+      "data_mode"
    };
    size_t n_col = col_name.size();
    //
@@ -131,6 +153,17 @@ bool xam_csv_speed(void)
    ok &= csv_table[1][9] == debug;
    ok &= csv_table[1][10] == language;
    ok &= csv_table[1][11] == "false";
+   ok &= csv_table[1][12] == "";
+   ok &= csv_table[1][13] == "";
+   ok &= csv_table[1][14] == derivative;
+   ok &= csv_table[1][15] == std::to_string(option.n_batch);
+   ok &= csv_table[1][16] == std::to_string(option.n_thread);
+   ok &= csv_table[1][17] == std::to_string(option.n_direction);
+   ok &= csv_table[1][18] == option.jit_load;
+   ok &= csv_table[1][19] == std::to_string(option.n_split);
+   ok &= csv_table[1][20] == option.jit_flags;
+   ok &= csv_table[1][21] == option.tape_load;
+   ok &= csv_table[1][22] == option.data_mode;
    //
    return ok;
 }
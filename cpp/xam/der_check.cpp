@@ -0,0 +1,544 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_der_check.cpp}
+
+Example and Test of der_check
+#############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_der_check.cpp}
+*/
+// BEGIN C++
+# include <iostream>
+# include <sstream>
+# include <cmpad/gradient.hpp>
+# include <cmpad/der_check.hpp>
+# include <cmpad/algo/llsq_obj.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+   //
+   // t_llsq
+   // the value of t_j used by llsq_obj
+   double t_llsq(size_t j, size_t n_other)
+   {  return -1.0 + 2.0 * double(j) / double(n_other - 1); }
+   //
+   // grad_llsq
+   // gradient of llsq_obj computed by hand
+   class grad_llsq : public cmpad::gradient {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // g_
+      cmpad::vector<double> g_;
+   public:
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         g_.resize(option.n_arg);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg; }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  size_t n_arg   = option_.n_arg;
+         size_t n_other = option_.n_other;
+         for(size_t i = 0; i < n_arg; ++i)
+            g_[i] = 0.0;
+         for(size_t j = 0; j < n_other; ++j)
+         {  double tj = t_llsq(j, n_other);
+            double qj = 0.0;
+            if( tj < 0.0 )
+               qj = -1.0;
+            if( tj > 0.0 )
+               qj = +1.0;
+            double model = 0.0;
+            double tji   = 1.0;
+            for(size_t i = 0; i < n_arg; ++i)
+            {  model += x[i] * tji;
+               tji   *= tj;
+            }
+            tji = 1.0;
+            for(size_t i = 0; i < n_arg; ++i)
+            {  g_[i] += (model - qj) * tji;
+               tji   *= tj;
+            }
+         }
+         return g_;
+      }
+   };
+   //
+   // hes_llsq
+   // Hessian of llsq_obj computed by hand (times factor)
+   class hes_llsq : public cmpad::hessian {
+   private:
+      // factor_
+      const double factor_;
+      //
+      // option_
+      cmpad::option_t option_;
+      //
+      // h_
+      cmpad::vector<double> h_;
+   public:
+      // ctor
+      hes_llsq(double factor) : factor_(factor)
+      { }
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         h_.resize(option.n_arg * option.n_arg);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg; }
+      // operator()
+      // the Hessian does not depend on x
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>&
+      ) override
+      {  size_t n_arg   = option_.n_arg;
+         size_t n_other = option_.n_other;
+         for(size_t i = 0; i < n_arg * n_arg; ++i)
+            h_[i] = 0.0;
+         for(size_t j = 0; j < n_other; ++j)
+         {  double tj  = t_llsq(j, n_other);
+            double tji = 1.0;
+            for(size_t i = 0; i < n_arg; ++i)
+            {  double tjk = 1.0;
+               for(size_t k = 0; k < n_arg; ++k)
+               {  h_[i * n_arg + k] += factor_ * tji * tjk;
+                  tjk *= tj;
+               }
+               tji *= tj;
+            }
+         }
+         return h_;
+      }
+   };
+   //
+   // jvp_llsq
+   // Jacobian of llsq_obj times n_direction directions (times factor).
+   // If transpose is true, direction ell is read from the wrong place; i.e.,
+   // v_j^ell = xv[n + ell * n + j] instead of xv[n + j * q + ell].
+   class jvp_llsq : public cmpad::jvp {
+   private:
+      // factor_, transpose_
+      const double factor_;
+      const bool   transpose_;
+      //
+      // option_
+      cmpad::option_t option_;
+      //
+      // grad_
+      grad_llsq grad_;
+      //
+      // x_, y_
+      cmpad::vector<double> x_, y_;
+   public:
+      // ctor
+      jvp_llsq(double factor, bool transpose = false)
+      : factor_(factor), transpose_(transpose)
+      { }
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         grad_.setup(option);
+         x_.resize(option.n_arg);
+         y_.resize(option.n_direction);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg * (1 + option_.n_direction); }
+      // range
+      size_t range(void) const override
+      {  return option_.n_direction; }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& xv
+      ) override
+      {  size_t n = option_.n_arg;
+         size_t q = option_.n_direction;
+         for(size_t j = 0; j < n; ++j)
+            x_[j] = xv[j];
+         const cmpad::vector<double>& g = grad_(x_);
+         for(size_t ell = 0; ell < q; ++ell)
+         {  y_[ell] = 0.0;
+            for(size_t j = 0; j < n; ++j)
+            {  size_t k = transpose_ ? ell * n + j : j * q + ell;
+               y_[ell] += factor_ * g[j] * xv[n + k];
+            }
+         }
+         return y_;
+      }
+   };
+   //
+   // hv_llsq
+   // Hessian of llsq_obj times a vector (times factor)
+   class hv_llsq : public cmpad::hessian_vector {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // hes_
+      hes_llsq hes_;
+      //
+      // x_, y_
+      cmpad::vector<double> x_, y_;
+   public:
+      // ctor
+      hv_llsq(double factor) : hes_(factor)
+      { }
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         hes_.setup(option);
+         x_.resize(option.n_arg);
+         y_.resize(option.n_arg);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return 2 * option_.n_arg; }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& xv
+      ) override
+      {  size_t n = option_.n_arg;
+         for(size_t j = 0; j < n; ++j)
+            x_[j] = xv[j];
+         const cmpad::vector<double>& h = hes_(x_);
+         for(size_t i = 0; i < n; ++i)
+         {  y_[i] = 0.0;
+            for(size_t j = 0; j < n; ++j)
+               y_[i] += h[i * n + j] * xv[n + j];
+         }
+         return y_;
+      }
+   };
+   //
+   // jac_llsq
+   // Jacobian of llsq_obj (times factor)
+   class jac_llsq : public cmpad::jacobian {
+   private:
+      // factor_
+      const double factor_;
+      //
+      // option_
+      cmpad::option_t option_;
+      //
+      // grad_
+      grad_llsq grad_;
+      //
+      // j_
+      cmpad::vector<double> j_;
+   public:
+      // ctor
+      jac_llsq(double factor) : factor_(factor)
+      { }
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         grad_.setup(option);
+         j_.resize(option.n_arg);
+         choose_mode(1, option.n_arg);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg; }
+      // range
+      size_t range(void) const override
+      {  return option_.n_arg; }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  const cmpad::vector<double>& g = grad_(x);
+         for(size_t j = 0; j < option_.n_arg; ++j)
+            j_[j] = factor_ * g[j];
+         return j_;
+      }
+   };
+   //
+   // sjac_llsq
+   // sparse Jacobian of llsq_obj (times factor), every entry is in the
+   // sparsity pattern because llsq_obj has one range component
+   class sjac_llsq : public cmpad::sparse_jacobian {
+   private:
+      // factor_
+      const double factor_;
+      //
+      // option_
+      cmpad::option_t option_;
+      //
+      // grad_
+      grad_llsq grad_;
+      //
+      // row_, col_, val_
+      cmpad::vector<size_t> row_, col_;
+      cmpad::vector<double> val_;
+   public:
+      // ctor
+      sjac_llsq(double factor) : factor_(factor)
+      { }
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         grad_.setup(option);
+         size_t n = option.n_arg;
+         row_.resize(n);
+         col_.resize(n);
+         val_.resize(n);
+         for(size_t k = 0; k < n; ++k)
+         {  row_[k] = 0;
+            col_[k] = n - k - 1;
+         }
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg; }
+      // row
+      const cmpad::vector<size_t>& row(void) const override
+      {  return row_; }
+      // col
+      const cmpad::vector<size_t>& col(void) const override
+      {  return col_; }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  const cmpad::vector<double>& g = grad_(x);
+         for(size_t k = 0; k < option_.n_arg; ++k)
+            val_[k] = factor_ * g[ col_[k] ];
+         return val_;
+      }
+   };
+   //
+   // shes_llsq
+   // upper triangle of the Hessian of llsq_obj (times factor)
+   class shes_llsq : public cmpad::sparse_hessian {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // hes_
+      hes_llsq hes_;
+      //
+      // row_, col_, val_
+      cmpad::vector<size_t> row_, col_;
+      cmpad::vector<double> val_;
+   public:
+      // ctor
+      shes_llsq(double factor) : hes_(factor)
+      { }
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         hes_.setup(option);
+         size_t n = option.n_arg;
+         row_.resize(0);
+         col_.resize(0);
+         for(size_t i = 0; i < n; ++i)
+         {  for(size_t k = i; k < n; ++k)
+            {  row_.push_back(i);
+               col_.push_back(k);
+            }
+         }
+         val_.resize( row_.size() );
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg; }
+      // row
+      const cmpad::vector<size_t>& row(void) const override
+      {  return row_; }
+      // col
+      const cmpad::vector<size_t>& col(void) const override
+      {  return col_; }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  size_t n = option_.n_arg;
+         const cmpad::vector<double>& h = hes_(x);
+         for(size_t ell = 0; ell < val_.size(); ++ell)
+            val_[ell] = h[ row_[ell] * n + col_[ell] ];
+         return val_;
+      }
+   };
+   //
+   // vjp_llsq
+   // n_direction weight vectors times the Jacobian of llsq_obj (times factor)
+   class vjp_llsq : public cmpad::vjp {
+   private:
+      // factor_
+      const double factor_;
+      //
+      // option_
+      cmpad::option_t option_;
+      //
+      // grad_
+      grad_llsq grad_;
+      //
+      // x_, z_
+      cmpad::vector<double> x_, z_;
+   public:
+      // ctor
+      vjp_llsq(double factor) : factor_(factor)
+      { }
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         grad_.setup(option);
+         x_.resize(option.n_arg);
+         z_.resize(option.n_direction * option.n_arg);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      // llsq_obj has one range component so each weight vector is a scalar
+      size_t domain(void) const override
+      {  return option_.n_arg + option_.n_direction; }
+      // range
+      size_t range(void) const override
+      {  return option_.n_direction * option_.n_arg; }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& xw
+      ) override
+      {  size_t n = option_.n_arg;
+         size_t q = option_.n_direction;
+         for(size_t j = 0; j < n; ++j)
+            x_[j] = xw[j];
+         const cmpad::vector<double>& g = grad_(x_);
+         for(size_t ell = 0; ell < q; ++ell)
+            for(size_t j = 0; j < n; ++j)
+               z_[ell * n + j] = factor_ * xw[n + ell] * g[j];
+         return z_;
+      }
+   };
+   //
+   // quiet_t
+   // redirects cerr while in scope so near_equal messages are not printed
+   class quiet_t {
+   private:
+      std::stringstream ss_;
+      std::streambuf*   cerr_buf_;
+   public:
+      quiet_t(void) : cerr_buf_( std::cerr.rdbuf( ss_.rdbuf() ) )
+      { }
+      ~quiet_t(void)
+      {  std::cerr.rdbuf( cerr_buf_ ); }
+   };
+   //
+   // check_first
+   // a correct first order derivative (factor 1) passes the check and
+   // an incorrect one (factor 1.01) fails
+   template <class Derivative>
+   bool check_first(const cmpad::option_t& option, double rel_tol)
+   {  bool ok = true;
+      Derivative good(1.0);
+      Derivative bad(1.01);
+      double rel_error;
+      ok &= cmpad::der_check<cmpad::llsq_obj>(
+         good, option, rel_tol, rel_error
+      );
+      ok &= rel_error < rel_tol;
+      quiet_t quiet;
+      ok &= ! cmpad::der_check<cmpad::llsq_obj>(
+         bad, option, rel_tol, rel_error
+      );
+      ok &= 0.005 < rel_error && rel_error < 0.02;
+      return ok;
+   }
+   //
+   // check_second
+   // a correct second order derivative (factor 1) passes the check and
+   // an incorrect one (factor 1.01) fails
+   template <class Derivative>
+   bool check_second(const cmpad::option_t& option, double rel_tol)
+   {  bool ok = true;
+      grad_llsq  grad;
+      Derivative good(1.0);
+      Derivative bad(1.01);
+      double rel_error;
+      ok &= cmpad::der_check<cmpad::llsq_obj>(
+         good, grad, option, rel_tol, rel_error
+      );
+      ok &= rel_error < rel_tol;
+      quiet_t quiet;
+      ok &= ! cmpad::der_check<cmpad::llsq_obj>(
+         bad, grad, option, rel_tol, rel_error
+      );
+      ok &= 0.005 < rel_error && rel_error < 0.02;
+      return ok;
+   }
+} // END_EMPTY_NAMESPACE
+
+bool xam_der_check(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg       = 4;
+   option.n_other     = 10;
+   option.time_setup  = false;
+   option.n_direction = 2;
+   //
+   // rel_tol
+   double rel_tol = 1e-6;
+   //
+   // ok
+   ok &= check_second<hes_llsq>(option, rel_tol);
+   ok &= check_second<hv_llsq>(option, rel_tol);
+   ok &= check_second<shes_llsq>(option, rel_tol);
+   ok &= check_first<jac_llsq>(option, rel_tol);
+   ok &= check_first<sjac_llsq>(option, rel_tol);
+   ok &= check_first<jvp_llsq>(option, rel_tol);
+   ok &= check_first<vjp_llsq>(option, rel_tol);
+   //
+   // ok
+   // a jvp that reads the directions in the wrong order fails the check
+   jvp_llsq jvp_transpose(1.0, true);
+   double rel_error;
+   {  quiet_t quiet;
+      ok &= ! cmpad::der_check<cmpad::llsq_obj>(
+         jvp_transpose, option, rel_tol, rel_error
+      );
+   }
+   //
+   return ok;
+}
+// END C++
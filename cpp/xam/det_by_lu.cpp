@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin xam_det_by_lu.cpp}
+
+Example and Test of det_by_lu
+#############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_det_by_lu.cpp}
+*/
+// BEGIN C++
+# include <limits>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/algo/det_by_lu.hpp>
+
+bool xam_det_by_lu(void)
+{  // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 10. * std::numeric_limits<double>::epsilon();
+   //
+   // ell
+   // dimension of the matrix
+   size_t ell = 3;
+   //
+   // det
+   typedef cmpad::vector<double> Vector;
+   cmpad::det_by_lu<Vector>      det;
+   //
+   // x
+   cmpad::vector<double>  x = {
+      1., 2., 3.,  // x[0] x[1] x[2]
+      3., 2., 1.,  // x[3] x[4] x[5]
+      2., 1., 2.   // x[6] x[7] x[8]
+   };
+   ok &= x.size() == ell * ell;
+   //
+   // check
+   double check =
+      + x[0]*(x[4]*x[8] - x[5]*x[7])
+      - x[1]*(x[3]*x[8] - x[5]*x[6])
+      + x[2]*(x[3]*x[7] - x[4]*x[6]);
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg   = ell * ell;
+   //
+   // n_other
+   // without and with partial pivoting
+   for(size_t n_other = 0; n_other < 2; ++n_other)
+   {  //
+      // det.setup
+      option.n_other = n_other;
+      det.setup(option);
+      //
+      // ok
+      const cmpad::vector<double>& y = det(x);
+      ok &= y.size() == 1;
+      ok &= cmpad::near_equal(y[0], check, rel_error, x);
+   }
+   //
+   // x, check
+   // a matrix that requires pivoting (x[0] is zero)
+   x[0]  = 0.0;
+   check = - x[1]*(x[3]*x[8] - x[5]*x[6]) + x[2]*(x[3]*x[7] - x[4]*x[6]);
+   //
+   // ok
+   const cmpad::vector<double>& y = det(x);
+   ok &= cmpad::near_equal(y[0], check, rel_error, x);
+   //
+   return ok;
+}
+
+// END C++
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin xam_det_by_memo.cpp}
+
+Example and Test of det_by_memo
+###############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_det_by_memo.cpp}
+*/
+// BEGIN C++
+# include <limits>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/algo/det_by_memo.hpp>
+# include <cmpad/algo/det_by_minor.hpp>
+
+bool xam_det_by_memo(void)
+{  // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 100. * std::numeric_limits<double>::epsilon();
+   //
+   // ell
+   // dimension of the matrix
+   size_t ell = 3;
+   //
+   // det
+   typedef cmpad::vector<double> Vector;
+   cmpad::det_by_memo<Vector>    det;
+   //
+   // det.setup
+   cmpad::option_t option;
+   option.n_arg   = ell * ell;
+   option.n_other = 0;
+   det.setup(option);
+   //
+   // x
+   cmpad::vector<double>  x = {
+      1., 2., 3.,  // x[0] x[1] x[2]
+      3., 2., 1.,  // x[3] x[4] x[5]
+      2., 1., 2.   // x[6] x[7] x[8]
+   };
+   ok &= x.size() == ell * ell;
+   //
+   // y
+   const cmpad::vector<double>& y = det(x);
+   ok &= y.size() == 1;
+   //
+   // check
+   double check =
+      + x[0]*(x[4]*x[8] - x[5]*x[7])
+      - x[1]*(x[3]*x[8] - x[5]*x[6])
+      + x[2]*(x[3]*x[7] - x[4]*x[6]);
+   //
+   // ok
+   ok &= y[0] == check;
+   //
+   // ell, option, x
+   // a larger matrix with random elements
+   ell            = 5;
+   option.n_arg   = ell * ell;
+   x.resize(ell * ell);
+   cmpad::uniform_01(x);
+   //
+   // minor
+   cmpad::det_by_minor<Vector> minor;
+   minor.setup(option);
+   //
+   // ok
+   // same determinant as expansion by minors
+   det.setup(option);
+   ok &= cmpad::near_equal( det(x)[0], minor(x)[0], rel_error, x);
+   //
+   return ok;
+}
+
+// END C++
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_dormand_prince.cpp}
+
+Example and Test of C++ dormand_prince
+######################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_dormand_prince.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <cmpad/algo/dormand_prince.hpp>
+# include <cmpad/near_equal.hpp>
+
+namespace {
+
+   // fun
+   // y_0'(t) = y_1(t), y_1'(t) = - y_0(t)
+   void fun(const cmpad::vector<double>& y, cmpad::vector<double>& dy)
+   {  dy[0] = y[1];
+      dy[1] = - y[0];
+   }
+}
+
+bool xam_dormand_prince(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // yi
+   // y_0(t) = sin(t), y_1(t) = cos(t)
+   cmpad::vector<double> yi = { 0.0, 1.0 };
+   //
+   // tf
+   double tf = 3.0;
+   //
+   // work, yf
+   cmpad::dormand_prince_work< cmpad::vector<double> > work;
+   cmpad::vector<double> yf( yi.size() );
+   //
+   // tol
+   for(double tol : { 1e-4, 1e-8 } )
+   {  //
+      // n_step
+      size_t n_step = cmpad::dormand_prince(fun, yi, tf, tol, yf, work);
+      //
+      // ok
+      // the first step size is tf and that step is rejected
+      ok &= 1 < n_step;
+      //
+      // ok
+      // there are multiple steps so the final error could be larger than tol
+      double rel_error = 10.0 * tol;
+      ok &= cmpad::near_equal( yf[0], std::sin(tf), rel_error, yi );
+      ok &= cmpad::near_equal( yf[1], std::cos(tf), rel_error, yi );
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_grad_check.cpp}
+
+Example and Test of grad_check
+##############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_grad_check.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <iostream>
+# include <sstream>
+# include <cmpad/gradient.hpp>
+# include <cmpad/grad_check.hpp>
+# include <cmpad/algo/llsq_obj.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+   //
+   // grad_llsq
+   // gradient of llsq_obj computed by hand (times factor)
+   class grad_llsq : public cmpad::gradient {
+   private:
+      // factor_
+      const double factor_;
+      //
+      // option_
+      cmpad::option_t option_;
+      //
+      // g_
+      cmpad::vector<double> g_;
+   public:
+      // ctor
+      grad_llsq(double factor) : factor_(factor)
+      { }
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         g_.resize(option.n_arg);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg; }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  size_t n_arg   = option_.n_arg;
+         size_t n_other = option_.n_other;
+         for(size_t i = 0; i < n_arg; ++i)
+            g_[i] = 0.0;
+         for(size_t j = 0; j < n_other; ++j)
+         {  double tj = -1.0 + 2.0 * double(j) / double(n_other-1);
+            double qj = 0.0;
+            if( tj < 0.0 )
+               qj = -1.0;
+            if( tj > 0.0 )
+               qj = +1.0;
+            double model = 0.0;
+            double tji   = 1.0;
+            for(size_t i = 0; i < n_arg; ++i)
+            {  model += x[i] * tji;
+               tji   *= tj;
+            }
+            tji = 1.0;
+            for(size_t i = 0; i < n_arg; ++i)
+            {  g_[i] += factor_ * (model - qj) * tji;
+               tji   *= tj;
+            }
+         }
+         return g_;
+      }
+   };
+   //
+   // osc_obj
+   // sum of sin( 1e4 * x[i] ) which is not smooth on the scale of the
+   // central difference step size (so grad_check skips every component)
+   template <class Vector> class osc_obj : public cmpad::fun_obj<Vector> {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // y_
+      Vector y_;
+   public:
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         y_.resize(1);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg; }
+      // range
+      size_t range(void) const override
+      {  return 1; }
+      // operator()
+      const Vector& operator()(const Vector& x) override
+      {  y_[0] = 0.0;
+         for(size_t i = 0; i < option_.n_arg; ++i)
+            y_[0] += std::sin( 1e4 * x[i] );
+         return y_;
+      }
+   };
+   //
+   // grad_osc
+   // gradient of osc_obj
+   class grad_osc : public cmpad::gradient {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // g_
+      cmpad::vector<double> g_;
+   public:
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         g_.resize(option.n_arg);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      // domain
+      size_t domain(void) const override
+      {  return option_.n_arg; }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  for(size_t i = 0; i < option_.n_arg; ++i)
+            g_[i] = 1e4 * std::cos( 1e4 * x[i] );
+         return g_;
+      }
+   };
+} // END_EMPTY_NAMESPACE
+
+bool xam_grad_check(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg      = 4;
+   option.n_other    = 10;
+   option.time_setup = false;
+   //
+   // rel_tol
+   double rel_tol = 1e-6;
+   //
+   // ok
+   // a correct gradient passes the check
+   grad_llsq good(1.0);
+   double rel_error;
+   ok &= cmpad::grad_check<cmpad::llsq_obj>(good, option, rel_tol, rel_error);
+   ok &= rel_error < rel_tol;
+   //
+   // ok
+   // an incorrect gradient fails the check
+   // (redirect cerr so near_equal messages are not printed)
+   std::stringstream ss;
+   std::streambuf* cerr_buf = std::cerr.rdbuf( ss.rdbuf() );
+   grad_llsq bad(1.01);
+   ok &= ! cmpad::grad_check<cmpad::llsq_obj>(bad, option, rel_tol, rel_error);
+   std::cerr.rdbuf( cerr_buf );
+   ok &= 0.005 < rel_error && rel_error < 0.02;
+   //
+   // ok
+   // the check fails when too many components are skipped
+   // (even though grad_osc is correct)
+   ss.str("");
+   cerr_buf = std::cerr.rdbuf( ss.rdbuf() );
+   grad_osc osc;
+   ok &= ! cmpad::grad_check<osc_obj>(osc, option, rel_tol, rel_error);
+   std::cerr.rdbuf( cerr_buf );
+   ok &= ss.str().find("n_skip = 12, n_candidate = 12") != std::string::npos;
+   //
+   return ok;
+}
+// END C++
@@ -27,6 +27,7 @@ Source Code
 # include <cmpad/algo/an_ode.hpp>
 # include <cmpad/algo/llsq_obj.hpp>
 # include <cmpad/autodiff/gradient.hpp>
+# include <cmpad/checkpoint_gradient.hpp>
 # include "check_grad_det.hpp"
 # include "check_grad_ode.hpp"
 # include "check_grad_llsq.hpp"
@@ -45,6 +46,10 @@ bool xam_gradient_autodiff(void)
    ok &= check_grad_ode(grad_ode);
    //
    // ok
+   cmpad::checkpoint_gradient<cmpad::autodiff::gradient> grad_ckpt;
+   ok &= check_grad_ode(grad_ckpt);
+   //
+   // ok
    cmpad::autodiff::gradient<cmpad::llsq_obj> grad_llsq;
    ok &= check_grad_llsq(grad_llsq);
    //
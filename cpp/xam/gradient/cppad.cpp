@@ -24,6 +24,7 @@ Source Code
 // BEGIN C++
 # include <cmpad/configure.hpp>
 # include <cmpad/cppad/gradient.hpp>
+# include <cmpad/checkpoint_gradient.hpp>
 //
 # include <cmpad/algo/det_by_minor.hpp>
 # include <cmpad/algo/an_ode.hpp>
@@ -47,6 +48,10 @@ bool xam_gradient_cppad(void)
    ok &= check_grad_ode(grad_ode);
    //
    // ok
+   cmpad::checkpoint_gradient<cmpad::cppad::gradient> grad_ckpt;
+   ok &= check_grad_ode(grad_ckpt);
+   //
+   // ok
    cmpad::cppad::gradient<cmpad::llsq_obj> grad_llsq;
    ok &= check_grad_llsq(grad_llsq);
    //
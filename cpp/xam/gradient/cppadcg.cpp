@@ -27,6 +27,7 @@ Source Code
 # include <cmpad/algo/an_ode.hpp>
 # include <cmpad/algo/llsq_obj.hpp>
 # include <cmpad/cppadcg/gradient.hpp>
+# include <cmpad/checkpoint_gradient.hpp>
 # include "check_grad_det.hpp"
 # include "check_grad_ode.hpp"
 # include "check_grad_llsq.hpp"
@@ -47,6 +48,11 @@ bool xam_gradient_cppadcg(void)
    }
    //
    // ok
+   {  cmpad::checkpoint_gradient<cmpad::cppadcg::gradient> grad_ckpt;
+      ok &= check_grad_ode(grad_ckpt);
+   }
+   //
+   // ok
    {  cmpad::cppadcg::gradient<cmpad::llsq_obj> grad_llsq;
       ok &= check_grad_llsq(grad_llsq);
    }
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_HESSIAN_CHECK_HES_LLSQ_HPP
+# define XAM_HESSIAN_CHECK_HES_LLSQ_HPP
+/*
+{xrst_begin check_hes_llsq.hpp}
+
+C++ Check Hessian of llsq_obj
+#############################
+
+Syntax
+******
+| |tab| ``# include "check_hes_llsq.hpp"``
+| |tab| *ok* = ``check_hes_llsq`` ( *hes_llsq* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+hes_llsq
+********
+Is a :ref:`cpp_fun_obj-name`
+object that computes the Hessian for the ref:`cpp_llsq_obj-name` algorithm.
+
+ok
+**
+is true (false) if the Hessian passes (fails) the test.
+
+Hessian
+*******
+The objective is quadratic in *x* and its Hessian does not depend on *x* :
+
+.. math::
+
+   \frac{ \partial^2 \R{obj} }{  \partial x_i \partial x_k }
+   =
+   \sum_j t_j^{i+k}
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_hes_llsq.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class Hessian>
+bool check_hes_llsq( Hessian& hes_llsq )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // n_arg, n_other
+   size_t n_arg   = 4;
+   size_t n_other = 10;
+   //
+   // time_setup
+   for(bool time_setup : { true, false } )
+   {  //
+      // option
+      cmpad::option_t option;
+      option.n_arg       = n_arg;
+      option.n_other     = n_other;
+      option.time_setup  = time_setup;
+      //
+      // hes_llsq
+      hes_llsq.setup(option);
+      //
+      // x
+      // values in the matrix in row major order
+      cmpad::vector<double> x(option.n_arg);
+      cmpad::uniform_01(x);
+      //
+      // h
+      cmpad::vector<double> h = hes_llsq(x);
+      //
+      // i, k
+      for(size_t i = 0; i < n_arg; ++i)
+      {  for(size_t k = 0; k < n_arg; ++k)
+         {  //
+            // d2obj_dxi_dxk
+            double d2obj_dxi_dxk = 0.0;
+            //
+            for(size_t j = 0; j < n_other; ++j)
+            {  //
+               // tj
+               double tj;
+               if( n_other == 1 )
+                  tj = 0.0;
+               else
+                  tj = -1.0 + 2.0 * double(j) / double(n_other-1);
+               //
+               // tj_ik
+               double tj_ik = 1;
+               for(size_t ell = 0; ell < i + k; ++ell)
+                  tj_ik *= tj;
+               //
+               // d2obj_dxi_dxk
+               d2obj_dxi_dxk += tj_ik;
+            }
+            // ok
+            // some of the elements are zero so scale using all of h
+            ok &= near_equal(h[i * n_arg + k], d2obj_dxi_dxk, rel_error, h);
+         }
+      }
+   }
+   return ok;
+}
+// END C++
+
+# endif
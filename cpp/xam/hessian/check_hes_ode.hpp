@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_HESSIAN_CHECK_HES_ODE_HPP
+# define XAM_HESSIAN_CHECK_HES_ODE_HPP
+/*
+{xrst_begin check_hes_ode.hpp}
+
+C++ Check Hessian of an_ode
+###########################
+
+Syntax
+******
+| |tab| ``# include "check_hes_ode.hpp"``
+| |tab| *ok* = check_hes_ode( *hes_ode* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+hes_ode
+*******
+Is a :ref:`cpp_fun_obj-name`
+object that computes the Hessian for the ref:`cpp_an_ode-name` algorithm.
+
+ok
+**
+is true (false) if the Hessian passes (fails) the test.
+
+Hessian
+*******
+We use :math:`r` to denote
+the range space component of the an_ode algorithm that we are
+computing the Hessian for; see :ref:`check_grad_ode.hpp@Gradient` .
+In this test :math:`r = n - 1` where :math:`n` is the dimension
+of the domain space.
+
+.. math::
+
+   \frac{ \partial^2 y_r (t) }{  \partial x_j \partial x_k } = \begin{cases}
+      y_r (t) / ( x_j x_k )   & \text{if} \; j \neq k  \\
+      0                       & \text{otherwise}
+   \end{cases}
+
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_hes_ode.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class Hessian>
+bool check_hes_ode( Hessian& hes_ode )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // n_arg
+   size_t n_arg = 4;
+   //
+   // time_setup
+   for(bool time_setup : { true, false } )
+   {  //
+      // option
+      cmpad::option_t option;
+      option.n_arg      = n_arg;
+      option.n_other    = 10;
+      option.time_setup = time_setup;
+      //
+      // hes_ode
+      hes_ode.setup(option);
+      //
+      // x
+      // note that x[i] != 0.0 so can divide by it
+      cmpad::vector<double> x(n_arg);
+      cmpad::uniform_01(x);
+      for(size_t i = 0; i < n_arg; ++i)
+         x[i] += 1.0;
+      //
+      // h
+      cmpad::vector<double> h = hes_ode(x);
+      //
+      // r
+      size_t r = n_arg - 1;
+      //
+      // y_r
+      double tf  = 2.0;
+      double y_r = x[0] * tf;
+      for(size_t j = 1; j <= r; ++j)
+      {  y_r = y_r * x[j] * tf / double(j+1);
+      }
+      //
+      // ok
+      // the diagonal is zero so scale its relative error using all of h
+      for(size_t j = 0; j < n_arg; ++j)
+      {  for(size_t k = 0; k < n_arg; ++k)
+         {  double hjk = h[j * n_arg + k];
+            if( j == k )
+               ok &= near_equal( hjk, 0.0, rel_error, h );
+            else
+               ok &= near_equal( hjk, y_r / (x[j] * x[k]), rel_error );
+         }
+      }
+   }
+   return ok;
+}
+// END C++
+
+# endif
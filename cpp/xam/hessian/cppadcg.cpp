@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_hessian_cppadcg.cpp}
+
+Example and Test of Hessian Using cppadcg
+#########################################
+
+check_hes_ode
+*************
+see :ref:`check_hes_ode.hpp-name`
+
+check_hes_llsq
+**************
+see :ref:`check_hes_llsq.hpp-name`
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  xam_hessian_cppadcg.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/cppadcg/hessian.hpp>
+//
+# include <cmpad/algo/an_ode.hpp>
+# include <cmpad/algo/llsq_obj.hpp>
+//
+# include "check_hes_ode.hpp"
+# include "check_hes_llsq.hpp"
+
+bool xam_hessian_cppadcg(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   {  cmpad::cppadcg::hessian<cmpad::an_ode> hes_ode;
+      ok &= check_hes_ode(hes_ode);
+   }
+   //
+   // ok
+   {  cmpad::cppadcg::hessian<cmpad::llsq_obj> hes_llsq;
+      ok &= check_hes_llsq(hes_llsq);
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_HESSIAN_VECTOR_CHECK_HVP_LLSQ_HPP
+# define XAM_HESSIAN_VECTOR_CHECK_HVP_LLSQ_HPP
+/*
+{xrst_begin check_hvp_llsq.hpp}
+{xrst_spell
+   hvp
+}
+
+C++ Check Hessian Times a Vector for llsq_obj
+#############################################
+
+Syntax
+******
+| |tab| ``# include "check_hvp_llsq.hpp"``
+| |tab| *ok* = ``check_hvp_llsq`` ( *hvp_llsq* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+hvp_llsq
+********
+Is a :ref:`cpp_fun_obj-name` object that computes the
+Hessian times a vector for the ref:`cpp_llsq_obj-name` algorithm.
+
+ok
+**
+is true (false) if the Hessian times a vector passes (fails) the test.
+
+Hessian
+*******
+see :ref:`check_hes_llsq.hpp@Hessian` .
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_hvp_llsq.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class HessianVector>
+bool check_hvp_llsq( HessianVector& hvp_llsq )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // n_arg, n_other
+   size_t n_arg   = 4;
+   size_t n_other = 10;
+   //
+   // time_setup
+   for(bool time_setup : { true, false } )
+   {  //
+      // option
+      cmpad::option_t option;
+      option.n_arg       = n_arg;
+      option.n_other     = n_other;
+      option.time_setup  = time_setup;
+      //
+      // hvp_llsq
+      hvp_llsq.setup(option);
+      //
+      // xv
+      cmpad::vector<double> xv(2 * n_arg);
+      cmpad::uniform_01(xv);
+      //
+      // hv
+      cmpad::vector<double> hv = hvp_llsq(xv);
+      //
+      // i
+      for(size_t i = 0; i < n_arg; ++i)
+      {  //
+         // sum
+         double sum = 0.0;
+         for(size_t k = 0; k < n_arg; ++k)
+         {  //
+            // d2obj_dxi_dxk
+            double d2obj_dxi_dxk = 0.0;
+            //
+            for(size_t j = 0; j < n_other; ++j)
+            {  //
+               // tj
+               double tj;
+               if( n_other == 1 )
+                  tj = 0.0;
+               else
+                  tj = -1.0 + 2.0 * double(j) / double(n_other-1);
+               //
+               // tj_ik
+               double tj_ik = 1;
+               for(size_t ell = 0; ell < i + k; ++ell)
+                  tj_ik *= tj;
+               //
+               // d2obj_dxi_dxk
+               d2obj_dxi_dxk += tj_ik;
+            }
+            // sum
+            sum += d2obj_dxi_dxk * xv[n_arg + k];
+         }
+         // ok
+         // some of the elements may be near zero so scale using all of hv
+         ok &= near_equal(hv[i], sum, rel_error, hv);
+      }
+   }
+   return ok;
+}
+// END C++
+
+# endif
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_HESSIAN_VECTOR_CHECK_HVP_ODE_HPP
+# define XAM_HESSIAN_VECTOR_CHECK_HVP_ODE_HPP
+/*
+{xrst_begin check_hvp_ode.hpp}
+{xrst_spell
+   hvp
+}
+
+C++ Check Hessian Times a Vector for an_ode
+###########################################
+
+Syntax
+******
+| |tab| ``# include "check_hvp_ode.hpp"``
+| |tab| *ok* = check_hvp_ode( *hvp_ode* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+hvp_ode
+*******
+Is a :ref:`cpp_fun_obj-name` object that computes the
+Hessian times a vector for the ref:`cpp_an_ode-name` algorithm.
+
+ok
+**
+is true (false) if the Hessian times a vector passes (fails) the test.
+
+Hessian
+*******
+see :ref:`check_hes_ode.hpp@Hessian` .
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_hvp_ode.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class HessianVector>
+bool check_hvp_ode( HessianVector& hvp_ode )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // n_arg
+   size_t n_arg = 4;
+   //
+   // time_setup
+   for(bool time_setup : { true, false } )
+   {  //
+      // option
+      cmpad::option_t option;
+      option.n_arg      = n_arg;
+      option.n_other    = 10;
+      option.time_setup = time_setup;
+      //
+      // hvp_ode
+      hvp_ode.setup(option);
+      //
+      // xv
+      // note that x[i] = xv[i] != 0.0 so can divide by it
+      cmpad::vector<double> xv(2 * n_arg);
+      cmpad::uniform_01(xv);
+      for(size_t i = 0; i < n_arg; ++i)
+         xv[i] += 1.0;
+      //
+      // hv
+      cmpad::vector<double> hv = hvp_ode(xv);
+      //
+      // r
+      size_t r = n_arg - 1;
+      //
+      // y_r
+      double tf  = 2.0;
+      double y_r = xv[0] * tf;
+      for(size_t j = 1; j <= r; ++j)
+      {  y_r = y_r * xv[j] * tf / double(j+1);
+      }
+      //
+      // ok
+      for(size_t j = 0; j < n_arg; ++j)
+      {  double sum = 0.0;
+         for(size_t k = 0; k < n_arg; ++k)
+         {  if( j != k )
+               sum += y_r / (xv[j] * xv[k]) * xv[n_arg + k];
+         }
+         ok &= near_equal( hv[j], sum, rel_error );
+      }
+   }
+   return ok;
+}
+// END C++
+
+# endif
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_hessian_vector_cppadcg.cpp}
+
+Example and Test of Hessian Times a Vector Using cppadcg
+########################################################
+
+check_hvp_ode
+*************
+see :ref:`check_hvp_ode.hpp-name`
+
+check_hvp_llsq
+**************
+see :ref:`check_hvp_llsq.hpp-name`
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  xam_hessian_vector_cppadcg.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/cppadcg/hessian_vector.hpp>
+//
+# include <cmpad/algo/an_ode.hpp>
+# include <cmpad/algo/llsq_obj.hpp>
+//
+# include "check_hvp_ode.hpp"
+# include "check_hvp_llsq.hpp"
+
+bool xam_hessian_vector_cppadcg(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   {  cmpad::cppadcg::hessian_vector<cmpad::an_ode> hvp_ode;
+      ok &= check_hvp_ode(hvp_ode);
+   }
+   //
+   // ok
+   {  cmpad::cppadcg::hessian_vector<cmpad::llsq_obj> hvp_llsq;
+      ok &= check_hvp_llsq(hvp_llsq);
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin xam_huber_obj.cpp}
+
+Example and Test of huber_obj
+#############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_huber_obj.cpp}
+*/
+// BEGIN C++
+# include <limits>
+# include <cmpad/algo/huber_obj.hpp>
+# include <cmpad/near_equal.hpp>
+
+bool xam_huber_obj(void)
+{  // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 100. * std::numeric_limits<double>::epsilon();
+   //
+   // native, cond
+   // native branches and conditional expressions
+   typedef cmpad::vector<double> Vector;
+   cmpad::huber_obj<Vector>      native, cond;
+   //
+   // native.setup, cond.setup
+   cmpad::option_t option;
+   option.n_arg   = 5;
+   option.n_other = 0;
+   native.setup(option);
+   option.n_other = 1;
+   cond.setup(option);
+   //
+   // ok
+   ok &= native.domain() == 5;
+   ok &= native.range()  == 1;
+   ok &= native.x_branch() == true;
+   ok &= cond.x_branch()   == false;
+   //
+   // ok
+   // cond_exp_lt is not recorded for float, so it is a native branch
+   cmpad::huber_obj< cmpad::vector<float> > cond_float;
+   cond_float.setup(option);
+   ok &= cond_float.x_branch() == true;
+   //
+   // s
+   // t = (-1, -.5, 0, .5, 1) and s_3 is an outlier
+   Vector s = { -1.0, -1.0, 0.0, 3.0, 1.0 };
+   //
+   // x
+   // the residuals x - s are ( 0.5, 2.0, -1.0, -3.0, 0.0 ),
+   // the differences x_{i+1} - x_i are ( 1.5, -2.0, 1.0, 1.0 ).
+   Vector x = { -0.5, 1.0, -1.0, 0.0, 1.0 };
+   //
+   // check
+   double delta = 1.5, tau = 0.5;
+   double check = 0.0;
+   check += 0.5 * 0.5 * 0.5;                // | 0.5| < delta
+   check += delta * (2.0 - 0.5 * delta);    // | 2.0| >= delta
+   check += 0.5 * 1.0 * 1.0;                // |-1.0| < delta
+   check += delta * (3.0 - 0.5 * delta);    // |-3.0| >= delta
+   check += 0.0;                            // | 0.0| < delta
+   check += (1.5 - tau) * (1.5 - tau);      // | 1.5| > tau
+   check += (2.0 - tau) * (2.0 - tau);      // |-2.0| > tau
+   check += (1.0 - tau) * (1.0 - tau);      // | 1.0| > tau
+   check += (1.0 - tau) * (1.0 - tau);      // | 1.0| > tau
+   //
+   // ok
+   ok &= cmpad::near_equal( native(x)[0], check, rel_error );
+   ok &= cmpad::near_equal( cond(x)[0], check, rel_error );
+   //
+   // ok
+   // the residuals are zero when x = s, but the jumps in s are penalized
+   // the differences s_{i+1} - s_i are ( 0.0, 1.0, 3.0, -2.0 )
+   check  = (1.0 - tau) * (1.0 - tau);
+   check += (3.0 - tau) * (3.0 - tau);
+   check += (2.0 - tau) * (2.0 - tau);
+   ok &= cmpad::near_equal( native(s)[0], check, rel_error );
+   ok &= cmpad::near_equal( cond(s)[0], check, rel_error );
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_JACOBIAN_CHECK_JAC_LLSQ_HPP
+# define XAM_JACOBIAN_CHECK_JAC_LLSQ_HPP
+/*
+{xrst_begin check_jac_llsq.hpp}
+
+C++ Check Jacobian of llsq_obj
+##############################
+
+Syntax
+******
+| |tab| ``# include "check_jac_llsq.hpp"``
+| |tab| *ok* = ``check_jac_llsq`` ( *jac_llsq* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+jac_llsq
+********
+Is a :ref:`cpp_jacobian-name`
+object that computes the Jacobian for the ref:`cpp_llsq_obj-name` algorithm.
+The Jacobian is checked for each of the requests
+``auto`` , ``forward`` , and ``reverse`` .
+
+ok
+**
+is true (false) if the Jacobian passes (fails) the test.
+
+Jacobian
+********
+The range space for this algorithm has dimension one,
+so its Jacobian is equal to its gradient; see
+:ref:`check_grad_llsq.hpp-name` .
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_jac_llsq.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class Jacobian>
+bool check_jac_llsq( Jacobian& jac_llsq )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // n_arg, n_other
+   size_t n_arg   = 4;
+   size_t n_other = 10;
+   //
+   // request
+   for(std::string request : { "auto", "forward", "reverse" } )
+   {  //
+      // time_setup
+      for(bool time_setup : { true, false } )
+      {  //
+         // option
+         cmpad::option_t option;
+         option.n_arg       = n_arg;
+         option.n_other     = n_other;
+         option.time_setup  = time_setup;
+         //
+         // jac_llsq
+         jac_llsq.set_mode(request);
+         jac_llsq.setup(option);
+         //
+         // ok
+         ok &= jac_llsq.mode() == "forward" || jac_llsq.mode() == "reverse";
+         ok &= jac_llsq.range() == n_arg;
+         //
+         // x
+         cmpad::vector<double> x(option.n_arg);
+         cmpad::uniform_01(x);
+         //
+         // J
+         cmpad::vector<double> J = jac_llsq(x);
+         //
+         // i
+         for(size_t i = 0; i < n_arg; ++i)
+         {  //
+            // dobj_dxi
+            double dobj_dxi = 0.0;
+            //
+            for(size_t j = 0; j < n_other; ++j)
+            {  //
+               // tj
+               double tj;
+               if( n_other == 1 )
+                  tj = 0.0;
+               else
+                  tj = -1.0 + 2.0 * double(j) / double(n_other-1);
+               //
+               // qj
+               double qj = std::copysign(1.0, tj);
+               if( tj == 0.0 )
+                  qj = 0.0;
+               //
+               // rj
+               double mj = x[0] + x[1] * tj + x[2] * tj*tj + x[3] * tj*tj*tj;
+               double rj = mj - qj;
+               //
+               // tj_i
+               double tj_i = 1;
+               for(size_t k = 0; k < i; ++k)
+                  tj_i *= tj;
+               //
+               // dobj_dxi
+               dobj_dxi += rj * tj_i;
+            }
+            // ok
+            ok &= near_equal(J[i], dobj_dxi, rel_error);
+         }
+      }
+   }
+   return ok;
+}
+// END C++
+
+# endif
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_JACOBIAN_CHECK_JAC_ODE_HPP
+# define XAM_JACOBIAN_CHECK_JAC_ODE_HPP
+/*
+{xrst_begin check_jac_ode.hpp}
+
+C++ Check Jacobian of an_ode
+############################
+
+Syntax
+******
+| |tab| ``# include "check_jac_ode.hpp"``
+| |tab| *ok* = ``check_jac_ode`` ( *jac_ode* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+jac_ode
+*******
+Is a :ref:`cpp_jacobian-name`
+object that computes the Jacobian for the ref:`cpp_an_ode-name` algorithm.
+The Jacobian is checked for each of the requests
+``auto`` , ``forward`` , and ``reverse`` .
+
+ok
+**
+is true (false) if the Jacobian passes (fails) the test.
+
+Jacobian
+********
+The solution of the ODE at the final time is
+
+.. math::
+
+   y_i = x_0 t_f \prod_{j=1}^i \frac{ x_j t_f }{ j + 1 }
+
+where :math:`t_f = 2` .
+It follows that for :math:`j \leq i` ,
+:math:`\partial y_i / \partial x_j = y_i / x_j`
+and for :math:`j > i` , :math:`\partial y_i / \partial x_j = 0` .
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_jac_ode.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class Jacobian>
+bool check_jac_ode( Jacobian& jac_ode )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // n_arg
+   size_t n_arg = 4;
+   //
+   // request
+   for(std::string request : { "auto", "forward", "reverse" } )
+   {  //
+      // time_setup
+      for(bool time_setup : { true, false } )
+      {  //
+         // option
+         cmpad::option_t option;
+         option.n_arg      = n_arg;
+         option.n_other    = 10;
+         option.time_setup = time_setup;
+         //
+         // jac_ode
+         jac_ode.set_mode(request);
+         jac_ode.setup(option);
+         //
+         // ok
+         ok &= jac_ode.mode() == "forward" || jac_ode.mode() == "reverse";
+         ok &= jac_ode.range() == n_arg * n_arg;
+         //
+         // x
+         // note that x[i] != 0.0 so can divide by it
+         cmpad::vector<double> x(n_arg);
+         cmpad::uniform_01(x);
+         for(size_t i = 0; i < n_arg; ++i)
+            x[i] += 1.0;
+         //
+         // J
+         cmpad::vector<double> J = jac_ode(x);
+         //
+         // y_i
+         double tf  = 2.0;
+         double y_i = x[0] * tf;
+         for(size_t i = 0; i < n_arg; ++i)
+         {  if( i > 0 )
+               y_i = y_i * x[i] * tf / double(i+1);
+            //
+            // ok
+            for(size_t j = 0; j < n_arg; ++j)
+            {  double Jij = J[i * n_arg + j];
+               if( j <= i )
+                  ok &= near_equal( Jij, y_i / x[j], rel_error );
+               else
+                  ok &= near_equal( Jij, 0.0, rel_error, J );
+            }
+         }
+      }
+   }
+   return ok;
+}
+// END C++
+
+# endif
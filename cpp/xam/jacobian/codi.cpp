@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_jacobian_codi.cpp}
+
+Example and Test of Jacobian Using codi
+#######################################
+
+check_jac_ode
+*************
+see :ref:`check_jac_ode.hpp-name`
+
+check_jac_llsq
+**************
+see :ref:`check_jac_llsq.hpp-name`
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  xam_jacobian_codi.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/codi/jacobian.hpp>
+//
+# include <cmpad/algo/an_ode.hpp>
+# include <cmpad/algo/llsq_obj.hpp>
+//
+# include "check_jac_ode.hpp"
+# include "check_jac_llsq.hpp"
+
+bool xam_jacobian_codi(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   cmpad::codi::jacobian<cmpad::an_ode> jac_ode;
+   ok &= check_jac_ode(jac_ode);
+   //
+   // ok
+   cmpad::codi::jacobian<cmpad::llsq_obj> jac_llsq;
+   ok &= check_jac_llsq(jac_llsq);
+   //
+   return ok;
+}
+// END C++
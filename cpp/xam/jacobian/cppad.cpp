@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_jacobian_cppad.cpp}
+
+Example and Test of Jacobian Using cppad
+########################################
+
+check_jac_ode
+*************
+see :ref:`check_jac_ode.hpp-name`
+
+check_jac_llsq
+**************
+see :ref:`check_jac_llsq.hpp-name`
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  xam_jacobian_cppad.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/cppad/jacobian.hpp>
+//
+# include <cmpad/algo/an_ode.hpp>
+# include <cmpad/algo/llsq_obj.hpp>
+//
+# include "check_jac_ode.hpp"
+# include "check_jac_llsq.hpp"
+
+bool xam_jacobian_cppad(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   cmpad::cppad::jacobian<cmpad::an_ode> jac_ode;
+   ok &= check_jac_ode(jac_ode);
+   //
+   // ok
+   cmpad::cppad::jacobian<cmpad::llsq_obj> jac_llsq;
+   ok &= check_jac_llsq(jac_llsq);
+   //
+   // ok
+   // an_ode has m == n so auto chooses forward mode,
+   // llsq_obj has m == 1 < n so auto chooses reverse mode.
+   jac_ode.set_mode("auto");
+   jac_ode.setup( jac_ode.option() );
+   ok &= jac_ode.mode() == "forward";
+   jac_llsq.set_mode("auto");
+   jac_llsq.setup( jac_llsq.option() );
+   ok &= jac_llsq.mode() == "reverse";
+   //
+   // ok
+   // a request other than auto is used as is
+   jac_llsq.set_mode("forward");
+   jac_llsq.setup( jac_llsq.option() );
+   ok &= jac_llsq.mode() == "forward";
+   //
+   return ok;
+}
+// END C++
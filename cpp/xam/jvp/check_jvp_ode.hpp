@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_JVP_CHECK_JVP_ODE_HPP
+# define XAM_JVP_CHECK_JVP_ODE_HPP
+/*
+{xrst_begin check_jvp_ode.hpp}
+{xrst_spell
+   jvp
+}
+
+C++ Check Jacobian Times Directions for an_ode
+##############################################
+
+Syntax
+******
+| |tab| ``# include "check_jvp_ode.hpp"``
+| |tab| *ok* = ``check_jvp_ode`` ( *jvp_ode* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+jvp_ode
+*******
+Is a :ref:`cpp_jvp-name` object that computes the
+Jacobian times directions for the :ref:`cpp_an_ode-name` algorithm.
+The number of directions is checked for
+one, for three, and for six.
+
+ok
+**
+is true (false) if the Jacobian times directions passes (fails) the test.
+
+Jacobian
+********
+see :ref:`check_jac_ode.hpp@Jacobian` .
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_jvp_ode.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class Jvp>
+bool check_jvp_ode( Jvp& jvp_ode )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // n_arg
+   size_t n_arg = 4;
+   //
+   // p
+   for(size_t p : { 1, 3, 6 } )
+   {  //
+      // time_setup
+      for(bool time_setup : { true, false } )
+      {  //
+         // option
+         cmpad::option_t option;
+         option.n_arg       = n_arg;
+         option.n_other     = 10;
+         option.time_setup  = time_setup;
+         option.n_direction = p;
+         //
+         // jvp_ode
+         jvp_ode.setup(option);
+         //
+         // ok
+         ok &= jvp_ode.domain() == n_arg * (1 + p);
+         ok &= jvp_ode.range()  == n_arg * p;
+         //
+         // xv
+         // note that x[j] = xv[j] != 0.0 so can divide by it
+         cmpad::vector<double> xv(n_arg * (1 + p));
+         cmpad::uniform_01(xv);
+         for(size_t j = 0; j < n_arg; ++j)
+            xv[j] += 1.0;
+         //
+         // Y
+         cmpad::vector<double> Y = jvp_ode(xv);
+         //
+         // y_i
+         double tf  = 2.0;
+         double y_i = xv[0] * tf;
+         for(size_t i = 0; i < n_arg; ++i)
+         {  if( i > 0 )
+               y_i = y_i * xv[i] * tf / double(i+1);
+            //
+            // ok
+            // J[i, j] = y_i / x[j] for j <= i and zero otherwise
+            for(size_t ell = 0; ell < p; ++ell)
+            {  double sum = 0.0;
+               for(size_t j = 0; j <= i; ++j)
+                  sum += y_i / xv[j] * xv[n_arg + j * p + ell];
+               ok &= near_equal( Y[i * p + ell], sum, rel_error );
+            }
+         }
+      }
+   }
+   return ok;
+}
+// END C++
+
+# endif
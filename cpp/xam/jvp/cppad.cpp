@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_jvp_cppad.cpp}
+
+Example and Test of Jacobian Times Directions Using cppad
+#########################################################
+
+check_jvp_ode
+*************
+see :ref:`check_jvp_ode.hpp-name`
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  xam_jvp_cppad.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/cppad/jvp.hpp>
+//
+# include <cmpad/algo/an_ode.hpp>
+//
+# include "check_jvp_ode.hpp"
+
+bool xam_jvp_cppad(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   cmpad::cppad::jvp<cmpad::an_ode> jvp_ode;
+   ok &= check_jvp_ode(jvp_ode);
+   //
+   return ok;
+}
+// END C++
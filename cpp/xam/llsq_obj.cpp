@@ -74,6 +74,25 @@ bool xam_llsq_obj(void)
    // ok
    ok &= cmpad::near_equal( y[0], check, rel_error );
    //
+   // data
+   // the default data is the sign of t_j
+   Vector data = llsq.data();
+   ok &= llsq.n_data() == option.n_other;
+   ok &= data[0] == -1.0 && data[option.n_other - 1] == 1.0;
+   //
+   // ok
+   // change the data to zero so the residuals are the model values
+   for(size_t j = 0; j < option.n_other; ++j)
+      data[j] = 0.0;
+   llsq.set_data(data);
+   sumsq = 0.0;
+   for(size_t j = 0; j < option.n_other; ++j)
+   {  double t_j = -1.0 + 2.0 * double(j) / double(option.n_other - 1);
+      double m_j = x[0] + x[1] * t_j + x[2] * t_j * t_j;
+      sumsq     += m_j * m_j;
+   }
+   ok &= cmpad::near_equal( llsq(x)[0], 0.5 * sumsq, rel_error );
+   //
    return ok;
 }
 
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin xam_pde_residual.cpp}
+
+Example and Test of pde_residual
+################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_pde_residual.cpp}
+*/
+// BEGIN C++
+# include <limits>
+# include <cmpad/algo/pde_residual.hpp>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+
+bool xam_pde_residual(void)
+{  // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 100. * std::numeric_limits<double>::epsilon();
+   //
+   // pde
+   typedef cmpad::vector<double> Vector;
+   cmpad::pde_residual<Vector>   pde;
+   //
+   // ell, n_arg
+   size_t ell   = 3;
+   size_t n_arg = ell * ell;
+   //
+   // pde.setup
+   cmpad::option_t option;
+   option.n_arg   = n_arg;
+   option.n_other = 0;
+   pde.setup(option);
+   //
+   // ok
+   ok &= pde.domain() == n_arg;
+   ok &= pde.range()  == n_arg;
+   //
+   // u
+   Vector u(n_arg);
+   cmpad::uniform_01(u);
+   //
+   // r
+   const Vector& r = pde(u);
+   //
+   // h2_inv
+   double h      = 1.0 / double(ell + 1);
+   double h2_inv = 1.0 / (h * h);
+   //
+   // ok
+   // the center grid point has no boundary neighbors
+   double laplace = 4.0 * u[4] - u[1] - u[3] - u[5] - u[7];
+   double check   = h2_inv * laplace + u[4] * u[4] - 1.0;
+   ok &= cmpad::near_equal( r[4], check, rel_error );
+   //
+   // ok
+   // the corner grid point (0, 0) has two boundary neighbors
+   laplace = 4.0 * u[0] - u[1] - u[3];
+   check   = h2_inv * laplace + u[0] * u[0] - 1.0;
+   ok &= cmpad::near_equal( r[0], check, rel_error );
+   //
+   // ok
+   // the edge grid point (2, 1) has one boundary neighbor
+   laplace = 4.0 * u[7] - u[4] - u[6] - u[8];
+   check   = h2_inv * laplace + u[7] * u[7] - 1.0;
+   ok &= cmpad::near_equal( r[7], check, rel_error );
+   //
+   return ok;
+}
+// END C++
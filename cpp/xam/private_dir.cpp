@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_private_dir.cpp}
+
+Example and Test of C++ private_dir
+###################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_private_dir.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/private_dir.hpp>
+# include <cmpad/vector.hpp>
+# include <fstream>
+# include <thread>
+
+bool xam_private_dir(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // path
+   using std::filesystem::path;
+   //
+   // dir_path
+   path dir_path;
+   {  //
+      // dir
+      cmpad::private_dir dir("xam_private_dir");
+      dir_path = dir.path();
+      //
+      // ok
+      ok &= dir_path.is_absolute();
+      ok &= std::filesystem::is_directory(dir_path);
+      ok &= std::filesystem::equivalent(
+         dir_path.parent_path(), std::filesystem::temp_directory_path()
+      );
+      //
+      // file_name
+      path file_name = dir_path / "file.txt";
+      std::ofstream ofs(file_name);
+      ofs << "private_dir\n";
+      ofs.close();
+      ok &= std::filesystem::exists(file_name);
+   }
+   //
+   // ok
+   // the directory, and the file in it, are removed by the destructor
+   ok &= ! std::filesystem::exists(dir_path);
+   //
+   // n_thread
+   size_t n_thread = 4;
+   //
+   // thread_path
+   // each thread creates its own directory
+   cmpad::vector<path> thread_path(n_thread);
+   cmpad::vector<cmpad::private_dir*> thread_dir(n_thread);
+   cmpad::vector<std::thread> thread(n_thread);
+   for(size_t t = 0; t < n_thread; ++t)
+   {  thread[t] = std::thread( [&thread_dir, &thread_path, t]()
+         {  thread_dir[t]  = new cmpad::private_dir("xam_private_dir");
+            thread_path[t] = thread_dir[t]->path();
+         }
+      );
+   }
+   for(size_t t = 0; t < n_thread; ++t)
+      thread[t].join();
+   //
+   // ok
+   for(size_t t = 0; t < n_thread; ++t)
+   {  ok &= std::filesystem::is_directory( thread_path[t] );
+      for(size_t s = 0; s < t; ++s)
+         ok &= thread_path[s] != thread_path[t];
+   }
+   //
+   // thread_dir
+   for(size_t t = 0; t < n_thread; ++t)
+   {  delete thread_dir[t];
+      ok &= ! std::filesystem::exists( thread_path[t] );
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin xam_rosen_obj.cpp}
+
+Example and Test of rosen_obj
+#############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_rosen_obj.cpp}
+*/
+// BEGIN C++
+# include <limits>
+# include <cmpad/algo/rosen_obj.hpp>
+# include <cmpad/near_equal.hpp>
+
+bool xam_rosen_obj(void)
+{  // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 100. * std::numeric_limits<double>::epsilon();
+   //
+   // rosen
+   typedef cmpad::vector<double> Vector;
+   cmpad::rosen_obj<Vector>      rosen;
+   //
+   // rosen.setup
+   cmpad::option_t option;
+   option.n_arg   = 3;
+   option.n_other = 0;
+   rosen.setup(option);
+   //
+   // ok
+   ok &= rosen.domain() == 3;
+   ok &= rosen.range()  == 1;
+   //
+   // ok
+   // the minimum value zero is attained when all the components are one
+   Vector x = { 1.0, 1.0, 1.0 };
+   const Vector& y = rosen(x);
+   ok &= y[0] == 0.0;
+   //
+   // ok
+   x = { 1.0, 2.0, 3.0 };
+   double check = 0.0;
+   check += 100.0 * (2.0 - 1.0) * (2.0 - 1.0) + (1.0 - 1.0) * (1.0 - 1.0);
+   check += 100.0 * (3.0 - 4.0) * (3.0 - 4.0) + (1.0 - 2.0) * (1.0 - 2.0);
+   ok &= cmpad::near_equal( rosen(x)[0], check, rel_error );
+   //
+   return ok;
+}
+// END C++
@@ -59,6 +59,14 @@ namespace {
          dy[i] = y[i-1];
       return dy;
    }
+   //
+   // fun_in_place
+   void fun_in_place(const cmpad::vector<double>& y, cmpad::vector<double>& dy)
+   {  size_t n = y.size();
+      dy[0] = 0.0;
+      for(size_t i = 1; i < n; ++i)
+         dy[i] = y[i-1];
+   }
 }
 
 bool xam_runge_kutta(void)
@@ -92,6 +100,19 @@ bool xam_runge_kutta(void)
       ok &= cmpad::near_equal( yf[i], 1.0 / factorial, rel_error );
    }
    //
+   // work, yf_in_place
+   // The in place version does not allocate memory once work has been
+   // sized; i.e., after the first call.
+   cmpad::runge_kutta_work< cmpad::vector<double> > work;
+   cmpad::vector<double> yf_in_place( yi.size() );
+   for(size_t i_call = 0; i_call < 2; ++i_call)
+   {  cmpad::runge_kutta(fun_in_place, yi, tf, ns, yf_in_place, work);
+      //
+      // ok
+      for(size_t i = 0; i < yi.size(); ++i)
+         ok &= yf_in_place[i] == yf[i];
+   }
+   //
    return ok;
 }
 // END C++
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_SPARSE_HESSIAN_CHECK_SPARSE_HES_ROSEN_HPP
+# define XAM_SPARSE_HESSIAN_CHECK_SPARSE_HES_ROSEN_HPP
+/*
+{xrst_begin check_sparse_hes_rosen.hpp}
+
+C++ Check Sparse Hessian of rosen_obj
+#####################################
+
+Syntax
+******
+| |tab| ``# include "check_sparse_hes_rosen.hpp"``
+| |tab| *ok* = ``check_sparse_hes_rosen`` ( *hes_rosen* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+hes_rosen
+*********
+Is a :ref:`cpp_sparse_hessian-name` object that computes the
+sparse Hessian for the :ref:`cpp_rosen_obj-name` algorithm.
+
+ok
+**
+is true (false) if the sparsity pattern and the Hessian
+pass (fail) the test.
+
+Sparsity Pattern
+****************
+The sparsity pattern must be the upper triangle of a tridiagonal matrix
+(in row major order); see :ref:`rosen_obj@Partially Separable` .
+
+Hessian
+*******
+see :ref:`rosen_obj@Derivative` .
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_sparse_hes_rosen.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class SparseHessian>
+bool check_sparse_hes_rosen( SparseHessian& hes_rosen )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // n_arg
+   size_t n_arg = 6;
+   //
+   // time_setup
+   for(bool time_setup : { true, false } )
+   {  //
+      // option
+      cmpad::option_t option;
+      option.n_arg      = n_arg;
+      option.n_other    = 0;
+      option.time_setup = time_setup;
+      //
+      // hes_rosen
+      hes_rosen.setup(option);
+      //
+      // row, col
+      const cmpad::vector<size_t>& row = hes_rosen.row();
+      const cmpad::vector<size_t>& col = hes_rosen.col();
+      //
+      // x
+      cmpad::vector<double> x(n_arg);
+      cmpad::uniform_01(x);
+      //
+      // H
+      cmpad::vector<double> H = hes_rosen(x);
+      //
+      // ok
+      ok &= row.size() == hes_rosen.range();
+      ok &= col.size() == hes_rosen.range();
+      ok &= H.size()   == hes_rosen.range();
+      ok &= H.size()   == 2 * n_arg - 1;
+      //
+      // k
+      size_t k = 0;
+      for(size_t r = 0; r < n_arg; ++r)
+      {  //
+         // check
+         // diagonal entry
+         double check = 0.0;
+         if( r > 0 )
+            check += 200.0;
+         if( r + 1 < n_arg )
+            check += 1200.0 * x[r] * x[r] - 400.0 * x[r+1] + 2.0;
+         //
+         // ok
+         if( k < H.size() )
+         {  ok &= row[k] == r;
+            ok &= col[k] == r;
+            ok &= near_equal(H[k], check, rel_error);
+         }
+         ++k;
+         //
+         // ok
+         // off diagonal entry
+         if( r + 1 < n_arg )
+         {  if( k < H.size() )
+            {  ok &= row[k] == r;
+               ok &= col[k] == r + 1;
+               ok &= near_equal(H[k], - 400.0 * x[r], rel_error);
+            }
+            ++k;
+         }
+      }
+      // ok
+      ok &= k == H.size();
+   }
+   return ok;
+}
+// END C++
+
+# endif
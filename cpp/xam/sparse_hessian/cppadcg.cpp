@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_sparse_hessian_cppadcg.cpp}
+
+Example and Test of Sparse Hessian Using cppadcg
+################################################
+
+check_sparse_hes_rosen
+**********************
+see :ref:`check_sparse_hes_rosen.hpp-name`
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  xam_sparse_hessian_cppadcg.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/cppadcg/sparse_hessian.hpp>
+//
+# include <cmpad/algo/rosen_obj.hpp>
+//
+# include "check_sparse_hes_rosen.hpp"
+
+bool xam_sparse_hessian_cppadcg(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   {  cmpad::cppadcg::sparse_hessian<cmpad::rosen_obj> hes_rosen;
+      ok &= check_sparse_hes_rosen(hes_rosen);
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_SPARSE_JACOBIAN_CHECK_SPARSE_JAC_PDE_HPP
+# define XAM_SPARSE_JACOBIAN_CHECK_SPARSE_JAC_PDE_HPP
+/*
+{xrst_begin check_sparse_jac_pde.hpp}
+
+C++ Check Sparse Jacobian of pde_residual
+#########################################
+
+Syntax
+******
+| |tab| ``# include "check_sparse_jac_pde.hpp"``
+| |tab| *ok* = ``check_sparse_jac_pde`` ( *jac_pde* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+jac_pde
+*******
+Is a :ref:`cpp_sparse_jacobian-name` object that computes the
+sparse Jacobian for the :ref:`cpp_pde_residual-name` algorithm.
+
+ok
+**
+is true (false) if the sparsity pattern and the Jacobian
+pass (fail) the test.
+
+Sparsity Pattern
+****************
+The sparsity pattern must be the five point stencil
+(in row major order); see :ref:`pde_residual@Sparsity` .
+
+Jacobian
+********
+see :ref:`pde_residual@Derivative` .
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_sparse_jac_pde.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class SparseJacobian>
+bool check_sparse_jac_pde( SparseJacobian& jac_pde )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // ell, n_arg
+   size_t ell   = 4;
+   size_t n_arg = ell * ell;
+   //
+   // h2_inv
+   double h      = 1.0 / double(ell + 1);
+   double h2_inv = 1.0 / (h * h);
+   //
+   // time_setup
+   for(bool time_setup : { true, false } )
+   {  //
+      // option
+      cmpad::option_t option;
+      option.n_arg      = n_arg;
+      option.n_other    = 0;
+      option.time_setup = time_setup;
+      //
+      // jac_pde
+      jac_pde.setup(option);
+      //
+      // row, col
+      const cmpad::vector<size_t>& row = jac_pde.row();
+      const cmpad::vector<size_t>& col = jac_pde.col();
+      //
+      // x
+      cmpad::vector<double> x(n_arg);
+      cmpad::uniform_01(x);
+      //
+      // J
+      cmpad::vector<double> J = jac_pde(x);
+      //
+      // ok
+      ok &= row.size() == jac_pde.range();
+      ok &= col.size() == jac_pde.range();
+      ok &= J.size()   == jac_pde.range();
+      //
+      // ok
+      // sparsity_time is nan when it is not computed separately
+      ok &= ! ( jac_pde.sparsity_time() < 0.0 );
+      //
+      // k
+      size_t k = 0;
+      for(size_t i = 0; i < ell; ++i)
+      {  for(size_t j = 0; j < ell; ++j)
+         {  //
+            // r
+            size_t r = i * ell + j;
+            //
+            // c_vec
+            // the stencil columns for this row in increasing order
+            cmpad::vector<size_t> c_vec;
+            if( i > 0 )
+               c_vec.push_back(r - ell);
+            if( j > 0 )
+               c_vec.push_back(r - 1);
+            c_vec.push_back(r);
+            if( j + 1 < ell )
+               c_vec.push_back(r + 1);
+            if( i + 1 < ell )
+               c_vec.push_back(r + ell);
+            //
+            // ok
+            for(size_t c : c_vec)
+            {  if( k < J.size() )
+               {  //
+                  // check
+                  double check = - h2_inv;
+                  if( c == r )
+                     check = 4.0 * h2_inv + 2.0 * x[r];
+                  //
+                  ok &= row[k] == r;
+                  ok &= col[k] == c;
+                  ok &= near_equal(J[k], check, rel_error);
+               }
+               ++k;
+            }
+         }
+      }
+      // ok
+      ok &= k == J.size();
+   }
+   return ok;
+}
+// END C++
+
+# endif
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_sparse_jacobian_cppad.cpp}
+
+Example and Test of Sparse Jacobian Using cppad
+###############################################
+
+check_sparse_jac_pde
+********************
+see :ref:`check_sparse_jac_pde.hpp-name`
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  xam_sparse_jacobian_cppad.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/cppad/sparse_jacobian.hpp>
+//
+# include <cmpad/algo/pde_residual.hpp>
+//
+# include "check_sparse_jac_pde.hpp"
+
+bool xam_sparse_jacobian_cppad(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   cmpad::cppad::sparse_jacobian<cmpad::pde_residual> jac_pde;
+   ok &= check_sparse_jac_pde(jac_pde);
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_sparse_jacobian_cppadcg.cpp}
+
+Example and Test of Sparse Jacobian Using cppadcg
+#################################################
+
+check_sparse_jac_pde
+********************
+see :ref:`check_sparse_jac_pde.hpp-name`
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  xam_sparse_jacobian_cppadcg.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/cppadcg/sparse_jacobian.hpp>
+//
+# include <cmpad/algo/pde_residual.hpp>
+//
+# include "check_sparse_jac_pde.hpp"
+
+bool xam_sparse_jacobian_cppadcg(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   {  cmpad::cppadcg::sparse_jacobian<cmpad::pde_residual> jac_pde;
+      ok &= check_sparse_jac_pde(jac_pde);
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_tiered_gradient.cpp}
+
+Example and Test of tiered_gradient
+###################################
+This example does not require an AD package.
+It uses a simple forward mode (dual number) gradient for the
+interpreted gradient.
+The compiled gradient is the same except that its setup does not
+finish until this example allows it to.
+
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_tiered_gradient.cpp}
+*/
+// BEGIN C++
+# include <atomic>
+# include <cstddef>
+# include <limits>
+# include <thread>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/tiered_gradient.hpp>
+# include <cmpad/algo/rosen_obj.hpp>
+
+namespace {
+   //
+   // dual
+   // value and derivative in one direction
+   struct dual {
+      double v, d;
+      dual(double value = 0.0) : v(value), d(0.0)
+      { }
+   };
+   dual operator+(const dual& a, const dual& b)
+   {  dual c; c.v = a.v + b.v; c.d = a.d + b.d; return c; }
+   dual operator-(const dual& a, const dual& b)
+   {  dual c; c.v = a.v - b.v; c.d = a.d - b.d; return c; }
+   dual operator*(const dual& a, const dual& b)
+   {  dual c; c.v = a.v * b.v; c.d = a.d * b.v + a.v * b.d; return c; }
+   dual& operator+=(dual& a, const dual& b)
+   {  a = a + b; return a; }
+   //
+   // dual_gradient
+   // a gradient that uses one forward pass for each argument component
+   template < template<class ADVector> class Algo> class dual_gradient
+   : public cmpad::gradient
+   {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // algo_
+      Algo< cmpad::vector<dual> > algo_;
+      //
+      // ax_, g_
+      cmpad::vector<dual>   ax_;
+      cmpad::vector<double> g_;
+   public:
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_; }
+      //
+      // domain
+      size_t domain(void) const override
+      {  return algo_.domain(); }
+      //
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         algo_.setup(option);
+         ax_.resize( algo_.domain() );
+         g_.resize( algo_.domain() );
+      }
+      //
+      // operator
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  size_t n = algo_.domain();
+         size_t m = algo_.range();
+         for(size_t j = 0; j < n; ++j)
+            ax_[j] = dual( x[j] );
+         for(size_t j = 0; j < n; ++j)
+         {  ax_[j].d = 1.0;
+            g_[j]    = algo_(ax_)[m-1].d;
+            ax_[j].d = 0.0;
+         }
+         return g_;
+      }
+   };
+   //
+   // compile_done
+   // the slow_gradient setup waits until this is true
+   std::atomic<bool> compile_done(false);
+   //
+   // slow_gradient
+   // a dual_gradient with a setup that simulates a long compile
+   template < template<class ADVector> class Algo> class slow_gradient
+   : public dual_gradient<Algo>
+   {
+   public:
+      void setup(const cmpad::option_t& option) override
+      {  while( ! compile_done )
+            std::this_thread::yield();
+         dual_gradient<Algo>::setup(option);
+      }
+   };
+}
+
+bool xam_tiered_gradient(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 100. * std::numeric_limits<double>::epsilon();
+   //
+   // n_arg
+   size_t n_arg = 5;
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg   = n_arg;
+   option.n_other = 0;
+   //
+   // check
+   // evaluates the gradient in this thread
+   dual_gradient<cmpad::rosen_obj> check;
+   check.setup(option);
+   //
+   // grad
+   cmpad::tiered_gradient<dual_gradient, slow_gradient, cmpad::rosen_obj> grad;
+   //
+   // setup
+   // the second setup waits for the first background thread to finish
+   for(size_t i_setup = 0; i_setup < 2; ++i_setup)
+   {  //
+      // grad
+      compile_done = false;
+      grad.setup(option);
+      ok &= grad.domain() == n_arg;
+      ok &= grad.range()  == n_arg;
+      //
+      // x
+      cmpad::vector<double> x(n_arg);
+      //
+      // ok
+      // the compiled gradient is not ready so the interpreted one is used
+      for(size_t k = 0; k < 3; ++k)
+      {  cmpad::uniform_01(x);
+         const cmpad::vector<double>& g = grad(x);
+         const cmpad::vector<double>& c = check(x);
+         for(size_t j = 0; j < n_arg; ++j)
+            ok &= cmpad::near_equal( g[j], c[j], rel_error );
+         ok &= ! grad.compiled();
+      }
+      ok &= grad.n_interpreted() == 3;
+      //
+      // grad
+      compile_done = true;
+      if( i_setup == 0 )
+         grad.wait();
+      else
+      {  while( ! grad.compiled() )
+            grad(x);
+      }
+      //
+      // ok
+      // the compiled gradient is used
+      size_t n_interpreted = grad.n_interpreted();
+      cmpad::uniform_01(x);
+      const cmpad::vector<double>& g = grad(x);
+      const cmpad::vector<double>& c = check(x);
+      for(size_t j = 0; j < n_arg; ++j)
+         ok &= cmpad::near_equal( g[j], c[j], rel_error );
+      ok &= grad.compiled();
+      ok &= grad.n_interpreted() == n_interpreted;
+   }
+   //
+   return ok;
+}
+// END C++
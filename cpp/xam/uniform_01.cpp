@@ -1,9 +1,12 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2023 Bradley M. Bell
+// SPDX-FileContributor: 2023-24 Bradley M. Bell
 // ---------------------------------------------------------------------------
 /*
 {xrst_begin xam_uniform_01.cpp}
+{xrst_spell
+   rng
+}
 
 Example and Test of uniform_01
 ##############################
@@ -15,7 +18,6 @@ Example and Test of uniform_01
 {xrst_end xam_uniform_01.cpp}
 */
 // BEGIN C++
-# include <ctime>
 # include <cmpad/uniform_01.hpp>
 
 bool xam_uniform_01(void)
@@ -24,13 +26,13 @@ bool xam_uniform_01(void)
    bool ok = true;
    //
    // seed
-   unsigned int seed = static_cast<unsigned int>( std::time(nullptr) );
+   uint64_t seed = 123;
    //
-   // srand
-   std::srand(seed);
+   // uniform_01_seed
+   cmpad::uniform_01_seed(seed);
    //
    // n, x
-   size_t n = 10;
+   size_t n = 11;
    cmpad::vector<double> x(n);
    for(size_t i = 0; i < n; ++i)
       x[i] = -1;
@@ -42,6 +44,34 @@ bool xam_uniform_01(void)
    for(size_t i = 0; i < n; ++i)
       ok &= 0.0 <= x[i] && x[i] <= 1.0;
    //
+   // rng
+   // same seed and stream as the default generator above
+   cmpad::uniform_01_t rng(seed);
+   //
+   // ok
+   // the sequence does not depend on how it is split between calls
+   cmpad::vector<double> y(3), z(n - 3);
+   rng(y);
+   rng(z);
+   for(size_t i = 0; i < 3; ++i)
+      ok &= y[i] == x[i];
+   for(size_t i = 3; i < n; ++i)
+      ok &= z[i-3] == x[i];
+   //
+   // ok
+   // a different stream gives different values
+   rng.seed(seed, 1);
+   rng(z);
+   for(size_t i = 3; i < n; ++i)
+      ok &= z[i-3] != x[i-3];
+   //
+   // ok
+   // restarting the stream repeats the values
+   rng.seed(seed);
+   rng(y);
+   for(size_t i = 0; i < 3; ++i)
+      ok &= y[i] == x[i];
+   //
    return ok;
 }
 // END C++
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef XAM_VJP_CHECK_VJP_ODE_HPP
+# define XAM_VJP_CHECK_VJP_ODE_HPP
+/*
+{xrst_begin check_vjp_ode.hpp}
+{xrst_spell
+   vjp
+}
+
+C++ Check Weights Times Jacobian for an_ode
+###########################################
+
+Syntax
+******
+| |tab| ``# include "check_vjp_ode.hpp"``
+| |tab| *ok* = ``check_vjp_ode`` ( *vjp_ode* )
+
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+vjp_ode
+*******
+Is a :ref:`cpp_vjp-name` object that computes the
+weight vectors times the Jacobian for the :ref:`cpp_an_ode-name` algorithm.
+The number of weight vectors is checked for
+one, for three, and for six.
+
+ok
+**
+is true (false) if the weights times Jacobian passes (fails) the test.
+
+Jacobian
+********
+see :ref:`check_jac_ode.hpp@Jacobian` .
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  check_vjp_ode.hpp}
+*/
+// BEGIN C++
+# include <cmpad/uniform_01.hpp>
+# include <cmpad/near_equal.hpp>
+
+// BEGIN PROTOTYPE
+template <class Vjp>
+bool check_vjp_ode( Vjp& vjp_ode )
+// END PROTOTYPE
+{  //
+   // ok
+   bool ok = true;
+   //
+   // rel_error
+   double rel_error = 500. * std::numeric_limits<double>::epsilon();
+   //
+   // near_equal
+   using cmpad::near_equal;
+   //
+   // n_arg
+   // for an_ode the domain and range dimensions are both n_arg
+   size_t n_arg = 4;
+   //
+   // q
+   for(size_t q : { 1, 3, 6 } )
+   {  //
+      // time_setup
+      for(bool time_setup : { true, false } )
+      {  //
+         // option
+         cmpad::option_t option;
+         option.n_arg       = n_arg;
+         option.n_other     = 10;
+         option.time_setup  = time_setup;
+         option.n_direction = q;
+         //
+         // vjp_ode
+         vjp_ode.setup(option);
+         //
+         // ok
+         ok &= vjp_ode.domain() == n_arg + q * n_arg;
+         ok &= vjp_ode.range()  == q * n_arg;
+         //
+         // xw
+         // note that x[j] = xw[j] != 0.0 so can divide by it
+         cmpad::vector<double> xw(n_arg + q * n_arg);
+         cmpad::uniform_01(xw);
+         for(size_t j = 0; j < n_arg; ++j)
+            xw[j] += 1.0;
+         //
+         // Z
+         cmpad::vector<double> Z = vjp_ode(xw);
+         //
+         // y
+         double tf  = 2.0;
+         cmpad::vector<double> y(n_arg);
+         y[0] = xw[0] * tf;
+         for(size_t i = 1; i < n_arg; ++i)
+            y[i] = y[i-1] * xw[i] * tf / double(i+1);
+         //
+         // ok
+         // J[i, j] = y[i] / x[j] for j <= i and zero otherwise
+         for(size_t k = 0; k < q; ++k)
+         {  for(size_t j = 0; j < n_arg; ++j)
+            {  double sum = 0.0;
+               for(size_t i = j; i < n_arg; ++i)
+                  sum += xw[n_arg + k * n_arg + i] * y[i] / xw[j];
+               ok &= near_equal( Z[k * n_arg + j], sum, rel_error );
+            }
+         }
+      }
+   }
+   return ok;
+}
+// END C++
+
+# endif
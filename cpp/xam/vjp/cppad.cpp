@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2024 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_vjp_cppad.cpp}
+
+Example and Test of Weights Times Jacobian Using cppad
+######################################################
+
+check_vjp_ode
+*************
+see :ref:`check_vjp_ode.hpp-name`
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end  xam_vjp_cppad.cpp}
+*/
+// BEGIN C++
+# include <cmpad/configure.hpp>
+# include <cmpad/cppad/vjp.hpp>
+//
+# include <cmpad/algo/an_ode.hpp>
+//
+# include "check_vjp_ode.hpp"
+
+bool xam_vjp_cppad(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   cmpad::cppad::vjp<cmpad::an_ode> vjp_ode;
+   ok &= check_vjp_ode(vjp_ode);
+   //
+   return ok;
+}
+// END C++
@@ -76,6 +76,10 @@ import cmpad
 def none_fun_obj(algorithm) :
    if algorithm == 'det_by_minor' :
       return cmpad.det_by_minor()
+   elif algorithm == 'det_by_lu' :
+      return cmpad.det_by_lu()
+   elif algorithm == 'det_by_memo' :
+      return cmpad.det_by_memo()
    elif algorithm == 'an_ode' :
       return cmpad.an_ode(numpy)
    elif algorithm == 'llsq_obj' :
@@ -109,6 +113,10 @@ def grad_fun_obj(algorithm, package) :
    # algo
    if algorithm == 'det_by_minor' :
       algo = cmpad.det_by_minor()
+   elif algorithm == 'det_by_lu' :
+      algo = cmpad.det_by_lu()
+   elif algorithm == 'det_by_memo' :
+      algo = cmpad.det_by_memo()
    elif algorithm == 'an_ode' :
       algo = cmpad.an_ode(like_numpy)
    elif algorithm == 'llsq_obj' :
@@ -138,7 +146,8 @@ def main() :
    # --algorithm
    parser.add_argument('-a', '--algorithm',
       metavar='algorithm', default='det_by_minor',
-      help = 'is det_by_minor, an_ode, or llsq_obj [det_by_minor]'
+      help = 'is det_by_minor, det_by_lu, det_by_memo, an_ode, or llsq_obj ' +
+         '[det_by_minor]'
    )
    # --file_name
    parser.add_argument('-f', '--file_name',
@@ -165,6 +174,11 @@ def main() :
       metavar='package', default='none',
       help = 'none or an AD package name'
    )
+   # --seed
+   parser.add_argument('-s', '--seed',
+      metavar='seed', default='0',
+      help = 'seed used to generate the argument values [0]'
+   )
    # --time_setup
    parser.add_argument('-t', '--time_setup', action='store_true',
       help = 'if present, include setup time in speed tests'
@@ -193,22 +207,28 @@ def main() :
    #
    # algorithm
    algorithm = arguments.algorithm
-   if algorithm not in [ 'det_by_minor', 'an_ode', 'llsq_obj' ] :
+   algorithm_list = [
+      'det_by_minor', 'det_by_lu', 'det_by_memo', 'an_ode', 'llsq_obj'
+   ]
+   if algorithm not in algorithm_list :
       msg = f'{program}: algorithm = {algorithm} is not available'
       sys.exit(msg)
    #
    # n_other
    n_other = int( arguments.n_other )
-   if algorithm == 'det_by_minor' and n_other != 0 :
+   if algorithm in [ 'det_by_minor', 'det_by_memo' ] and n_other != 0 :
       msg = f'{program}: algorithm = {algorithm}: n_other is not zero'
       sys.exit(msg)
+   if algorithm == 'det_by_lu' and n_other not in [ 0, 1 ] :
+      msg = f'{program}: algorithm = {algorithm}: n_other is not zero or one'
+      sys.exit(msg)
    if algorithm == 'an_ode' and n_other <= 0 :
       msg = f'{program}: algorithm = {algorithm}: n_other is <= zero'
       sys.exit(msg)
    #
    # n_arg
    n_arg = int( arguments.n_arg )
-   if algorithm == 'det_by_minor' :
+   if algorithm in [ 'det_by_minor', 'det_by_lu', 'det_by_memo' ] :
       ell = int( math.sqrt( n_arg ) )
       if ell * ell != n_arg :
          msg  = f'{program}: algorithm = {algorithm}: '
@@ -225,11 +245,15 @@ def main() :
    # time_setup
    time_setup = arguments.time_setup
    #
+   # seed
+   seed = int( arguments.seed )
+   #
    # option
    option = {
       'n_arg'      : n_arg      ,
       'n_other'    : n_other    ,
       'time_setup' : time_setup ,
+      'seed'       : seed       ,
    }
    #
    # csv_speed
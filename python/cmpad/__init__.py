@@ -9,6 +9,8 @@
 # BEGIN_SORT_THIS_LINE_PLUS_1
 from .an_ode         import an_ode
 from .csv_speed      import csv_speed
+from .det_by_lu      import det_by_lu
+from .det_by_memo    import det_by_memo
 from .det_by_minor   import det_by_minor
 from .det_of_minor   import det_of_minor
 from .fun_speed      import fun_speed
@@ -28,6 +28,11 @@ This file uses the :ref:`csv_column-name` format.
       END HEADER_LINE
    }
 
+#. If the file is not empty on input, its first line must be the header
+   above. Otherwise, it was created by a different version of cmpad
+   and an error message is printed and the program exits
+   (so that rows with different columns are not mixed in one file).
+
 #. A line is added to this file corresponding to
    this call to csv_speed.
 
@@ -66,6 +71,61 @@ time_setup
 ==========
 see :ref:`csv_column@time_setup`
 
+n_checkpoint
+============
+see :ref:`csv_column@n_checkpoint` .
+This key is optional and its default value is the empty string
+(checkpointing is not used).
+
+n_batch
+=======
+see :ref:`csv_column@n_batch` .
+This key is optional and its default value is one.
+
+n_thread
+========
+see :ref:`csv_column@n_thread` .
+This key is optional and its default value is one.
+
+n_direction
+===========
+see :ref:`csv_column@n_direction` .
+This key is optional and its default value is one.
+
+jit_load
+========
+see :ref:`csv_column@jit_load` .
+This key is optional and its default value is ``file`` .
+
+n_split
+=======
+see :ref:`csv_column@n_split` .
+This key is optional and its default value is one.
+
+jit_flags
+=========
+see :ref:`csv_column@jit_flags` .
+This key is optional and its default value is the empty string.
+
+tape_load
+=========
+see :ref:`csv_column@tape_load` .
+This key is optional and its default value is ``record`` .
+
+data_mode
+=========
+see :ref:`csv_column@data_mode` .
+This key is optional and its default value is ``constant`` .
+
+rel_error
+*********
+see :ref:`csv_column@rel_error` .
+If *rel_error* is None, the corresponding csv column is empty.
+
+derivative
+**********
+The :ref:`csv_column@derivative` column is empty if *package* is ``none``
+and ``gradient`` otherwise.
 
 {xrst_toc_hidden
    python/xam/csv_speed.py
@@ -87,7 +147,8 @@ bool_str = { True : 'true' , False : 'false' }
 #
 # BEGIN DEF
 def csv_speed(
-   file_name, rate, min_time, package, algorithm, special, option
+   file_name, rate, min_time, package, algorithm, special, option,
+   rel_error = None
    ) :
    assert type(file_name) == str
    assert type(rate)      == float
@@ -96,6 +157,7 @@ def csv_speed(
    assert type(algorithm) == str
    assert type(special)   == bool
    assert type(option)    == dict
+   assert rel_error == None or type(rel_error) == float
    #
    assert package in [ 'none', 'autograd', 'cppad_py', 'jax', 'torch' ]
    #
@@ -117,7 +179,18 @@ def csv_speed(
       'compiler',
       'debug',
       'language',
-      'special'
+      'special',
+      'rel_error',
+      'n_checkpoint',
+      'derivative',
+      'n_batch',
+      'n_thread',
+      'n_direction',
+      'jit_load',
+      'n_split',
+      'jit_flags',
+      'tape_load',
+      'data_mode'
    ]
    #
    # csv_table
@@ -128,6 +201,11 @@ def csv_speed(
       for row in reader :
          csv_table.append(row)
       file_obj.close()
+      if reader.fieldnames != None and reader.fieldnames != filednames :
+         msg  = f'csv_speed.py: the header in {file_name}\n'
+         msg += 'does not match the columns for this version of cmpad.\n'
+         msg += 'Remove the file or use a different file name.'
+         sys.exit(msg)
    #
    # date
    date = datetime.date.today().strftime('%Y-%m-%d')
@@ -145,6 +223,19 @@ def csv_speed(
          msg += 'does not end with /build/debug or /build/release'
          assert False, msg
    #
+   # derivative
+   # there is no derivative for package none
+   if package == 'none' :
+      derivative = ''
+   else :
+      derivative = 'gradient'
+   #
+   # rel_error_str
+   if rel_error == None :
+      rel_error_str = ''
+   else :
+      rel_error_str = '{:.1e}'.format(rel_error)
+   #
    # compiler
    compiler = platform.python_implementation()+'-'+platform.python_version()
    #
@@ -160,7 +251,18 @@ def csv_speed(
       'compiler'   : compiler,
       'debug'      : debug,
       'language'   : 'python',
-      'special'    : bool_str[special]
+      'special'    : bool_str[special],
+      'rel_error'  : rel_error_str,
+      'n_checkpoint' : option.get('n_checkpoint', ''),
+      'derivative' : derivative,
+      'n_batch'    : option.get('n_batch', 1),
+      'n_thread'   : option.get('n_thread', 1),
+      'n_direction' : option.get('n_direction', 1),
+      'jit_load'   : option.get('jit_load', 'file'),
+      'n_split'    : option.get('n_split', 1),
+      'jit_flags'  : option.get('jit_flags', ''),
+      'tape_load'  : option.get('tape_load', 'record'),
+      'data_mode'  : option.get('data_mode', 'constant')
    }
    #
    csv_table.append(row)
@@ -0,0 +1,185 @@
+# SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+# SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+# SPDX-FileContributor: 2024 Bradley M. Bell
+# ---------------------------------------------------------------------------
+r'''
+{xrst_begin_parent py_det_by_lu}
+
+Python Determinant Using LU Factorization
+#########################################
+
+Syntax
+******
+| |tab| *det* = ``cmpad.det_by_lu()``
+| |tab| *det* . ``setup`` ( *option* )
+| |tab| *y* = *det* ( *x* )
+
+Prototype
+*********
+{xrst_literal
+   # BEGIN PROTOTYPE
+   # END PROTOTYPE
+}
+
+Algorithm
+*********
+This is a Python implementation of the
+det_by_lu :ref:`det_by_lu@Algorithm` .
+
+Scalar
+******
+We use *Scalar* for the type of the elements of *x* and *y*.
+
+det
+***
+The :ref:`py_fun_obj-name` *det* computes the determinant of a square matrix.
+
+ell
+***
+see :ref:`det_by_lu@ell` .
+
+n_arg
+*****
+see :ref:`det_by_lu@option@n_arg` .
+
+n_other
+=======
+see :ref:`det_by_lu@option@n_other` .
+
+x
+*
+The argument *x* has size *n_arg* = :math:`\ell * \ell` .
+The elements of the matrix :math:`A(x)` is defined as follows:
+for :math:`i = 0 , \ldots , \ell-1` and :math:`j = 0 , \ldots , \ell-1`, by
+
+.. math::
+
+   A(x)_{i,j} = x[ i * \ell + j]
+
+y
+*
+The return value *y* has length one and its element
+is equal to the determinant of :math:`A(x)`.
+
+{xrst_toc_hidden after
+   python/xam/det_by_lu.py
+}
+
+Example
+*******
+The file
+:ref:`xam_det_by_lu.py-name`
+contains an example and test of ``det_by_lu`` .
+
+Source Code
+***********
+:ref:`det_by_lu.py-name` displays the source code for this algorithm.
+
+{xrst_end py_det_by_lu}
+---------------------------------------------------------------------------
+{xrst_begin det_by_lu.py}
+
+Python det_by_lu: Source Code
+#############################
+{xrst_literal
+   # BEGIN PYTHON
+   # END PYTHON
+}
+
+{xrst_end det_by_lu.py}
+---------------------------------------------------------------------------
+'''
+# BEGIN PYTHON
+import math
+# BEGIN PROTOTYPE
+class det_by_lu :
+   #
+   def option(self) :
+      return self.option
+   #
+   def domain(self) :
+      return self.option['n_arg']
+   #
+   def range(self) :
+      return 1
+   #
+   def setup(self, option) :
+      assert type(option) == dict
+      assert type( option['n_arg'] ) == int
+      assert type( option['n_other'] ) == int
+      assert option['n_arg'] > 0
+      assert option['n_other'] in [ 0, 1 ]
+      # END PROTOTYPE
+      #
+      # option
+      self.option = option
+      #
+      # self.ell
+      ell = int( math.sqrt( option['n_arg'] ) )
+      if( ell * ell < option['n_arg'] ) :
+         ell += 1
+      assert ell * ell == option['n_arg']
+      self.ell = ell
+      #
+      # self.pivot
+      self.pivot = option['n_other'] == 1
+   #
+   # call
+   def __call__(self, x) :
+      #
+      # ell
+      ell = self.ell
+      #
+      # a
+      # work space that holds the matrix during the elimination
+      a = [ x[k] for k in range(ell * ell) ]
+      #
+      # row
+      # row[i] is the row of a that currently corresponds to row i
+      row = list( range(ell) )
+      #
+      # negate
+      # is the permutation corresponding to row odd
+      negate = False
+      #
+      # det
+      det = 1.0
+      #
+      # k
+      for k in range(ell) :
+         #
+         # row, negate
+         if self.pivot :
+            # compare squares so that only operations that every
+            # scalar type supports are used
+            p      = k
+            a_kk   = a[ row[k] * ell + k ]
+            max_sq = a_kk * a_kk
+            for i in range(k + 1, ell) :
+               a_ik = a[ row[i] * ell + k ]
+               sq   = a_ik * a_ik
+               if max_sq < sq :
+                  p      = i
+                  max_sq = sq
+            if p != k :
+               row[k], row[p] = row[p], row[k]
+               negate         = not negate
+         #
+         # det
+         rk   = row[k] * ell
+         a_kk = a[rk + k]
+         det  = det * a_kk
+         #
+         # a
+         # eliminate column k below the diagonal
+         for i in range(k + 1, ell) :
+            ri     = row[i] * ell
+            factor = a[ri + k] / a_kk
+            for j in range(k + 1, ell) :
+               a[ri + j] = a[ri + j] - factor * a[rk + j]
+      #
+      if negate :
+         det = - det
+      return [ det ]
+
+# END PYTHON
@@ -0,0 +1,168 @@
+# SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+# SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+# SPDX-FileContributor: 2024 Bradley M. Bell
+# ---------------------------------------------------------------------------
+r'''
+{xrst_begin_parent py_det_by_memo}
+{xrst_spell
+   memoized
+}
+
+Python Determinant Using Memoized Expansion by Minors
+#####################################################
+
+Syntax
+******
+| |tab| *det* = ``cmpad.det_by_memo()``
+| |tab| *det* . ``setup`` ( *option* )
+| |tab| *y* = *det* ( *x* )
+
+Prototype
+*********
+{xrst_literal
+   # BEGIN PROTOTYPE
+   # END PROTOTYPE
+}
+
+Algorithm
+*********
+This is a Python implementation of the
+det_by_memo :ref:`det_by_memo@Algorithm` .
+
+Scalar
+******
+We use *Scalar* for the type of the elements of *x* and *y*.
+
+det
+***
+The :ref:`py_fun_obj-name` *det* computes the determinant of a square matrix.
+
+ell
+***
+see :ref:`det_by_memo@ell` .
+
+n_arg
+*****
+see :ref:`det_by_memo@option@n_arg` .
+
+n_other
+=======
+see :ref:`det_by_memo@option@n_other` .
+
+x
+*
+The argument *x* has size *n_arg* = :math:`\ell * \ell` .
+The elements of the matrix :math:`A(x)` is defined as follows:
+for :math:`i = 0 , \ldots , \ell-1` and :math:`j = 0 , \ldots , \ell-1`, by
+
+.. math::
+
+   A(x)_{i,j} = x[ i * \ell + j]
+
+y
+*
+The return value *y* has length one and its element
+is equal to the determinant of :math:`A(x)`.
+
+{xrst_toc_hidden after
+   python/xam/det_by_memo.py
+}
+
+Example
+*******
+The file
+:ref:`xam_det_by_memo.py-name`
+contains an example and test of ``det_by_memo`` .
+
+Source Code
+***********
+:ref:`det_by_memo.py-name` displays the source code for this algorithm.
+
+{xrst_end py_det_by_memo}
+---------------------------------------------------------------------------
+{xrst_begin det_by_memo.py}
+
+Python det_by_memo: Source Code
+###############################
+{xrst_literal
+   # BEGIN PYTHON
+   # END PYTHON
+}
+
+{xrst_end det_by_memo.py}
+---------------------------------------------------------------------------
+'''
+# BEGIN PYTHON
+import math
+# BEGIN PROTOTYPE
+class det_by_memo :
+   #
+   def option(self) :
+      return self.option
+   #
+   def domain(self) :
+      return self.option['n_arg']
+   #
+   def range(self) :
+      return 1
+   #
+   def setup(self, option) :
+      assert type(option) == dict
+      assert type( option['n_arg'] ) == int
+      assert type( option['n_other'] ) == int
+      assert option['n_arg'] > 0
+      assert option['n_other'] == 0
+      # END PROTOTYPE
+      #
+      # option
+      self.option = option
+      #
+      # self.ell
+      ell = int( math.sqrt( option['n_arg'] ) )
+      if( ell * ell < option['n_arg'] ) :
+         ell += 1
+      assert ell * ell == option['n_arg']
+      self.ell = ell
+   #
+   # call
+   def __call__(self, x) :
+      #
+      # ell, n_mask
+      ell    = self.ell
+      n_mask = 2 ** ell
+      #
+      # memo
+      # memo[mask] is the determinant of the minor with the last
+      # k rows and the columns in mask, where k is the number of bits in mask.
+      # The determinant of the empty minor is one.
+      memo    = n_mask * [ None ]
+      memo[0] = 1.0
+      #
+      # mask
+      # mask with bit j removed is less than mask, so its determinant
+      # has already been computed.
+      for mask in range(1, n_mask) :
+         #
+         # k, i
+         # the minor has k columns and uses rows i, ..., ell-1
+         k = bin(mask).count('1')
+         i = ell - k
+         #
+         # memo[mask]
+         # expand along the first row of the minor
+         detM = 0.0
+         sign = 1
+         for j in range(ell) :
+            bit = 2 ** j
+            if mask & bit :
+               term = x[ i * ell + j ] * memo[mask ^ bit]
+               if sign > 0 :
+                  detM = detM + term
+               else :
+                  detM = detM - term
+               sign = - sign
+         memo[mask] = detM
+      #
+      return [ memo[n_mask - 1] ]
+
+# END PYTHON
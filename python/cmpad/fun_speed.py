@@ -45,6 +45,12 @@ included in the time for each function evaluation.
 If the setup time is not included, the only thing that changes
 between function evaluations is the argument vector *x* .
 
+seed
+====
+If *option*\ ``['seed']`` is present, it is the seed used to generate
+the argument vectors *x* .
+Otherwise, a different seed is used each time ``fun_speed`` is called.
+
 min_time
 ********
 This is the minimum time in seconds for the timing of the computation.
@@ -77,7 +83,7 @@ def fun_speed(fun_obj, option, min_time) :
    # END DEF
    #
    # rng
-   rng = numpy.random.default_rng()
+   rng = numpy.random.default_rng( option.get('seed') )
    #
    # fun_obj.setup
    fun_obj.setup(option)
@@ -96,7 +96,18 @@ def xam_csv_speed() :
       'compiler',
       'debug',
       'language',
-      'special'
+      'special',
+      'rel_error',
+      'n_checkpoint',
+      'derivative',
+      'n_batch',
+      'n_thread',
+      'n_direction',
+      'jit_load',
+      'n_split',
+      'jit_flags',
+      'tape_load',
+      'data_mode'
    ]
    ok = list( csv_table[0].keys() ) == col_names
    #
@@ -113,6 +124,17 @@ def xam_csv_speed() :
    ok &= row['compiler']                == compiler
    ok &= row['language']                == 'python'
    ok &= row['special']                 == 'false'
+   ok &= row['rel_error']               == ''
+   ok &= row['n_checkpoint']            == ''
+   ok &= row['derivative']              == ''
+   ok &= int( row['n_batch'] )          == 1
+   ok &= int( row['n_thread'] )         == 1
+   ok &= int( row['n_direction'] )      == 1
+   ok &= row['jit_load']                == 'file'
+   ok &= int( row['n_split'] )          == 1
+   ok &= row['jit_flags']               == ''
+   ok &= row['tape_load']               == 'record'
+   ok &= row['data_mode']               == 'constant'
    #
    return ok
 #
@@ -0,0 +1,79 @@
+# SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+# SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+# SPDX-FileContributor: 2024 Bradley M. Bell
+# ---------------------------------------------------------------------------
+r'''
+{xrst_begin xam_det_by_lu.py}
+
+Python Example and Test of det_by_lu
+####################################
+
+{xrst_literal
+   # BEGIN PYTHON
+   # END PYTHON
+}
+
+{xrst_end xam_det_by_lu.py}
+'''
+# BEGIN PYTHON
+import cmpad
+import numpy
+#
+# xam_det_by_lu
+def xam_det_by_lu() :
+   #
+   # ok
+   ok = True
+   #
+   # rel_error
+   rel_error = 10. * numpy.finfo(float).eps
+   #
+   # ell
+   # dimension of the matrix
+   ell = 3;
+   #
+   # det
+   det = cmpad.det_by_lu()
+   #
+   # x
+   x = [
+      1., 2., 3., # x[0] x[1] x[2]
+      3., 2., 1., # x[3] x[4] x[5]
+      2., 1., 2.  # x[6] x[7] x[8]
+   ]
+   ok &= len(x) == ell * ell
+   #
+   # check
+   check = \
+      + x[0]*(x[4]*x[8] - x[5]*x[7]) \
+      - x[1]*(x[3]*x[8] - x[5]*x[6]) \
+      + x[2]*(x[3]*x[7] - x[4]*x[6])
+   #
+   # n_other
+   # without and with partial pivoting
+   for n_other in [ 0, 1 ] :
+      #
+      # det.setup
+      option = { 'n_arg' : ell * ell , 'n_other' : n_other }
+      det.setup(option)
+      #
+      # ok
+      y   = det(x)
+      ok &= len(y) == 1
+      ok &= cmpad.near_equal(y[0], check, rel_error, x)
+   #
+   # x, check
+   # a matrix that requires pivoting (x[0] is zero)
+   x[0]  = 0.0
+   check = - x[1]*(x[3]*x[8] - x[5]*x[6]) + x[2]*(x[3]*x[7] - x[4]*x[6])
+   #
+   # ok
+   y   = det(x)
+   ok &= cmpad.near_equal(y[0], check, rel_error, x)
+   #
+   return ok
+#
+# test_det_by_lu
+def test_det_by_lu() :
+   assert xam_det_by_lu() == True
+# END PYTHON
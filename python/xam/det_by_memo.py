@@ -0,0 +1,82 @@
+# SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+# SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+# SPDX-FileContributor: 2024 Bradley M. Bell
+# ---------------------------------------------------------------------------
+r'''
+{xrst_begin xam_det_by_memo.py}
+
+Python Example and Test of det_by_memo
+######################################
+
+{xrst_literal
+   # BEGIN PYTHON
+   # END PYTHON
+}
+
+{xrst_end xam_det_by_memo.py}
+'''
+# BEGIN PYTHON
+import cmpad
+import numpy
+#
+# xam_det_by_memo
+def xam_det_by_memo() :
+   #
+   # ok
+   ok = True
+   #
+   # rel_error
+   rel_error = 100. * numpy.finfo(float).eps
+   #
+   # ell
+   # dimension of the matrix
+   ell = 3;
+   #
+   # det
+   det = cmpad.det_by_memo()
+   #
+   # det.setup
+   option = { 'n_arg' : ell * ell , 'n_other' : 0 }
+   det.setup(option)
+   #
+   # x
+   x = [
+      1., 2., 3., # x[0] x[1] x[2]
+      3., 2., 1., # x[3] x[4] x[5]
+      2., 1., 2.  # x[6] x[7] x[8]
+   ]
+   ok &= len(x) == ell * ell
+   #
+   # y
+   y = det(x)
+   #
+   # check
+   check = \
+      + x[0]*(x[4]*x[8] - x[5]*x[7]) \
+      - x[1]*(x[3]*x[8] - x[5]*x[6]) \
+      + x[2]*(x[3]*x[7] - x[4]*x[6])
+   #
+   # ok
+   ok &= y[0] == check
+   #
+   # ell, option, x
+   # a larger matrix with random elements
+   ell    = 5
+   option = { 'n_arg' : ell * ell , 'n_other' : 0 }
+   x      = numpy.random.uniform(0.0, 1.0, ell * ell)
+   #
+   # minor
+   minor = cmpad.det_by_minor()
+   minor.setup(option)
+   #
+   # ok
+   # same determinant as expansion by minors
+   det.setup(option)
+   ok &= cmpad.near_equal( det(x)[0], minor(x)[0], rel_error, x)
+   #
+   return ok
+#
+# test_det_by_memo
+def test_det_by_memo() :
+   assert xam_det_by_memo() == True
+# END PYTHON